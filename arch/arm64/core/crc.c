@@ -0,0 +1,103 @@
+/*
+ * Copyright (c) 2026 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/init.h>
+#include <zephyr/arch/cpu.h>
+#include <zephyr/sys/libc-hooks.h>
+#include <zephyr/sys/unaligned.h>
+
+/*
+ * The CRC32 instructions are optional in ARMv8.0, so they are only used
+ * when ID_AA64ISAR0_EL1 reports them. The ".arch_extension crc" directive
+ * allows assembling them without building everything with +crc.
+ */
+#define CRC32_ASM(insn, reg) ".arch_extension crc\n\t" insn " %w0, %w0, %" reg "1"
+
+#define CRC32_FUNCS(name, insn)							\
+static ALWAYS_INLINE uint32_t name##_64(uint32_t crc, uint64_t val)		\
+{										\
+	__asm__(CRC32_ASM(insn "x", "x") : "+r" (crc) : "r" (val));	\
+	return crc;								\
+}										\
+										\
+static ALWAYS_INLINE uint32_t name##_8(uint32_t crc, uint8_t val)		\
+{										\
+	__asm__(CRC32_ASM(insn "b", "w") : "+r" (crc) : "r" (val));	\
+	return crc;								\
+}										\
+										\
+static uint32_t name##_update(uint32_t crc, const uint8_t *data, size_t len)	\
+{										\
+	for (; len >= 8; len -= 8, data += 8) {					\
+		crc = name##_64(crc, UNALIGNED_GET((const uint64_t *)data));	\
+	}									\
+										\
+	for (; len > 0; len--, data++) {					\
+		crc = name##_8(crc, *data);					\
+	}									\
+										\
+	return crc;								\
+}
+
+CRC32_FUNCS(crc32, "crc32")
+CRC32_FUNCS(crc32c, "crc32c")
+
+/*
+ * ID_AA64ISAR0_EL1 cannot be read from EL0, so it is read once at boot.
+ * The result lives with the C library globals, which user threads can
+ * read, when there is such a partition. Otherwise user threads use the
+ * table based code. Anything running before the init hook does too.
+ */
+#ifdef Z_LIBC_PARTITION_EXISTS
+static Z_LIBC_DATA bool crc32_hw;
+#else
+static bool crc32_hw;
+#endif
+
+static int crc32_hw_detect(void)
+{
+	uint64_t isar0 = read_id_aa64isar0_el1();
+
+	crc32_hw = ((isar0 >> ID_AA64ISAR0_CRC32_SHIFT) & ID_AA64ISAR0_CRC32_MASK) != 0U;
+
+	return 0;
+}
+
+SYS_INIT(crc32_hw_detect, PRE_KERNEL_1, 0);
+
+static ALWAYS_INLINE bool crc32_supported(void)
+{
+#if defined(CONFIG_USERSPACE) && !defined(Z_LIBC_PARTITION_EXISTS)
+	if (k_is_user_context()) {
+		return false;
+	}
+#endif
+
+	return crc32_hw;
+}
+
+bool arch_crc32_ieee_update(uint32_t *crc, const uint8_t *data, size_t len)
+{
+	if (!crc32_supported()) {
+		return false;
+	}
+
+	*crc = crc32_update(*crc, data, len);
+
+	return true;
+}
+
+bool arch_crc32c_update(uint32_t *crc, const uint8_t *data, size_t len)
+{
+	if (!crc32_supported()) {
+		return false;
+	}
+
+	*crc = crc32c_update(*crc, data, len);
+
+	return true;
+}
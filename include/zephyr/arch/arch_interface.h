@@ -1258,6 +1258,48 @@ bool arch_pcie_msi_vector_connect(msi_vector_t *vector,
  */
 void arch_spin_relax(void);
 
+/**
+ * @defgroup arch-crc Architecture-specific CRC APIs
+ * @ingroup arch-interface
+ *
+ * Used by the CRC library when CONFIG_CRC_ARCH is enabled. Both functions
+ * work on the raw, reflected CRC register: the caller applies any initial
+ * value and final XOR. They return false, without touching @a crc, when
+ * the CPU turns out not to implement the required instructions, in which
+ * case the caller falls back to the table driven implementation.
+ *
+ * @{
+ */
+
+#if defined(CONFIG_ARCH_HAS_CRC32) || defined(__DOXYGEN__)
+/**
+ * @brief Update a CRC-32 (IEEE 802.3, polynomial 0x04C11DB7)
+ *
+ * @param crc CRC register, updated in place
+ * @param data Input data
+ * @param len Length of the input data in bytes
+ *
+ * @return true if the CRC was updated, false if not supported by the CPU
+ */
+bool arch_crc32_ieee_update(uint32_t *crc, const uint8_t *data, size_t len);
+
+/**
+ * @brief Update a CRC-32C (Castagnoli, polynomial 0x1EDC6F41)
+ *
+ * @param crc CRC register, updated in place
+ * @param data Input data
+ * @param len Length of the input data in bytes
+ *
+ * @return true if the CRC was updated, false if not supported by the CPU
+ */
+bool arch_crc32c_update(uint32_t *crc, const uint8_t *data, size_t len);
+#endif /* CONFIG_ARCH_HAS_CRC32 || __DOXYGEN__ */
+
+/**
+ * arch-crc
+ * @}
+ */
+
 /**
  * @defgroup arch-stackwalk Architecture-specific Stack Walk APIs
  * @ingroup arch-interface
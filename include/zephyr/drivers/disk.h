@@ -83,6 +83,22 @@ extern "C" {
 
 struct disk_operations;
 
+/**
+ * @brief Disk access cache statistics
+ */
+struct disk_cache_stats {
+	/** Sectors read from the cache */
+	uint32_t hits;
+	/** Sectors read from the disk, as they were not cached */
+	uint32_t misses;
+	/** Sectors read ahead from the disk */
+	uint32_t read_ahead;
+	/** Dirty sectors written back to the disk */
+	uint32_t write_backs;
+	/** Disk writes done to write back the dirty sectors */
+	uint32_t write_calls;
+};
+
 /**
  * @brief Disk info
  */
@@ -97,6 +113,14 @@ struct disk_info {
 	const struct device *dev;
 	/** Internally used disk reference count */
 	uint16_t refcnt;
+#if defined(CONFIG_DISK_ACCESS_CACHE) || defined(__DOXYGEN__)
+	/** Internally used sector size, 0 until read by the cache */
+	uint32_t cache_sector_size;
+	/** Internally used sector count */
+	uint32_t cache_sector_count;
+	/** Disk access cache statistics */
+	struct disk_cache_stats cache_stats;
+#endif
 };
 
 /**
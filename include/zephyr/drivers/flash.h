@@ -27,6 +27,10 @@
 #include <sys/types.h>
 #include <zephyr/device.h>
 
+#if defined(CONFIG_FLASH_RTIO)
+#include <zephyr/rtio/rtio.h>
+#endif
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -202,6 +206,17 @@ typedef int (*flash_api_read_jedec_id)(const struct device *dev, uint8_t *id);
 typedef int (*flash_api_ex_op)(const struct device *dev, uint16_t code,
 			       const uintptr_t in, void *out);
 
+#if defined(CONFIG_FLASH_RTIO) || defined(__DOXYGEN__)
+/**
+ * @brief Flash RTIO submit implementation handler type
+ *
+ * Starts the flash read, write or erase of the submission. The driver
+ * completes the submission once the operation is done.
+ */
+typedef void (*flash_api_iodev_submit)(const struct device *dev,
+				       struct rtio_iodev_sqe *iodev_sqe);
+#endif /* CONFIG_FLASH_RTIO */
+
 __subsystem struct flash_driver_api {
 	flash_api_read read;
 	flash_api_write write;
@@ -218,6 +233,9 @@ __subsystem struct flash_driver_api {
 #if defined(CONFIG_FLASH_EX_OP_ENABLED)
 	flash_api_ex_op ex_op;
 #endif /* CONFIG_FLASH_EX_OP_ENABLED */
+#if defined(CONFIG_FLASH_RTIO)
+	flash_api_iodev_submit iodev_submit;
+#endif /* CONFIG_FLASH_RTIO */
 };
 
 /**
@@ -702,6 +720,141 @@ static inline int z_impl_flash_ex_op(const struct device *dev, uint16_t code,
 #endif /* CONFIG_FLASH_EX_OP_ENABLED */
 }
 
+#if defined(CONFIG_FLASH_RTIO) || defined(__DOXYGEN__)
+
+/**
+ * @brief Fallback submit implementation
+ *
+ * Runs the flash operations of the submission with the blocking flash API
+ * from the RTIO work-queues. It is used for flash drivers that do not
+ * implement the iodev_submit function.
+ *
+ * @param dev Flash device
+ * @param iodev_sqe Prepared submission queue entry connected to an iodev
+ *                  defined by FLASH_DT_IODEV_DEFINE or flash_iodev_init().
+ */
+void flash_iodev_submit_fallback(const struct device *dev, struct rtio_iodev_sqe *iodev_sqe);
+
+/**
+ * @brief Submit request(s) to a flash device with RTIO
+ *
+ * @param iodev_sqe Prepared submission queue entry connected to an iodev
+ *                  defined by FLASH_DT_IODEV_DEFINE or flash_iodev_init().
+ */
+static inline void flash_iodev_submit(struct rtio_iodev_sqe *iodev_sqe)
+{
+	const struct device *dev = (const struct device *)iodev_sqe->sqe.iodev->data;
+	const struct flash_driver_api *api = (const struct flash_driver_api *)dev->api;
+
+	if (api->iodev_submit == NULL) {
+		flash_iodev_submit_fallback(dev, iodev_sqe);
+		return;
+	}
+	api->iodev_submit(dev, iodev_sqe);
+}
+
+extern const struct rtio_iodev_api flash_iodev_api;
+
+/**
+ * @brief Define an iodev for a flash device
+ *
+ * @param name Symbolic name of the iodev to define
+ * @param node_id Devicetree node identifier of the flash device
+ */
+#define FLASH_DT_IODEV_DEFINE(name, node_id)					\
+	RTIO_IODEV_DEFINE(name, &flash_iodev_api, (void *)DEVICE_DT_GET(node_id))
+
+/**
+ * @brief Initialize an iodev for a flash device at runtime
+ *
+ * @param iodev iodev to initialize
+ * @param dev Flash device
+ */
+static inline void flash_iodev_init(struct rtio_iodev *iodev, const struct device *dev)
+{
+	iodev->api = &flash_iodev_api;
+	iodev->data = (void *)dev;
+}
+
+/**
+ * @brief Prepare a flash read submission
+ *
+ * The submission completes with 0 on success, or a negative errno code as
+ * returned by @ref flash_read.
+ *
+ * @param sqe Submission to prepare
+ * @param iodev Flash iodev
+ * @param offset Offset to read from
+ * @param buf Buffer to read into
+ * @param len Number of bytes to read
+ * @param userdata User data returned with the completion
+ */
+static inline void flash_sqe_prep_read(struct rtio_sqe *sqe, const struct rtio_iodev *iodev,
+				       off_t offset, void *buf, size_t len, void *userdata)
+{
+	memset(sqe, 0, sizeof(struct rtio_sqe));
+	sqe->op = RTIO_OP_FLASH_READ;
+	sqe->prio = RTIO_PRIO_NORM;
+	sqe->iodev = iodev;
+	sqe->flash.offset = offset;
+	sqe->flash.len = len;
+	sqe->flash.buf = buf;
+	sqe->userdata = userdata;
+}
+
+/**
+ * @brief Prepare a flash write submission
+ *
+ * The submission completes with 0 on success, or a negative errno code as
+ * returned by @ref flash_write. The buffer must remain valid until then.
+ *
+ * @param sqe Submission to prepare
+ * @param iodev Flash iodev
+ * @param offset Offset to write to
+ * @param buf Data to write
+ * @param len Number of bytes to write
+ * @param userdata User data returned with the completion
+ */
+static inline void flash_sqe_prep_write(struct rtio_sqe *sqe, const struct rtio_iodev *iodev,
+					off_t offset, const void *buf, size_t len,
+					void *userdata)
+{
+	memset(sqe, 0, sizeof(struct rtio_sqe));
+	sqe->op = RTIO_OP_FLASH_WRITE;
+	sqe->prio = RTIO_PRIO_NORM;
+	sqe->iodev = iodev;
+	sqe->flash.offset = offset;
+	sqe->flash.len = len;
+	sqe->flash.buf = (uint8_t *)buf;
+	sqe->userdata = userdata;
+}
+
+/**
+ * @brief Prepare a flash erase submission
+ *
+ * The submission completes with 0 on success, or a negative errno code as
+ * returned by @ref flash_erase.
+ *
+ * @param sqe Submission to prepare
+ * @param iodev Flash iodev
+ * @param offset Offset of the area to erase
+ * @param size Size of the area to erase
+ * @param userdata User data returned with the completion
+ */
+static inline void flash_sqe_prep_erase(struct rtio_sqe *sqe, const struct rtio_iodev *iodev,
+					off_t offset, size_t size, void *userdata)
+{
+	memset(sqe, 0, sizeof(struct rtio_sqe));
+	sqe->op = RTIO_OP_FLASH_ERASE;
+	sqe->prio = RTIO_PRIO_NORM;
+	sqe->iodev = iodev;
+	sqe->flash.offset = offset;
+	sqe->flash.len = size;
+	sqe->userdata = userdata;
+}
+
+#endif /* CONFIG_FLASH_RTIO */
+
 #ifdef __cplusplus
 }
 #endif
@@ -33,6 +33,20 @@ extern "C" {
  * @{
  */
 
+/**
+ * @brief Non-volatile Storage garbage collection statistics
+ */
+struct nvs_gc_stats {
+	/** Sectors garbage collected by nvs_write() calls */
+	uint32_t foreground;
+	/** Sectors garbage collected in the background */
+	uint32_t background;
+	/** Sectors erased in the background */
+	uint32_t background_erases;
+	/** Longest nvs_write() call, in microseconds */
+	uint32_t write_max_us;
+};
+
 /**
  * @brief Non-volatile Storage File system structure
  */
@@ -62,8 +76,51 @@ struct nvs_fs {
 #if CONFIG_NVS_LOOKUP_CACHE
 	uint32_t lookup_cache[CONFIG_NVS_LOOKUP_CACHE_SIZE];
 #endif
+#if defined(CONFIG_NVS_LOOKUP_INDEX) || defined(__DOXYGEN__)
+	/** Internally used, id of each lookup cache entry */
+	uint16_t lookup_ids[CONFIG_NVS_LOOKUP_CACHE_SIZE];
+	/** Internally used, some ids did not fit in the lookup index */
+	bool lookup_index_overflow;
+#endif
+#if defined(CONFIG_NVS_BACKGROUND_GC) || defined(__DOXYGEN__)
+	/** Run the garbage collection in the background, set before nvs_mount() */
+	bool background_gc;
+	/** Internally used, the sector after the write sector must be erased */
+	bool gc_erase_pending;
+	/** Internally used, the write sector must be garbage collected */
+	bool gc_requested;
+	/** Internally used background garbage collection work */
+	struct k_work gc_work;
+#endif
+#if defined(CONFIG_NVS_GC_STATS) || defined(__DOXYGEN__)
+	/** Garbage collection statistics */
+	struct nvs_gc_stats gc_stats;
+#endif
+};
+
+/**
+ * @brief Non-volatile Storage entry, as reported by nvs_foreach()
+ */
+struct nvs_entry {
+	/** Id of the entry */
+	uint16_t id;
+	/** Number of data bytes, 0 if the entry is a deletion */
+	uint16_t len;
+	/** Address of the allocation table entry, for nvs_entry_read() */
+	uint32_t ate_addr;
 };
 
+/**
+ * @brief Callback called by nvs_foreach() for each entry.
+ *
+ * @param fs Pointer to file system
+ * @param entry Entry found
+ * @param arg Argument given to nvs_foreach()
+ *
+ * @return 0 to continue with the next entry, any other value to stop.
+ */
+typedef int (*nvs_entry_cb_t)(struct nvs_fs *fs, const struct nvs_entry *entry, void *arg);
+
 /**
  * @}
  */
@@ -153,6 +210,44 @@ ssize_t nvs_read(struct nvs_fs *fs, uint16_t id, void *data, size_t len);
  */
 ssize_t nvs_read_hist(struct nvs_fs *fs, uint16_t id, void *data, size_t len, uint16_t cnt);
 
+/**
+ * @brief Walk through all the entries of the file system.
+ *
+ * The allocation table is read once, from the newest entry to the oldest one, and @p cb is
+ * called for every valid entry found, deletions included. The first entry reported for an id
+ * is its latest one, and the older ones of the same id reported after it are history entries
+ * that the callback should ignore. This is much faster than calling nvs_read() for every id,
+ * as each nvs_read() walks the allocation table on its own.
+ *
+ * The file system must not be written before the walk is over and the reported entries are no
+ * longer used, as garbage collection could then move them.
+ *
+ * @param fs Pointer to file system
+ * @param cb Callback called for each entry
+ * @param arg Argument passed to @p cb
+ *
+ * @retval 0 All the entries were walked through
+ * @retval -ERRNO errno code if error
+ * @return The value returned by @p cb if it stopped the walk.
+ */
+int nvs_foreach(struct nvs_fs *fs, nvs_entry_cb_t cb, void *arg);
+
+/**
+ * @brief Read the data of an entry reported by nvs_foreach().
+ *
+ * @param fs Pointer to file system
+ * @param entry Entry to be read
+ * @param data Pointer to data buffer
+ * @param len Number of bytes to be read
+ *
+ * @return Number of bytes read. On success, it will be equal to the number of bytes requested
+ * to be read. When the return value is larger than the number of bytes requested to read this
+ * indicates not all bytes were read, and more data is available. -ENOENT is returned if the
+ * entry is a deletion or was moved by garbage collection since it was reported. On error,
+ * returns negative value of errno.h defined error codes.
+ */
+ssize_t nvs_entry_read(struct nvs_fs *fs, const struct nvs_entry *entry, void *data, size_t len);
+
 /**
  * @brief Calculate the available free space in the file system.
  *
@@ -30,6 +30,18 @@ extern "C" {
  * @{
  */
 
+/** Zephyr Memory Storage garbage collection statistics */
+struct zms_gc_stats {
+	/** Sectors garbage collected by zms_write() calls */
+	uint32_t foreground;
+	/** Sectors garbage collected in the background */
+	uint32_t background;
+	/** Sectors erased in the background */
+	uint32_t background_erases;
+	/** Longest zms_write() call, in microseconds */
+	uint32_t write_max_us;
+};
+
 /** Zephyr Memory Storage file system structure */
 struct zms_fs {
 	/** File system offset in flash */
@@ -64,6 +76,20 @@ struct zms_fs {
 	/** Lookup table used to cache ATE addresses of written IDs */
 	uint64_t lookup_cache[CONFIG_ZMS_LOOKUP_CACHE_SIZE];
 #endif
+#if defined(CONFIG_ZMS_BACKGROUND_GC) || defined(__DOXYGEN__)
+	/** Run the garbage collection in the background, set before zms_mount() */
+	bool background_gc;
+	/** Internally used, the sector after the write sector must be erased */
+	bool gc_erase_pending;
+	/** Internally used, the write sector must be garbage collected */
+	bool gc_requested;
+	/** Internally used background garbage collection work */
+	struct k_work gc_work;
+#endif
+#if defined(CONFIG_ZMS_GC_STATS) || defined(__DOXYGEN__)
+	/** Garbage collection statistics */
+	struct zms_gc_stats gc_stats;
+#endif
 };
 
 /**
@@ -2980,6 +2980,7 @@ __syscall int k_stack_pop(struct k_stack *stack, stack_data_t *data,
 
 struct k_work;
 struct k_work_q;
+struct k_work_pool;
 struct k_work_queue_config;
 extern struct k_work_q k_sys_work_q;
 
@@ -3606,6 +3607,97 @@ int k_work_queue_drain(struct k_work_q *queue, bool plug);
  */
 int k_work_queue_unplug(struct k_work_q *queue);
 
+/** @brief Define the stacks for the workers of a work queue pool.
+ *
+ * One stack of @p size bytes is defined per possible CPU.  Pass @c sym[0]
+ * and @p size to k_work_pool_start().
+ *
+ * @param sym Symbol name for the stack array
+ * @param size Size of each worker stack, in bytes
+ */
+#define K_WORK_POOL_STACK_DEFINE(sym, size) \
+	K_THREAD_STACK_ARRAY_DEFINE(sym, CONFIG_MP_MAX_NUM_CPUS, size)
+
+/** @brief Start a work-stealing work queue pool.
+ *
+ * One worker work queue is started per CPU, pinned to its CPU when
+ * CONFIG_SCHED_CPU_MASK is enabled.  The function should not be re-invoked on
+ * a pool.
+ *
+ * @note Requires CONFIG_WORKQUEUE_POOL.
+ *
+ * @param pool pointer to the pool structure.  It must be in zeroed/bss
+ *        memory before first use.
+ *
+ * @param stacks first stack of an array defined with
+ *        K_WORK_POOL_STACK_DEFINE().
+ *
+ * @param stack_size the size passed to K_WORK_POOL_STACK_DEFINE().
+ *
+ * @param prio initial priority of every worker thread
+ *
+ * @param cfg optional additional configuration parameters, applied to every
+ * worker.  Pass @c NULL if not required.
+ */
+void k_work_pool_start(struct k_work_pool *pool,
+		       k_thread_stack_t *stacks, size_t stack_size, int prio,
+		       const struct k_work_queue_config *cfg);
+
+/** @brief Submit a work item to a work queue pool.
+ *
+ * The item is pushed onto the queue of the worker for the current CPU, which
+ * takes its own items newest first.  A worker that has nothing to do takes
+ * the oldest item it may steal from a sibling's queue, so a burst submitted
+ * on one CPU spreads to idle CPUs.  Apart from the queue selection this
+ * behaves like k_work_submit_to_queue(): an item that is already queued stays
+ * where it is, and an item that is running is queued to the worker running
+ * it.  No ordering is guaranteed between distinct items.
+ *
+ * @note Requires CONFIG_WORKQUEUE_POOL.
+ *
+ * @funcprops \isr_ok
+ *
+ * @param pool pointer to the pool structure.
+ *
+ * @param work pointer to the work item.
+ *
+ * @return as for k_work_submit_to_queue().
+ */
+int k_work_pool_submit(struct k_work_pool *pool, struct k_work *work);
+
+/** @brief Wait until every worker of a pool has drained.
+ *
+ * Submissions to the pool, other than ones chained from a worker to its own
+ * queue, are rejected until the call returns.  Because workers steal from one
+ * another the workers are drained repeatedly until a complete pass finds all
+ * of them idle.
+ *
+ * @note Requires CONFIG_WORKQUEUE_POOL.
+ *
+ * @param pool pointer to the pool structure.
+ *
+ * @param plug if true the pool will continue to block new submissions
+ * after all items have drained.
+ *
+ * @retval 1 if call had to wait for the drain to complete
+ * @retval 0 if call did not have to wait
+ * @retval negative if wait was interrupted or failed
+ */
+int k_work_pool_drain(struct k_work_pool *pool, bool plug);
+
+/** @brief Release a work queue pool to accept new submissions.
+ *
+ * @note Requires CONFIG_WORKQUEUE_POOL.
+ *
+ * @funcprops \isr_ok
+ *
+ * @param pool pointer to the pool structure.
+ *
+ * @retval 0 if successfully unplugged
+ * @retval -EALREADY if the pool was not plugged.
+ */
+int k_work_pool_unplug(struct k_work_pool *pool);
+
 /** @brief Initialize a delayable work structure.
  *
  * This must be invoked before scheduling a delayable work structure for the
@@ -4131,6 +4223,22 @@ struct k_work_q {
 
 	/* Flags describing queue state. */
 	uint32_t flags;
+
+#ifdef CONFIG_WORKQUEUE_POOL
+	/* Pool this queue is a worker of, if any. */
+	struct k_work_pool *pool;
+#endif
+};
+
+/** @brief A set of per-CPU work queues that share work by stealing. */
+struct k_work_pool {
+	/* Worker queues, indexed by CPU id. */
+	struct k_work_q workers[CONFIG_MP_MAX_NUM_CPUS];
+
+	/* Number of workers started; accessed with the work module
+	 * spinlock held.
+	 */
+	unsigned int num_workers;
 };
 
 /* Provide the implementation for inline functions declared above */
@@ -5164,8 +5272,27 @@ struct k_mem_slab_info {
 #ifdef CONFIG_MEM_SLAB_TRACE_MAX_UTILIZATION
 	uint32_t max_used;
 #endif
+#ifdef CONFIG_MEM_SLAB_PERCPU_CACHE
+	/* Batches moved between the shared free list and the CPU caches */
+	uint32_t cache_refills;
+	uint32_t cache_flushes;
+#endif
 };
 
+#ifdef CONFIG_MEM_SLAB_PERCPU_CACHE
+/* Per-CPU magazine of free blocks.  Blocks held here are counted in
+ * num_used of the slab but are free as far as users are concerned.
+ * Each one is aligned so that no two CPUs share a cache line.
+ */
+struct k_mem_slab_cache {
+	struct k_spinlock lock;
+	uint32_t count;
+	/* Allocations about to pend, frees skip the cache meanwhile */
+	uint32_t bypass;
+	char *blocks[CONFIG_MEM_SLAB_PERCPU_CACHE_SIZE];
+} __aligned(CONFIG_MEM_SLAB_PERCPU_CACHE_ALIGN);
+#endif
+
 struct k_mem_slab {
 	_wait_q_t wait_q;
 	struct k_spinlock lock;
@@ -5173,6 +5300,14 @@ struct k_mem_slab {
 	char *free_list;
 	struct k_mem_slab_info info;
 
+#ifdef CONFIG_MEM_SLAB_PERCPU_CACHE
+#ifdef CONFIG_MEM_SLAB_TRACE_MAX_UTILIZATION
+	/* Blocks held by users, num_used also counts the cached ones */
+	atomic_t in_use;
+#endif
+	struct k_mem_slab_cache cache[CONFIG_MP_MAX_NUM_CPUS];
+#endif
+
 	SYS_PORT_TRACING_TRACKING_FIELD(k_mem_slab)
 
 #ifdef CONFIG_OBJ_CORE_MEM_SLAB
@@ -5326,7 +5461,17 @@ void k_mem_slab_free(struct k_mem_slab *slab, void *mem);
  */
 static inline uint32_t k_mem_slab_num_used_get(struct k_mem_slab *slab)
 {
+#ifdef CONFIG_MEM_SLAB_PERCPU_CACHE
+	uint32_t cached = 0;
+
+	for (unsigned int i = 0; i < CONFIG_MP_MAX_NUM_CPUS; i++) {
+		cached += slab->cache[i].count;
+	}
+
+	return slab->info.num_used - cached;
+#else
 	return slab->info.num_used;
+#endif
 }
 
 /**
@@ -5361,7 +5506,7 @@ static inline uint32_t k_mem_slab_max_used_get(struct k_mem_slab *slab)
  */
 static inline uint32_t k_mem_slab_num_free_get(struct k_mem_slab *slab)
 {
-	return slab->info.num_blocks - slab->info.num_used;
+	return slab->info.num_blocks - k_mem_slab_num_used_get(slab);
 }
 
 /**
@@ -5507,10 +5652,20 @@ void *k_heap_realloc(struct k_heap *h, void *ptr, size_t bytes, k_timeout_t time
  */
 void k_heap_free(struct k_heap *h, void *mem) __attribute_nonnull(1);
 
+/* Size-class list heads and depths stored in the heap header when
+ * CONFIG_SYS_HEAP_SIZE_CLASSES is enabled.  See lib/heap/heap.h
+ */
+#ifdef CONFIG_SYS_HEAP_SIZE_CLASSES
+#define Z_HEAP_SIZE_CLASS_BYTES \
+	ROUND_UP(6 * ((CONFIG_SYS_HEAP_SIZE_CLASS_MAX + 15) / 8), 8)
+#else
+#define Z_HEAP_SIZE_CLASS_BYTES 0
+#endif
+
 /* Hand-calculated minimum heap sizes needed to return a successful
  * 1-byte allocation.  See details in lib/os/heap.[ch]
  */
-#define Z_HEAP_MIN_SIZE ((sizeof(void *) > 4) ? 56 : 44)
+#define Z_HEAP_MIN_SIZE (((sizeof(void *) > 4) ? 56 : 44) + Z_HEAP_SIZE_CLASS_BYTES)
 
 /**
  * @brief Define a static k_heap in the specified linker section
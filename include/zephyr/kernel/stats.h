@@ -27,6 +27,16 @@ struct k_cycle_stats {
 	uint32_t  num_windows;  /**< \# of usage windows */
 	/** @} */
 #endif /* CONFIG_SCHED_THREAD_USAGE_ANALYSIS */
+#if defined(CONFIG_SCHED_THREAD_USAGE_LATENCY) || defined(__DOXYGEN__)
+	/**
+	 * @name Fields available when CONFIG_SCHED_THREAD_USAGE_LATENCY is selected.
+	 * @{
+	 */
+	/** Ready to switched in latencies, in log2 buckets of cycles */
+	uint32_t  latency[CONFIG_SCHED_THREAD_USAGE_LATENCY_BUCKETS];
+	uint32_t  latency_max;  /**< longest latency in cycles */
+	/** @} */
+#endif /* CONFIG_SCHED_THREAD_USAGE_LATENCY */
 	bool      track_usage;  /**< true if gathering usage stats */
 };
 
@@ -103,6 +103,12 @@ struct _thread_base {
 
 #ifdef CONFIG_SCHED_DEADLINE
 	int prio_deadline;
+#ifdef CONFIG_SCHED_MULTIQ
+	/* Set once a deadline was given; selects the deadline ordered
+	 * part of the multi-queue ready queue
+	 */
+	uint8_t has_deadline;
+#endif /* CONFIG_SCHED_MULTIQ */
 #endif /* CONFIG_SCHED_DEADLINE */
 
 	uint32_t order_key;
@@ -145,6 +151,10 @@ struct _thread_base {
 #ifdef CONFIG_SCHED_THREAD_USAGE
 	struct k_cycle_stats  usage;   /* Track thread usage statistics */
 #endif /* CONFIG_SCHED_THREAD_USAGE */
+
+#ifdef CONFIG_SCHED_THREAD_USAGE_LATENCY
+	uint32_t ready0;               /* Timestamp of becoming ready, 0 if none */
+#endif /* CONFIG_SCHED_THREAD_USAGE_LATENCY */
 };
 
 typedef struct _thread_base _thread_base_t;
@@ -237,6 +247,17 @@ typedef struct k_thread_runtime_stats {
 	uint64_t idle_cycles;
 #endif /* CONFIG_SCHED_THREAD_USAGE_ALL */
 
+#ifdef CONFIG_SCHED_THREAD_USAGE_LATENCY
+	/*
+	 * Histogram of the cycles between becoming ready and being switched
+	 * in. Bucket N counts latencies in [2^N, 2^(N+1)), the last bucket
+	 * counts everything longer. For CPUs, this covers all the threads
+	 * switched in on that CPU.
+	 */
+	uint32_t latency[CONFIG_SCHED_THREAD_USAGE_LATENCY_BUCKETS];
+	uint32_t latency_max;         /* longest latency in cycles */
+#endif /* CONFIG_SCHED_THREAD_USAGE_LATENCY */
+
 #if defined(__cplusplus) && !defined(CONFIG_SCHED_THREAD_USAGE) &&                                 \
 	!defined(CONFIG_SCHED_THREAD_USAGE_ANALYSIS) && !defined(CONFIG_SCHED_THREAD_USAGE_ALL)
 	/* If none of the above Kconfig values are defined, this struct will have a size 0 in C
@@ -112,13 +112,19 @@ struct _priq_rb {
 /* Traditional/textbook "multi-queue" structure.  Separate lists for a
  * small number (max 32 here) of fixed priorities.  This corresponds
  * to the original Zephyr scheduler.  RAM requirements are
- * comparatively high, but performance is very fast.  Won't work with
- * features like deadline scheduling which need large priority spaces
- * to represent their requirements.
+ * comparatively high, but performance is very fast.  With deadline
+ * scheduling, threads that had a deadline set are kept apart in a small
+ * deadline ordered tree per priority, with its first node cached, and
+ * the list head competes with that node for the priority.
  */
 struct _priq_mq {
 	sys_dlist_t queues[K_NUM_THREAD_PRIO];
 	unsigned long bitmask[PRIQ_BITMAP_SIZE];
+#ifdef CONFIG_SCHED_DEADLINE
+	struct rbtree dl_trees[K_NUM_THREAD_PRIO];
+	struct rbnode *dl_first[K_NUM_THREAD_PRIO];
+	uint32_t next_order_key;
+#endif /* CONFIG_SCHED_DEADLINE */
 };
 
 struct _ready_q {
@@ -299,6 +305,10 @@ struct _timeout {
 #else
 	int32_t dticks;
 #endif
+#ifdef CONFIG_TIMEOUT_QUEUE_PERCPU
+	/* CPU whose timeout queue holds this timeout */
+	uint8_t cpu;
+#endif
 };
 
 typedef void (*k_thread_timeslice_fn_t)(struct k_thread *thread, void *data);
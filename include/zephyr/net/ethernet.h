@@ -210,6 +210,12 @@ enum ethernet_hw_caps {
 
 	/** 5 Gbits link supported */
 	ETHERNET_LINK_5000BASE_T	= BIT(22),
+
+	/** TCP segmentation offload supported. Packets with a non-zero
+	 *  net_pkt_gso_size() are cut into TCP segments of that payload size,
+	 *  including IP and TCP checksum calculation, by the device.
+	 */
+	ETHERNET_HW_TSO			= BIT(23),
 };
 
 /** @cond INTERNAL_HIDDEN */
@@ -2780,6 +2780,17 @@ bool net_if_need_calc_rx_checksum(struct net_if *iface,
 bool net_if_need_calc_tx_checksum(struct net_if *iface,
 				  enum net_if_checksum_type chksum_type);
 
+/**
+ * @brief Check if a large TCP packet needs to be cut into segments by the IP
+ * stack before it is sent. This is not needed if the device supports TCP
+ * segmentation offload.
+ *
+ * @param iface Network interface
+ *
+ * @return True if the IP stack needs to do the segmentation, false otherwise.
+ */
+bool net_if_need_tx_segmentation(struct net_if *iface);
+
 /**
  * @brief Get interface according to index
  *
@@ -275,6 +275,17 @@ struct net_stats_dns {
 	net_stats_t drop;
 };
 
+/**
+ * @brief Receive flow steering statistics
+ */
+struct net_stats_rx_steering {
+	/** Number of received packets put in each RX queue of a traffic class */
+	net_stats_t queued[CONFIG_NET_TC_RX_STEERING_QUEUES];
+
+	/** Number of received packets without a flow hash */
+	net_stats_t unhashed;
+};
+
 /**
  * @brief Network packet transfer times for calculating average TX time
  */
@@ -439,6 +450,11 @@ struct net_stats {
 	struct net_stats_dns dns;
 #endif
 
+#if defined(CONFIG_NET_STATISTICS_RX_STEERING)
+	/** Receive flow steering statistics */
+	struct net_stats_rx_steering rx_steering;
+#endif
+
 #if NET_TC_COUNT > 1
 	/** Traffic class statistics */
 	struct net_stats_tc tc;
@@ -76,6 +76,8 @@ extern "C" {
 #define ZSOCK_MSG_DONTWAIT 0x40
 /** zsock_recv: block until the full amount of data can be returned */
 #define ZSOCK_MSG_WAITALL 0x100
+/** zsock_recvmmsg: turn on @ref ZSOCK_MSG_DONTWAIT after the first message */
+#define ZSOCK_MSG_WAITFORONE 0x10000
 /** @} */
 
 /**
@@ -474,6 +476,27 @@ static inline ssize_t zsock_send(int sock, const void *buf, size_t len,
 __syscall ssize_t zsock_sendmsg(int sock, const struct msghdr *msg,
 				int flags);
 
+/**
+ * @brief Send multiple messages on a socket
+ *
+ * @details
+ * Send up to @p vlen messages from @p msgvec in a single call, as if
+ * zsock_sendmsg() was called for each of them. The number of bytes sent
+ * for each message is stored in its @c msg_len field.
+ * This function is also exposed as `sendmmsg()`
+ * if @kconfig{CONFIG_POSIX_API} is defined.
+ *
+ * @param sock Socket descriptor
+ * @param msgvec Array of messages to send
+ * @param vlen Number of messages in @p msgvec
+ * @param flags Flags, as for zsock_sendmsg()
+ *
+ * @return Number of messages sent, or -1 with errno set if the first
+ * message could not be sent.
+ */
+__syscall int zsock_sendmmsg(int sock, struct mmsghdr *msgvec,
+			     unsigned int vlen, int flags);
+
 /**
  * @brief Receive data from an arbitrary network address
  *
@@ -500,6 +523,84 @@ __syscall ssize_t zsock_recvfrom(int sock, void *buf, size_t max_len,
  */
 __syscall ssize_t zsock_recvmsg(int sock, struct msghdr *msg, int flags);
 
+/**
+ * @brief Receive multiple messages from a socket
+ *
+ * @details
+ * Receive up to @p vlen datagrams into @p msgvec in a single call, as if
+ * zsock_recvmsg() was called for each of them. The number of bytes
+ * received for each message is stored in its @c msg_len field. With
+ * @ref ZSOCK_MSG_WAITFORONE, only the first message is waited for. The
+ * @p timeout is checked after each received message, so the call may
+ * still block for longer while waiting for a message.
+ * This function is also exposed as `recvmmsg()`
+ * if @kconfig{CONFIG_POSIX_API} is defined.
+ *
+ * @param sock Socket descriptor
+ * @param msgvec Array of messages to receive into
+ * @param vlen Number of messages in @p msgvec
+ * @param flags Flags, as for zsock_recvmsg(), and @ref ZSOCK_MSG_WAITFORONE
+ * @param timeout Time limit for receiving messages, NULL for no limit
+ *
+ * @return Number of messages received, or -1 with errno set if no message
+ * could be received.
+ */
+__syscall int zsock_recvmmsg(int sock, struct mmsghdr *msgvec,
+			     unsigned int vlen, int flags,
+			     struct timespec *timeout);
+
+/**
+ * @brief Network buffers loaned by zsock_recv_loan()
+ */
+struct zsock_rx_loan {
+	/** @cond INTERNAL_HIDDEN */
+	struct net_pkt *pkt;
+	size_t wnd_len;
+	/** @endcond */
+};
+
+/**
+ * @brief Receive data without copying it
+ *
+ * @details
+ * Like zsock_recvmsg(), but instead of copying the data into the buffers
+ * of @p msg, the @c iov_base and @c iov_len fields of its @c msg_iov array
+ * are set to point to the network buffers holding the data. At most
+ * @c msg_iovlen buffers are loaned, and @c msg_iovlen is updated to the
+ * number of buffers used. For datagram sockets, the part of the datagram
+ * that does not fit is discarded and @ref ZSOCK_MSG_TRUNC is set in
+ * @c msg_flags. For stream sockets, it is left for the next receive call.
+ * No control data is returned.
+ *
+ * The loaned buffers are read-only and count against the network RX
+ * buffer pool until they are given back with zsock_recv_loan_release(),
+ * which must be done before the socket is closed. For stream sockets, the
+ * receive window is only reopened once the loan is released.
+ *
+ * This function is only available to supervisor threads, and only for
+ * the native TCP and UDP sockets, if @kconfig{CONFIG_NET_SOCKETS_RX_LOAN}
+ * is enabled.
+ *
+ * @param sock Socket descriptor
+ * @param msg Message header, @c msg_iov is filled in with the loaned buffers
+ * @param flags @ref ZSOCK_MSG_DONTWAIT or 0
+ * @param loan Loan to be given back with zsock_recv_loan_release()
+ *
+ * @return Number of bytes loaned, 0 on end of stream, or -1 with errno set.
+ */
+ssize_t zsock_recv_loan(int sock, struct msghdr *msg, int flags,
+			struct zsock_rx_loan *loan);
+
+/**
+ * @brief Give back buffers loaned by zsock_recv_loan()
+ *
+ * @param sock Socket descriptor the buffers were received from
+ * @param loan Loan filled in by zsock_recv_loan()
+ *
+ * @return 0 on success, or -1 with errno set.
+ */
+int zsock_recv_loan_release(int sock, struct zsock_rx_loan *loan);
+
 /**
  * @brief Receive data from a connected peer
  *
@@ -890,6 +991,13 @@ static inline ssize_t sendmsg(int sock, const struct msghdr *message,
 	return zsock_sendmsg(sock, message, flags);
 }
 
+/** POSIX wrapper for @ref zsock_sendmmsg */
+static inline int sendmmsg(int sock, struct mmsghdr *msgvec,
+			   unsigned int vlen, int flags)
+{
+	return zsock_sendmmsg(sock, msgvec, vlen, flags);
+}
+
 /** POSIX wrapper for @ref zsock_recvfrom */
 static inline ssize_t recvfrom(int sock, void *buf, size_t max_len, int flags,
 			       struct sockaddr *src_addr, socklen_t *addrlen)
@@ -903,6 +1011,14 @@ static inline ssize_t recvmsg(int sock, struct msghdr *msg, int flags)
 	return zsock_recvmsg(sock, msg, flags);
 }
 
+/** POSIX wrapper for @ref zsock_recvmmsg */
+static inline int recvmmsg(int sock, struct mmsghdr *msgvec,
+			   unsigned int vlen, int flags,
+			   struct timespec *timeout)
+{
+	return zsock_recvmmsg(sock, msgvec, vlen, flags, timeout);
+}
+
 /** POSIX wrapper for @ref zsock_poll */
 static inline int poll(struct zsock_pollfd *fds, int nfds, int timeout)
 {
@@ -1009,6 +1125,8 @@ static inline char *inet_ntop(sa_family_t family, const void *src, char *dst,
 #define MSG_DONTWAIT ZSOCK_MSG_DONTWAIT
 /** POSIX wrapper for @ref ZSOCK_MSG_WAITALL */
 #define MSG_WAITALL ZSOCK_MSG_WAITALL
+/** POSIX wrapper for @ref ZSOCK_MSG_WAITFORONE */
+#define MSG_WAITFORONE ZSOCK_MSG_WAITFORONE
 
 /** POSIX wrapper for @ref ZSOCK_SHUT_RD */
 #define SHUT_RD ZSOCK_SHUT_RD
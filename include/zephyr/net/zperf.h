@@ -69,6 +69,10 @@ struct zperf_results {
 	uint64_t client_time_in_us;   /**< Client connection time in microseconds */
 	uint32_t packet_size;         /**< Packet size */
 	uint32_t nb_packets_errors;   /**< Number of packet errors */
+	/** CPU cycles spent outside of the idle thread during the transfer,
+	 *  0 if not measured (requires CONFIG_SCHED_THREAD_USAGE_ALL).
+	 */
+	uint64_t cpu_cycles;
 };
 
 /**
@@ -27,6 +27,7 @@
 #define ZEPHYR_INCLUDE_RTIO_RTIO_H_
 
 #include <string.h>
+#include <sys/types.h>
 
 #include <zephyr/app_memory/app_memdomain.h>
 #include <zephyr/device.h>
@@ -286,6 +287,13 @@ struct rtio_sqe {
 
 		/** OP_I2C_CONFIGURE */
 		uint32_t i2c_config;
+
+		/** OP_FLASH_READ, OP_FLASH_WRITE and OP_FLASH_ERASE */
+		struct {
+			off_t offset; /**< Offset in the flash device */
+			uint32_t len; /**< Number of bytes to read, write or erase */
+			uint8_t *buf; /**< Buffer to read into or write from */
+		} flash;
 	};
 };
 
@@ -483,6 +491,15 @@ struct rtio_iodev {
 /** An operation to configure I2C buses */
 #define RTIO_OP_I2C_CONFIGURE (RTIO_OP_I2C_RECOVER+1)
 
+/** An operation that reads from a flash device */
+#define RTIO_OP_FLASH_READ (RTIO_OP_I2C_CONFIGURE+1)
+
+/** An operation that writes to a flash device */
+#define RTIO_OP_FLASH_WRITE (RTIO_OP_FLASH_READ+1)
+
+/** An operation that erases an area of a flash device */
+#define RTIO_OP_FLASH_ERASE (RTIO_OP_FLASH_WRITE+1)
+
 /**
  * @brief Prepare a nop (no op) submission
  */
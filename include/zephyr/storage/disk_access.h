@@ -113,6 +113,18 @@ int disk_access_write(const char *pdrv, const uint8_t *data_buf,
  */
 int disk_access_ioctl(const char *pdrv, uint8_t cmd, void *buff);
 
+/**
+ * @brief Get the disk access cache statistics of a disk
+ *
+ * Requires CONFIG_DISK_ACCESS_CACHE.
+ *
+ * @param[in] pdrv          Disk name
+ * @param[out] stats        Statistics of the disk
+ *
+ * @return 0 on success, negative errno code on fail
+ */
+int disk_access_cache_stats(const char *pdrv, struct disk_cache_stats *stats);
+
 #ifdef __cplusplus
 }
 #endif
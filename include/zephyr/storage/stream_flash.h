@@ -113,6 +113,10 @@ size_t stream_flash_bytes_written(const struct stream_flash_ctx *ctx);
  * Once context has been flushed, it can be re-initialized and re-used for new
  * stream flash session.
  *
+ * With CONFIG_STREAM_FLASH_ERASE_ASYNC, the page of the data left in the
+ * buffer is erased in the background when @p flush is false, and the next
+ * write of the buffer waits for the erase to complete.
+ *
  * @param ctx context
  * @param data data to write
  * @param len Number of bytes to write
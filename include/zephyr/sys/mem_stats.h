@@ -18,6 +18,7 @@ extern "C" {
 #endif
 
 #include <stddef.h>
+#include <stdint.h>
 
 /* A common structure used to report runtime memory usage statistics */
 
@@ -25,6 +26,13 @@ struct sys_memory_stats {
 	size_t  free_bytes;
 	size_t  allocated_bytes;
 	size_t  max_allocated_bytes;
+#ifdef CONFIG_MEM_SLAB_PERCPU_CACHE
+	/* Batches moved between the shared free list and the per-CPU
+	 * caches of a memory slab, only set by the memory slab stats.
+	 */
+	uint32_t cache_refills;
+	uint32_t cache_flushes;
+#endif
 };
 
 #ifdef __cplusplus
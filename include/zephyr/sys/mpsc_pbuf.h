@@ -64,6 +64,17 @@ extern "C" {
 /** @brief Flag indicated that buffer is currently full. */
 #define MPSC_PBUF_FULL BIT(3)
 
+/** @brief Flag enabling lockless reservation.
+ *
+ * If flag is set then producers reserve space and commit packets using atomic
+ * operations instead of taking the buffer spinlock, falling back to the
+ * spinlock only when the buffer must wrap, drop packets or wait for space.
+ * Requires @kconfig{CONFIG_MPSC_PBUF_LOCKLESS} and a power of 2 buffer size,
+ * otherwise the flag is cleared during initialization. The consumer must free
+ * a claimed packet before it claims the next one.
+ */
+#define MPSC_PBUF_MODE_LOCKLESS BIT(4)
+
 /**@} */
 
 /* Forward declaration */
@@ -106,6 +117,16 @@ struct mpsc_pbuf_buffer {
 	/** Lock. */
 	struct k_spinlock lock;
 
+#ifdef CONFIG_MPSC_PBUF_LOCKLESS
+	/** Free running reservation position used in lockless mode. Most
+	 * significant bit is set while a producer holds the lock.
+	 */
+	atomic_t reserve;
+
+	/** Free running count of committed words used in lockless mode. */
+	atomic_t committed;
+#endif
+
 	/** User callback called whenever packet is dropped.
 	 *
 	 * May be NULL if unneeded.
@@ -0,0 +1,92 @@
+/*
+ * Copyright (c) 2026 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef ZEPHYR_INCLUDE_ZEPHYR_ZVFS_EPOLL_H_
+#define ZEPHYR_INCLUDE_ZEPHYR_ZVFS_EPOLL_H_
+
+#include <stdint.h>
+
+#include <zephyr/kernel.h>
+#include <zephyr/sys/fdtable.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define ZVFS_EPOLLIN      ZVFS_POLLIN
+#define ZVFS_EPOLLPRI     ZVFS_POLLPRI
+#define ZVFS_EPOLLOUT     ZVFS_POLLOUT
+#define ZVFS_EPOLLERR     ZVFS_POLLERR
+#define ZVFS_EPOLLHUP     ZVFS_POLLHUP
+#define ZVFS_EPOLLONESHOT BIT(30)
+
+#define ZVFS_EPOLL_CTL_ADD 1
+#define ZVFS_EPOLL_CTL_DEL 2
+#define ZVFS_EPOLL_CTL_MOD 3
+
+union zvfs_epoll_data {
+	void *ptr;
+	int fd;
+	uint32_t u32;
+	uint64_t u64;
+};
+
+struct zvfs_epoll_event {
+	uint32_t events;
+	union zvfs_epoll_data data;
+};
+
+/**
+ * @brief Create a ZVFS event notification instance
+ *
+ * The instance keeps a list of file descriptors of interest, which is
+ * managed with @ref zvfs_epoll_ctl, and reports the ones that are ready
+ * with @ref zvfs_epoll_wait. Events are level-triggered. The list is
+ * not updated when a file descriptor is closed, so it must be removed
+ * from the list first.
+ *
+ * @param flags Must be 0
+ *
+ * @return New ZVFS epoll file descriptor on success, -1 on error
+ */
+int zvfs_epoll_create(int flags);
+
+/**
+ * @brief Add, modify or remove a file descriptor of interest
+ *
+ * The change is picked up by threads already waiting on the instance.
+ *
+ * @param epfd ZVFS epoll file descriptor
+ * @param op ZVFS_EPOLL_CTL_ADD, ZVFS_EPOLL_CTL_MOD or ZVFS_EPOLL_CTL_DEL
+ * @param fd File descriptor of interest
+ * @param event Events to wait for and data to report them with, unused
+ *              for ZVFS_EPOLL_CTL_DEL
+ *
+ * @return 0 on success, -1 on error
+ */
+int zvfs_epoll_ctl(int epfd, int op, int fd, struct zvfs_epoll_event *event);
+
+/**
+ * @brief Wait for file descriptors of interest to become ready
+ *
+ * Every call prepares the poll events of all the file descriptors of
+ * interest, so it takes about as long as zvfs_poll() on the same set.
+ *
+ * @param epfd ZVFS epoll file descriptor
+ * @param events Array filled in with the ready file descriptors
+ * @param maxevents Number of elements in @p events
+ * @param timeout Timeout in milliseconds, -1 to wait forever
+ *
+ * @return Number of ready file descriptors, 0 on timeout, -1 on error
+ */
+int zvfs_epoll_wait(int epfd, struct zvfs_epoll_event *events, int maxevents,
+		    int timeout);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ZEPHYR_INCLUDE_ZEPHYR_ZVFS_EPOLL_H_ */
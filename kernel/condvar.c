@@ -73,9 +73,38 @@ int z_vrfy_k_condvar_signal(struct k_condvar *condvar)
 #include <zephyr/syscalls/k_condvar_signal_mrsh.c>
 #endif /* CONFIG_USERSPACE */
 
+#ifdef CONFIG_CONDVAR_REQUEUE
+static int other_mutex_walk_op(struct k_thread *thread, void *data)
+{
+	return (thread->base.swap_data != data) ? 1 : 0;
+}
+
+/* Move the waiters onto the mutex they waited with, so that they are woken
+ * one at a time as it is unlocked rather than all at once only to block
+ * again in k_mutex_lock().  Only done when every waiter used the same
+ * mutex.  Requeued waiters are marked by having @p condvar as swap data.
+ */
+static unsigned int requeue_waiters(struct k_condvar *condvar)
+{
+	struct k_thread *thread = z_waitq_head(&condvar->wait_q);
+	struct k_mutex *mutex;
+
+	if (thread == NULL) {
+		return 0U;
+	}
+
+	mutex = thread->base.swap_data;
+	if (z_sched_waitq_walk(&condvar->wait_q, other_mutex_walk_op,
+			       mutex) != 0) {
+		return 0U;
+	}
+
+	return z_mutex_requeue(mutex, &condvar->wait_q, condvar);
+}
+#endif /* CONFIG_CONDVAR_REQUEUE */
+
 int z_impl_k_condvar_broadcast(struct k_condvar *condvar)
 {
-	struct k_thread *pending_thread;
 	k_spinlock_key_t key;
 	int woken = 0;
 
@@ -83,13 +112,12 @@ int z_impl_k_condvar_broadcast(struct k_condvar *condvar)
 
 	SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_condvar, broadcast, condvar);
 
-	/* wake up any threads that are waiting to write */
-	for (pending_thread = z_unpend_first_thread(&condvar->wait_q); pending_thread != NULL;
-		 pending_thread = z_unpend_first_thread(&condvar->wait_q)) {
-		woken++;
-		arch_thread_return_value_set(pending_thread, 0);
-		z_ready_thread(pending_thread);
-	}
+#ifdef CONFIG_CONDVAR_REQUEUE
+	woken = (int)requeue_waiters(condvar);
+#endif /* CONFIG_CONDVAR_REQUEUE */
+
+	/* wake up any remaining waiters in one batch */
+	woken += (int)z_sched_wake_n(&condvar->wait_q, UINT_MAX, 0, NULL);
 
 	SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_condvar, broadcast, condvar, woken);
 
@@ -115,10 +143,29 @@ int z_impl_k_condvar_wait(struct k_condvar *condvar, struct k_mutex *mutex,
 	SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_condvar, wait, condvar);
 
 	key = k_spin_lock(&lock);
+#ifdef CONFIG_CONDVAR_REQUEUE
+	/* Tells k_condvar_broadcast() which mutex to requeue us onto */
+	arch_current_thread()->base.swap_data = mutex;
+#endif /* CONFIG_CONDVAR_REQUEUE */
 	k_mutex_unlock(mutex);
 
 	ret = z_pend_curr(&lock, key, &condvar->wait_q, timeout);
+
+#ifdef CONFIG_CONDVAR_REQUEUE
+	if (arch_current_thread()->base.swap_data == condvar) {
+		/* Requeued by a broadcast: k_mutex_unlock() handed us the
+		 * mutex, unless our timeout expired while waiting for it.
+		 */
+		if (ret != 0) {
+			k_mutex_lock(mutex, K_FOREVER);
+		}
+		ret = 0;
+	} else {
+		k_mutex_lock(mutex, K_FOREVER);
+	}
+#else
 	k_mutex_lock(mutex, K_FOREVER);
+#endif /* CONFIG_CONDVAR_REQUEUE */
 
 	SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_condvar, wait, condvar, ret);
 
@@ -5,6 +5,7 @@
  */
 #include <zephyr/kernel.h>
 #include <ksched.h>
+#include <timeout_q.h>
 #include <zephyr/spinlock.h>
 
 extern struct k_spinlock _sched_spinlock;
@@ -29,6 +30,13 @@ static int cpu_mask_mod(k_tid_t thread, uint32_t enable_mask, uint32_t disable_m
 		if (z_is_thread_prevented_from_running(thread)) {
 			thread->base.cpu_mask |= enable_mask;
 			thread->base.cpu_mask  &= ~disable_mask;
+#ifdef CONFIG_TIMEOUT_QUEUE_PERCPU
+			/* Let a pended thread's timeout fire on a CPU it may
+			 * run on. The scheduler lock keeps the thread from
+			 * pending again meanwhile.
+			 */
+			z_timeout_migrate(&thread->base.timeout, thread->base.cpu_mask);
+#endif /* CONFIG_TIMEOUT_QUEUE_PERCPU */
 		} else {
 			ret = -EINVAL;
 		}
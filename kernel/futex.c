@@ -27,8 +27,7 @@ static struct z_futex_data *k_futex_find_data(struct k_futex *futex)
 int z_impl_k_futex_wake(struct k_futex *futex, bool wake_all)
 {
 	k_spinlock_key_t key;
-	unsigned int woken = 0U;
-	struct k_thread *thread;
+	unsigned int woken;
 	struct z_futex_data *futex_data;
 
 	futex_data = k_futex_find_data(futex);
@@ -38,14 +37,8 @@ int z_impl_k_futex_wake(struct k_futex *futex, bool wake_all)
 
 	key = k_spin_lock(&futex_data->lock);
 
-	do {
-		thread = z_unpend_first_thread(&futex_data->wait_q);
-		if (thread != NULL) {
-			woken++;
-			arch_thread_return_value_set(thread, 0);
-			z_ready_thread(thread);
-		}
-	} while (thread && wake_all);
+	woken = z_sched_wake_n(&futex_data->wait_q, wake_all ? UINT_MAX : 1U,
+			       0, NULL);
 
 	z_reschedule(&futex_data->lock, key);
 
@@ -278,6 +278,23 @@ int z_kernel_stats_raw(struct k_obj_core *obj_core, void *stats);
 int z_kernel_stats_query(struct k_obj_core *obj_core, void *stats);
 #endif /* CONFIG_OBJ_CORE_STATS_SYSTEM */
 
+#ifdef CONFIG_CONDVAR_REQUEUE
+/**
+ * Move the threads pending on a wait queue onto a locked mutex.
+ *
+ * The threads are requeued with z_sched_requeue() and will be handed the
+ * mutex one at a time by k_mutex_unlock(), as if they had blocked in
+ * k_mutex_lock().  Nothing is moved if the mutex is not locked.
+ *
+ * @param mutex Mutex to requeue the threads onto
+ * @param wait_q Wait queue to take the threads from
+ * @param swap_data Swap data to give each moved thread
+ * @return Number of threads moved
+ */
+unsigned int z_mutex_requeue(struct k_mutex *mutex, _wait_q_t *wait_q,
+			     void *swap_data);
+#endif /* CONFIG_CONDVAR_REQUEUE */
+
 #if defined(CONFIG_THREAD_ABORT_NEED_CLEANUP)
 /**
  * Perform cleanup at the end of k_thread_abort().
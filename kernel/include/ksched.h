@@ -13,6 +13,7 @@
 #include <kthread.h>
 #include <zephyr/tracing/tracing.h>
 #include <stdbool.h>
+#include <limits.h>
 #include <priority_q.h>
 
 BUILD_ASSERT(K_LOWEST_APPLICATION_THREAD_PRIO
@@ -227,6 +228,53 @@ static ALWAYS_INLINE struct k_thread *z_unpend_first_thread(_wait_q_t *wait_q)
  */
 bool z_sched_wake(_wait_q_t *wait_q, int swap_retval, void *swap_data);
 
+/**
+ * Wake up several threads pending on the provided wait queue
+ *
+ * Like repeated calls to z_sched_wake(), waking up to @p max_threads threads
+ * in priority order, but holding _sched_spinlock once for the whole batch and
+ * updating the scheduler cache and flagging IPIs once at the end, so every
+ * CPU that needs one gets a single IPI at the next reschedule point.
+ *
+ * @param wait_q Wait queue to wake threads from
+ * @param max_threads Maximum number of threads to wake
+ * @param swap_retval Swap return value for woken threads
+ * @param swap_data Data return value to supplement swap_retval. May be NULL.
+ * @return Number of threads woken up
+ */
+unsigned int z_sched_wake_n(_wait_q_t *wait_q, unsigned int max_threads,
+			    int swap_retval, void *swap_data);
+
+/**
+ * Move threads pending on one wait queue to another
+ *
+ * Moves up to @p max_threads threads, in priority order, from @p from to
+ * @p to without waking them, in the manner of a futex requeue.  The threads
+ * keep their timeouts.  The swap data of each moved thread is set to
+ * @p swap_data, which lets it tell when it is eventually woken that it was
+ * requeued.  The caller must hold whatever locks protect both wait queues.
+ *
+ * @param from Wait queue to take threads from
+ * @param to Wait queue to pend the threads on
+ * @param max_threads Maximum number of threads to move
+ * @param swap_data Swap data to give each moved thread
+ * @return Number of threads moved
+ */
+unsigned int z_sched_requeue(_wait_q_t *from, _wait_q_t *to,
+			     unsigned int max_threads, void *swap_data);
+
+#ifdef CONFIG_EVENTS
+/**
+ * Wake a list of threads built by k_event_post()
+ *
+ * Equivalent to z_sched_wake_thread() on every thread of a list linked
+ * through next_event_link, with a single _sched_spinlock acquisition.
+ *
+ * @param head First thread of the list
+ */
+void z_sched_wake_event_list(struct k_thread *head);
+#endif /* CONFIG_EVENTS */
+
 /**
  * Wakes the specified thread.
  *
@@ -242,8 +290,8 @@ void z_sched_wake_thread(struct k_thread *thread, bool is_timeout);
 /**
  * Wake up all threads pending on the provided wait queue
  *
- * Convenience function to invoke z_sched_wake() on all threads in the queue
- * until there are no more to wake up.
+ * Convenience function to invoke z_sched_wake_n() on all threads in the
+ * queue.
  *
  * @param wait_q Wait queue to wake up the highest prio thread
  * @param swap_retval Swap return value for woken thread
@@ -254,14 +302,8 @@ void z_sched_wake_thread(struct k_thread *thread, bool is_timeout);
 static inline bool z_sched_wake_all(_wait_q_t *wait_q, int swap_retval,
 				    void *swap_data)
 {
-	bool woken = false;
-
-	while (z_sched_wake(wait_q, swap_retval, swap_data)) {
-		woken = true;
-	}
-
 	/* True if we woke at least one thread up */
-	return woken;
+	return z_sched_wake_n(wait_q, UINT_MAX, swap_retval, swap_data) != 0U;
 }
 
 /**
@@ -340,6 +382,21 @@ void z_sched_cpu_usage(uint8_t core_id, struct k_thread_runtime_stats *stats);
 void z_sched_thread_usage(struct k_thread *thread,
 			  struct k_thread_runtime_stats *stats);
 
+#ifdef CONFIG_SCHED_THREAD_USAGE_LATENCY
+/**
+ * @brief Timestamp a thread that was just made ready
+ *
+ * The latency until z_sched_usage_start() is called for the thread is
+ * recorded in the thread and CPU latency histograms.
+ */
+void z_sched_usage_ready(struct k_thread *thread);
+#else
+static inline void z_sched_usage_ready(struct k_thread *thread)
+{
+	ARG_UNUSED(thread);
+}
+#endif /* CONFIG_SCHED_THREAD_USAGE_LATENCY */
+
 static inline void z_sched_usage_switch(struct k_thread *thread)
 {
 	ARG_UNUSED(thread);
@@ -134,6 +134,13 @@ static ALWAYS_INLINE struct k_thread *z_priq_rb_best(struct _priq_rb *pq)
 	return thread;
 }
 
+#ifdef CONFIG_SCHED_DEADLINE
+static ALWAYS_INLINE struct k_thread *z_priq_mq_dlist_thread(sys_dnode_t *n)
+{
+	return CONTAINER_OF(n, struct k_thread, base.qnode_dlist);
+}
+#endif /* CONFIG_SCHED_DEADLINE */
+
 static ALWAYS_INLINE struct k_thread *z_priq_mq_best(struct _priq_mq *pq)
 {
 	struct k_thread *thread = NULL;
@@ -144,16 +151,35 @@ static ALWAYS_INLINE struct k_thread *z_priq_mq_best(struct _priq_mq *pq)
 		}
 
 #ifdef CONFIG_64BIT
-		sys_dlist_t *l = &pq->queues[i * 64 + u64_count_trailing_zeros(pq->bitmask[i])];
+		unsigned int offset_prio = i * 64 + u64_count_trailing_zeros(pq->bitmask[i]);
 #else
-		sys_dlist_t *l = &pq->queues[i * 32 + u32_count_trailing_zeros(pq->bitmask[i])];
+		unsigned int offset_prio = i * 32 + u32_count_trailing_zeros(pq->bitmask[i]);
 #endif
+#ifdef CONFIG_SCHED_DEADLINE
+		/* The first thread with a deadline against the list head,
+		 * ordered as z_sched_prio_cmp() does: a thread that never
+		 * had a deadline set counts as deadline 0.
+		 */
+		struct rbnode *r = pq->dl_first[offset_prio];
+		sys_dnode_t *n = sys_dlist_peek_head(&pq->queues[offset_prio]);
+		struct k_thread *head = (n != NULL) ? z_priq_mq_dlist_thread(n) : NULL;
+
+		if ((r != NULL) &&
+		    ((head == NULL) || z_priq_rb_lessthan(r, &head->base.qnode_rb))) {
+			thread = CONTAINER_OF(r, struct k_thread, base.qnode_rb);
+		} else {
+			thread = head;
+		}
+		break;
+#else
+		sys_dlist_t *l = &pq->queues[offset_prio];
 		sys_dnode_t *n = sys_dlist_peek_head(l);
 
 		if (n != NULL) {
 			thread = CONTAINER_OF(n, struct k_thread, base.qnode_dlist);
 			break;
 		}
+#endif /* CONFIG_SCHED_DEADLINE */
 	}
 
 	return thread;
@@ -183,14 +209,81 @@ static ALWAYS_INLINE void z_priq_mq_init(struct _priq_mq *q)
 {
 	for (int i = 0; i < ARRAY_SIZE(q->queues); i++) {
 		sys_dlist_init(&q->queues[i]);
+#ifdef CONFIG_SCHED_DEADLINE
+		q->dl_trees[i] = (struct rbtree) {
+			.lessthan_fn = z_priq_rb_lessthan,
+		};
+		q->dl_first[i] = NULL;
+#endif /* CONFIG_SCHED_DEADLINE */
+	}
+}
+
+#ifdef CONFIG_SCHED_DEADLINE
+/* Order keys keep threads that compare equal FIFO, whether they sit in
+ * the list or in the deadline tree of their priority.
+ */
+static ALWAYS_INLINE void z_priq_mq_order_key(struct _priq_mq *pq, struct k_thread *thread)
+{
+	thread->base.order_key = pq->next_order_key;
+	++pq->next_order_key;
+
+	/* Renumber at wraparound, as z_priq_rb_add() does, merging each
+	 * list with its tree so that their relative order is kept.
+	 */
+	if (!pq->next_order_key) {
+		for (int i = 0; i < ARRAY_SIZE(pq->queues); i++) {
+			sys_dnode_t *n = sys_dlist_peek_head(&pq->queues[i]);
+			struct k_thread *t;
+
+			RB_FOR_EACH_CONTAINER(&pq->dl_trees[i], t, base.qnode_rb) {
+				while ((n != NULL) &&
+				       z_priq_rb_lessthan(&z_priq_mq_dlist_thread(n)->base.qnode_rb,
+							  &t->base.qnode_rb)) {
+					z_priq_mq_dlist_thread(n)->base.order_key =
+						pq->next_order_key;
+					++pq->next_order_key;
+					n = sys_dlist_peek_next(&pq->queues[i], n);
+				}
+				t->base.order_key = pq->next_order_key;
+				++pq->next_order_key;
+			}
+
+			for (; n != NULL; n = sys_dlist_peek_next(&pq->queues[i], n)) {
+				z_priq_mq_dlist_thread(n)->base.order_key = pq->next_order_key;
+				++pq->next_order_key;
+			}
+		}
 	}
 }
 
+static ALWAYS_INLINE void z_priq_mq_dl_add(struct _priq_mq *pq, uint8_t offset_prio,
+					   struct k_thread *thread)
+{
+	struct rbnode *first = pq->dl_first[offset_prio];
+
+	rb_insert(&pq->dl_trees[offset_prio], &thread->base.qnode_rb);
+
+	if ((first == NULL) || z_priq_rb_lessthan(&thread->base.qnode_rb, first)) {
+		pq->dl_first[offset_prio] = &thread->base.qnode_rb;
+	}
+}
+#endif /* CONFIG_SCHED_DEADLINE */
+
 static ALWAYS_INLINE void z_priq_mq_add(struct _priq_mq *pq,
 					struct k_thread *thread)
 {
 	struct prio_info pos = get_prio_info(thread->base.prio);
 
+#ifdef CONFIG_SCHED_DEADLINE
+	z_priq_mq_order_key(pq, thread);
+
+	if (thread->base.has_deadline != 0U) {
+		z_priq_mq_dl_add(pq, pos.offset_prio, thread);
+		pq->bitmask[pos.idx] |= BIT(pos.bit);
+		return;
+	}
+#endif /* CONFIG_SCHED_DEADLINE */
+
 	sys_dlist_append(&pq->queues[pos.offset_prio], &thread->base.qnode_dlist);
 	pq->bitmask[pos.idx] |= BIT(pos.bit);
 }
@@ -200,10 +293,27 @@ static ALWAYS_INLINE void z_priq_mq_remove(struct _priq_mq *pq,
 {
 	struct prio_info pos = get_prio_info(thread->base.prio);
 
+#ifdef CONFIG_SCHED_DEADLINE
+	if (thread->base.has_deadline != 0U) {
+		rb_remove(&pq->dl_trees[pos.offset_prio], &thread->base.qnode_rb);
+		if (pq->dl_first[pos.offset_prio] == &thread->base.qnode_rb) {
+			pq->dl_first[pos.offset_prio] =
+				rb_get_min(&pq->dl_trees[pos.offset_prio]);
+		}
+	} else {
+		sys_dlist_remove(&thread->base.qnode_dlist);
+	}
+
+	if (sys_dlist_is_empty(&pq->queues[pos.offset_prio]) &&
+	    (pq->dl_trees[pos.offset_prio].root == NULL)) {
+		pq->bitmask[pos.idx] &= ~BIT(pos.bit);
+	}
+#else
 	sys_dlist_remove(&thread->base.qnode_dlist);
 	if (sys_dlist_is_empty(&pq->queues[pos.offset_prio])) {
 		pq->bitmask[pos.idx] &= ~BIT(pos.bit);
 	}
+#endif /* CONFIG_SCHED_DEADLINE */
 }
 #endif /* CONFIG_SCHED_MULTIQ */
 
@@ -25,6 +25,10 @@ extern "C" {
 static inline void z_init_timeout(struct _timeout *to)
 {
 	sys_dnode_init(&to->node);
+#ifdef CONFIG_TIMEOUT_QUEUE_PERCPU
+	/* Aborting a timeout never added still looks into its queue */
+	to->cpu = 0;
+#endif /* CONFIG_TIMEOUT_QUEUE_PERCPU */
 }
 
 void z_add_timeout(struct _timeout *to, _timeout_func_t fn,
@@ -58,6 +62,16 @@ int32_t z_get_next_timeout_expiry(void);
 
 k_ticks_t z_timeout_remaining(const struct _timeout *timeout);
 
+#ifdef CONFIG_TIMEOUT_QUEUE_PERCPU
+/* Expire the local CPU's timeouts if another CPU flagged them as due */
+void z_timeout_ipi(void);
+
+/* Move a timeout onto the queue of a CPU in cpu_mask, if it is not
+ * already on one.
+ */
+void z_timeout_migrate(struct _timeout *to, uint32_t cpu_mask);
+#endif /* CONFIG_TIMEOUT_QUEUE_PERCPU */
+
 #else
 
 /* Stubs when !CONFIG_SYS_CLOCK_EXISTS */
@@ -7,6 +7,7 @@
 #include <kswap.h>
 #include <ksched.h>
 #include <ipi.h>
+#include <timeout_q.h>
 
 #ifdef CONFIG_TRACE_SCHED_IPI
 extern void z_trace_sched_ipi(void);
@@ -100,6 +101,10 @@ void z_sched_ipi(void)
 	z_trace_sched_ipi();
 #endif /* CONFIG_TRACE_SCHED_IPI */
 
+#ifdef CONFIG_TIMEOUT_QUEUE_PERCPU
+	z_timeout_ipi();
+#endif /* CONFIG_TIMEOUT_QUEUE_PERCPU */
+
 #ifdef CONFIG_TIMESLICING
 	if (thread_is_sliceable(arch_current_thread())) {
 		z_time_slice();
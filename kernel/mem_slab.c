@@ -48,14 +48,18 @@ static int k_mem_slab_stats_query(struct k_obj_core *obj_core, void *stats)
 
 	slab = CONTAINER_OF(obj_core, struct k_mem_slab, obj_core);
 	key = k_spin_lock(&slab->lock);
-	ptr->free_bytes = (slab->info.num_blocks - slab->info.num_used) *
-			  slab->info.block_size;
-	ptr->allocated_bytes = slab->info.num_used * slab->info.block_size;
+	ptr->free_bytes = k_mem_slab_num_free_get(slab) * slab->info.block_size;
+	ptr->allocated_bytes = k_mem_slab_num_used_get(slab) *
+			       slab->info.block_size;
 #ifdef CONFIG_MEM_SLAB_TRACE_MAX_UTILIZATION
 	ptr->max_allocated_bytes = slab->info.max_used * slab->info.block_size;
 #else
 	ptr->max_allocated_bytes = 0;
 #endif /* CONFIG_MEM_SLAB_TRACE_MAX_UTILIZATION */
+#ifdef CONFIG_MEM_SLAB_PERCPU_CACHE
+	ptr->cache_refills = slab->info.cache_refills;
+	ptr->cache_flushes = slab->info.cache_flushes;
+#endif /* CONFIG_MEM_SLAB_PERCPU_CACHE */
 	k_spin_unlock(&slab->lock, key);
 
 	return 0;
@@ -72,7 +76,7 @@ static int k_mem_slab_stats_reset(struct k_obj_core *obj_core)
 	key = k_spin_lock(&slab->lock);
 
 #ifdef CONFIG_MEM_SLAB_TRACE_MAX_UTILIZATION
-	slab->info.max_used = slab->info.num_used;
+	slab->info.max_used = k_mem_slab_num_used_get(slab);
 #endif /* CONFIG_MEM_SLAB_TRACE_MAX_UTILIZATION */
 
 	k_spin_unlock(&slab->lock, key);
@@ -178,6 +182,12 @@ int k_mem_slab_init(struct k_mem_slab *slab, void *buffer,
 	slab->buffer = buffer;
 	slab->info.num_used = 0U;
 	slab->lock = (struct k_spinlock) {};
+#ifdef CONFIG_MEM_SLAB_PERCPU_CACHE
+#ifdef CONFIG_MEM_SLAB_TRACE_MAX_UTILIZATION
+	atomic_clear(&slab->in_use);
+#endif /* CONFIG_MEM_SLAB_TRACE_MAX_UTILIZATION */
+	memset(slab->cache, 0, sizeof(slab->cache));
+#endif /* CONFIG_MEM_SLAB_PERCPU_CACHE */
 
 #ifdef CONFIG_MEM_SLAB_TRACE_MAX_UTILIZATION
 	slab->info.max_used = 0U;
@@ -214,7 +224,7 @@ static bool slab_ptr_is_good(struct k_mem_slab *slab, const void *ptr)
 	       ((offset % slab->info.block_size) == 0);
 }
 
-int k_mem_slab_alloc(struct k_mem_slab *slab, void **mem, k_timeout_t timeout)
+static int mem_slab_alloc(struct k_mem_slab *slab, void **mem, k_timeout_t timeout)
 {
 	k_spinlock_key_t key = k_spin_lock(&slab->lock);
 	int result;
@@ -231,7 +241,8 @@ int k_mem_slab_alloc(struct k_mem_slab *slab, void **mem, k_timeout_t timeout)
 			 slab_ptr_is_good(slab, slab->free_list),
 			 "slab corruption detected");
 
-#ifdef CONFIG_MEM_SLAB_TRACE_MAX_UTILIZATION
+#if defined(CONFIG_MEM_SLAB_TRACE_MAX_UTILIZATION) && \
+	!defined(CONFIG_MEM_SLAB_PERCPU_CACHE)
 		slab->info.max_used = MAX(slab->info.num_used,
 					  slab->info.max_used);
 #endif /* CONFIG_MEM_SLAB_TRACE_MAX_UTILIZATION */
@@ -263,14 +274,8 @@ int k_mem_slab_alloc(struct k_mem_slab *slab, void **mem, k_timeout_t timeout)
 	return result;
 }
 
-void k_mem_slab_free(struct k_mem_slab *slab, void *mem)
+static void mem_slab_free(struct k_mem_slab *slab, void *mem)
 {
-	if (!slab_ptr_is_good(slab, mem)) {
-		__ASSERT(false, "Invalid memory pointer provided");
-		k_panic();
-		return;
-	}
-
 	k_spinlock_key_t key = k_spin_lock(&slab->lock);
 
 	SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_mem_slab, free, slab);
@@ -295,6 +300,265 @@ void k_mem_slab_free(struct k_mem_slab *slab, void *mem)
 	k_spin_unlock(&slab->lock, key);
 }
 
+#ifdef CONFIG_MEM_SLAB_PERCPU_CACHE
+
+#define CACHE_SIZE  CONFIG_MEM_SLAB_PERCPU_CACHE_SIZE
+#define CACHE_BATCH MAX(1, CACHE_SIZE / 2)
+
+static inline struct k_mem_slab_cache *local_cache(struct k_mem_slab *slab)
+{
+	/* Every cache has its own lock, so a stale CPU id after a
+	 * migration only costs a remote cache line, not correctness.
+	 */
+	return &slab->cache[arch_curr_cpu()->id];
+}
+
+#ifdef CONFIG_MEM_SLAB_TRACE_MAX_UTILIZATION
+/* num_used also counts the cached blocks, so the blocks held by users
+ * are counted separately to trace the maximum utilization.
+ */
+static void trace_alloc(struct k_mem_slab *slab)
+{
+	uint32_t used = (uint32_t)atomic_inc(&slab->in_use) + 1U;
+
+	if (used > slab->info.max_used) {
+		K_SPINLOCK(&slab->lock) {
+			slab->info.max_used = MAX(used, slab->info.max_used);
+		}
+	}
+}
+
+static void trace_free(struct k_mem_slab *slab)
+{
+	(void)atomic_dec(&slab->in_use);
+}
+#else
+static inline void trace_alloc(struct k_mem_slab *slab)
+{
+	ARG_UNUSED(slab);
+}
+
+static inline void trace_free(struct k_mem_slab *slab)
+{
+	ARG_UNUSED(slab);
+}
+#endif /* CONFIG_MEM_SLAB_TRACE_MAX_UTILIZATION */
+
+/* Move a batch of blocks from the shared free list into the cache */
+static void cache_refill(struct k_mem_slab *slab, struct k_mem_slab_cache *cache)
+{
+	k_spinlock_key_t key = k_spin_lock(&slab->lock);
+
+	while ((cache->count < CACHE_BATCH) && (slab->free_list != NULL)) {
+		cache->blocks[cache->count++] = slab->free_list;
+		slab->free_list = *(char **)(slab->free_list);
+		slab->info.num_used++;
+	}
+
+	slab->info.cache_refills++;
+
+	k_spin_unlock(&slab->lock, key);
+}
+
+static bool cache_alloc(struct k_mem_slab *slab, void **mem)
+{
+	struct k_mem_slab_cache *cache = local_cache(slab);
+	k_spinlock_key_t key = k_spin_lock(&cache->lock);
+	bool ret = false;
+
+	/* No refill while an allocation may pend: the blocks would sit
+	 * here instead of going to the pending thread.
+	 */
+	if ((cache->count == 0U) && (cache->bypass == 0U)) {
+		cache_refill(slab, cache);
+	}
+
+	if (cache->count != 0U) {
+		*mem = cache->blocks[--cache->count];
+		ret = true;
+	}
+
+	k_spin_unlock(&cache->lock, key);
+
+	return ret;
+}
+
+/* Take the @a n oldest blocks out of the cache, chained through their
+ * first word like the shared free list.
+ */
+static char *cache_take(struct k_mem_slab_cache *cache, uint32_t n)
+{
+	char *chain = NULL;
+
+	for (uint32_t i = n; i > 0U; i--) {
+		*(char **)cache->blocks[i - 1U] = chain;
+		chain = cache->blocks[i - 1U];
+	}
+
+	cache->count -= n;
+	memmove(cache->blocks, &cache->blocks[n], cache->count * sizeof(char *));
+
+	return chain;
+}
+
+/* Hand a chain of blocks taken out of a cache back to the shared list,
+ * or to the threads pending on the slab.  Cached blocks are still
+ * counted in num_used.
+ */
+static void cache_spill(struct k_mem_slab *slab, char *chain)
+{
+	k_spinlock_key_t key;
+	bool resched = false;
+
+	if (chain == NULL) {
+		return;
+	}
+
+	key = k_spin_lock(&slab->lock);
+	slab->info.cache_flushes++;
+
+	while (chain != NULL) {
+		char *mem = chain;
+		struct k_thread *pending_thread = NULL;
+
+		chain = *(char **)chain;
+
+		if ((slab->free_list == NULL) && IS_ENABLED(CONFIG_MULTITHREADING)) {
+			pending_thread = z_unpend_first_thread(&slab->wait_q);
+		}
+
+		if (pending_thread != NULL) {
+			z_thread_return_value_set_with_data(pending_thread, 0, mem);
+			z_ready_thread(pending_thread);
+			resched = true;
+		} else {
+			*(char **)mem = slab->free_list;
+			slab->free_list = mem;
+			slab->info.num_used--;
+		}
+	}
+
+	if (resched) {
+		z_reschedule(&slab->lock, key);
+	} else {
+		k_spin_unlock(&slab->lock, key);
+	}
+}
+
+static void cache_free(struct k_mem_slab *slab, void *mem)
+{
+	struct k_mem_slab_cache *cache = local_cache(slab);
+	char *chain = NULL;
+	k_spinlock_key_t key = k_spin_lock(&cache->lock);
+
+	if (cache->bypass != 0U) {
+		/* An allocation may be pending: the block goes through
+		 * the shared path, which wakes it up.
+		 */
+		*(char **)mem = cache_take(cache, cache->count);
+		chain = mem;
+	} else {
+		if (cache->count == CACHE_SIZE) {
+			/* Full: give the oldest blocks back to the shared list */
+			chain = cache_take(cache, CACHE_BATCH);
+		}
+
+		cache->blocks[cache->count++] = mem;
+	}
+
+	k_spin_unlock(&cache->lock, key);
+
+	cache_spill(slab, chain);
+}
+
+/* Return the blocks held in every CPU cache to the shared list, and
+ * make the frees on every CPU skip its cache until cache_bypass_end().
+ * A free either lands in a cache before it is drained here, or sees
+ * the bypass, so no block is left cached while an allocation pends.
+ */
+static void cache_flush_all(struct k_mem_slab *slab)
+{
+	for (unsigned int i = 0; i < arch_num_cpus(); i++) {
+		struct k_mem_slab_cache *cache = &slab->cache[i];
+		char *chain = NULL;
+
+		K_SPINLOCK(&cache->lock) {
+			cache->bypass++;
+			chain = cache_take(cache, cache->count);
+		}
+
+		cache_spill(slab, chain);
+	}
+}
+
+static void cache_bypass_end(struct k_mem_slab *slab)
+{
+	for (unsigned int i = 0; i < arch_num_cpus(); i++) {
+		struct k_mem_slab_cache *cache = &slab->cache[i];
+
+		K_SPINLOCK(&cache->lock) {
+			cache->bypass--;
+		}
+	}
+}
+
+int k_mem_slab_alloc(struct k_mem_slab *slab, void **mem, k_timeout_t timeout)
+{
+	int result;
+
+	if (cache_alloc(slab, mem)) {
+		SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_mem_slab, alloc, slab, timeout);
+		SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_mem_slab, alloc, slab, timeout, 0);
+		trace_alloc(slab);
+		return 0;
+	}
+
+	/* The shared list ran dry: reclaim what the other CPUs hold and
+	 * stop them from caching frees while we may be pending.
+	 */
+	cache_flush_all(slab);
+	result = mem_slab_alloc(slab, mem, timeout);
+	cache_bypass_end(slab);
+
+	if (result == 0) {
+		trace_alloc(slab);
+	}
+
+	return result;
+}
+
+void k_mem_slab_free(struct k_mem_slab *slab, void *mem)
+{
+	if (!slab_ptr_is_good(slab, mem)) {
+		__ASSERT(false, "Invalid memory pointer provided");
+		k_panic();
+		return;
+	}
+
+	trace_free(slab);
+	cache_free(slab, mem);
+}
+
+#else
+
+int k_mem_slab_alloc(struct k_mem_slab *slab, void **mem, k_timeout_t timeout)
+{
+	return mem_slab_alloc(slab, mem, timeout);
+}
+
+void k_mem_slab_free(struct k_mem_slab *slab, void *mem)
+{
+	if (!slab_ptr_is_good(slab, mem)) {
+		__ASSERT(false, "Invalid memory pointer provided");
+		k_panic();
+		return;
+	}
+
+	mem_slab_free(slab, mem);
+}
+
+#endif /* CONFIG_MEM_SLAB_PERCPU_CACHE */
+
 int k_mem_slab_runtime_stats_get(struct k_mem_slab *slab, struct sys_memory_stats *stats)
 {
 	if ((slab == NULL) || (stats == NULL)) {
@@ -303,15 +567,20 @@ int k_mem_slab_runtime_stats_get(struct k_mem_slab *slab, struct sys_memory_stat
 
 	k_spinlock_key_t key = k_spin_lock(&slab->lock);
 
-	stats->allocated_bytes = slab->info.num_used * slab->info.block_size;
-	stats->free_bytes = (slab->info.num_blocks - slab->info.num_used) *
-			    slab->info.block_size;
+	/* Blocks sitting in the per-CPU caches count as free */
+	stats->allocated_bytes = k_mem_slab_num_used_get(slab) *
+				 slab->info.block_size;
+	stats->free_bytes = k_mem_slab_num_free_get(slab) * slab->info.block_size;
 #ifdef CONFIG_MEM_SLAB_TRACE_MAX_UTILIZATION
 	stats->max_allocated_bytes = slab->info.max_used *
 				     slab->info.block_size;
 #else
 	stats->max_allocated_bytes = 0;
 #endif /* CONFIG_MEM_SLAB_TRACE_MAX_UTILIZATION */
+#ifdef CONFIG_MEM_SLAB_PERCPU_CACHE
+	stats->cache_refills = slab->info.cache_refills;
+	stats->cache_flushes = slab->info.cache_flushes;
+#endif /* CONFIG_MEM_SLAB_PERCPU_CACHE */
 
 	k_spin_unlock(&slab->lock, key);
 
@@ -327,7 +596,7 @@ int k_mem_slab_runtime_stats_reset_max(struct k_mem_slab *slab)
 
 	k_spinlock_key_t key = k_spin_lock(&slab->lock);
 
-	slab->info.max_used = slab->info.num_used;
+	slab->info.max_used = k_mem_slab_num_used_get(slab);
 
 	k_spin_unlock(&slab->lock, key);
 
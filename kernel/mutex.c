@@ -208,6 +208,38 @@ static inline int z_vrfy_k_mutex_lock(struct k_mutex *mutex,
 #include <zephyr/syscalls/k_mutex_lock_mrsh.c>
 #endif /* CONFIG_USERSPACE */
 
+#ifdef CONFIG_CONDVAR_REQUEUE
+unsigned int z_mutex_requeue(struct k_mutex *mutex, _wait_q_t *wait_q,
+			     void *swap_data)
+{
+	unsigned int moved = 0U;
+	k_spinlock_key_t key = k_spin_lock(&lock);
+
+	/* Threads moved onto a free mutex would never be woken up. */
+	if (mutex->owner != NULL) {
+		moved = z_sched_requeue(wait_q, &mutex->wait_q, UINT_MAX,
+					swap_data);
+	}
+
+	if (moved != 0U) {
+		struct k_thread *waiter = z_waitq_head(&mutex->wait_q);
+		int32_t new_prio = new_prio_for_inheritance(waiter->base.prio,
+							    mutex->owner->base.prio);
+
+		/* As if the waiters had blocked in k_mutex_lock().  The boost
+		 * is dropped at the latest when the owner unlocks.
+		 */
+		if (z_is_prio_higher(new_prio, mutex->owner->base.prio)) {
+			(void)adjust_owner_prio(mutex, new_prio);
+		}
+	}
+
+	k_spin_unlock(&lock, key);
+
+	return moved;
+}
+#endif /* CONFIG_CONDVAR_REQUEUE */
+
 int z_impl_k_mutex_unlock(struct k_mutex *mutex)
 {
 	struct k_thread *new_owner;
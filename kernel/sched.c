@@ -370,7 +370,14 @@ static struct _cpu *thread_active_elsewhere(struct k_thread *thread)
 	return NULL;
 }
 
-static void ready_thread(struct k_thread *thread)
+/* Add a thread to the run queue without updating the scheduler cache or
+ * flagging IPIs, so that several threads can be readied under one lock
+ * acquisition.  The CPUs the thread may need to interrupt are accumulated
+ * in @p ipi_mask; callers finish the batch with ready_batch_done().
+ *
+ * @return true if the thread was added to the run queue.
+ */
+static bool ready_thread_batched(struct k_thread *thread, uint32_t *ipi_mask)
 {
 #ifdef CONFIG_KERNEL_COHERENCE
 	__ASSERT_NO_MSG(arch_mem_coherent(thread));
@@ -383,9 +390,31 @@ static void ready_thread(struct k_thread *thread)
 		SYS_PORT_TRACING_OBJ_FUNC(k_thread, sched_ready, thread);
 
 		queue_thread(thread);
-		update_cache(0);
+		z_sched_usage_ready(thread);
+#ifdef CONFIG_SMP
+		*ipi_mask |= (uint32_t)ipi_mask_create(thread);
+#else
+		ARG_UNUSED(ipi_mask);
+#endif /* CONFIG_SMP */
+
+		return true;
+	}
 
-		flag_ipi(ipi_mask_create(thread));
+	return false;
+}
+
+static void ready_batch_done(uint32_t ipi_mask)
+{
+	update_cache(0);
+	flag_ipi(ipi_mask);
+}
+
+static void ready_thread(struct k_thread *thread)
+{
+	uint32_t ipi_mask = 0U;
+
+	if (ready_thread_batched(thread, &ipi_mask)) {
+		ready_batch_done(ipi_mask);
 	}
 }
 
@@ -952,11 +981,22 @@ int z_unpend_all(_wait_q_t *wait_q)
 {
 	int need_sched = 0;
 	struct k_thread *thread;
+	uint32_t ipi_mask = 0U;
 
-	for (thread = z_waitq_head(wait_q); thread != NULL; thread = z_waitq_head(wait_q)) {
-		z_unpend_thread(thread);
-		z_ready_thread(thread);
-		need_sched = 1;
+	K_SPINLOCK(&_sched_spinlock) {
+		for (thread = _priq_wait_best(&wait_q->waitq); thread != NULL;
+		     thread = _priq_wait_best(&wait_q->waitq)) {
+			unpend_thread_no_timeout(thread);
+			(void)z_abort_thread_timeout(thread);
+			if (thread_active_elsewhere(thread) == NULL) {
+				(void)ready_thread_batched(thread, &ipi_mask);
+			}
+			need_sched = 1;
+		}
+
+		if (need_sched != 0) {
+			ready_batch_done(ipi_mask);
+		}
 	}
 
 	return need_sched;
@@ -1029,9 +1069,15 @@ void z_impl_k_thread_deadline_set(k_tid_t tid, int deadline)
 		if (z_is_thread_queued(thread)) {
 			dequeue_thread(thread);
 			thread->base.prio_deadline = newdl;
+#ifdef CONFIG_SCHED_MULTIQ
+			thread->base.has_deadline = 1U;
+#endif /* CONFIG_SCHED_MULTIQ */
 			queue_thread(thread);
 		} else {
 			thread->base.prio_deadline = newdl;
+#ifdef CONFIG_SCHED_MULTIQ
+			thread->base.has_deadline = 1U;
+#endif /* CONFIG_SCHED_MULTIQ */
 		}
 	}
 }
@@ -1498,6 +1544,98 @@ bool z_sched_wake(_wait_q_t *wait_q, int swap_retval, void *swap_data)
 	return ret;
 }
 
+unsigned int z_sched_wake_n(_wait_q_t *wait_q, unsigned int max_threads,
+			    int swap_retval, void *swap_data)
+{
+	struct k_thread *thread;
+	unsigned int woken = 0U;
+	uint32_t ipi_mask = 0U;
+
+	K_SPINLOCK(&_sched_spinlock) {
+		while (woken < max_threads) {
+			thread = _priq_wait_best(&wait_q->waitq);
+			if (thread == NULL) {
+				break;
+			}
+
+			z_thread_return_value_set_with_data(thread,
+							    swap_retval,
+							    swap_data);
+			unpend_thread_no_timeout(thread);
+			(void)z_abort_thread_timeout(thread);
+			(void)ready_thread_batched(thread, &ipi_mask);
+			woken++;
+		}
+
+		if (woken != 0U) {
+			ready_batch_done(ipi_mask);
+		}
+	}
+
+	return woken;
+}
+
+unsigned int z_sched_requeue(_wait_q_t *from, _wait_q_t *to,
+			     unsigned int max_threads, void *swap_data)
+{
+	struct k_thread *thread;
+	unsigned int moved = 0U;
+
+	K_SPINLOCK(&_sched_spinlock) {
+		while (moved < max_threads) {
+			thread = _priq_wait_best(&from->waitq);
+			if (thread == NULL) {
+				break;
+			}
+
+			/* The thread stays pending, with its timeout armed;
+			 * only the wait queue it is pended on changes.
+			 */
+			_priq_wait_remove(&from->waitq, thread);
+			thread->base.pended_on = to;
+			_priq_wait_add(&to->waitq, thread);
+			thread->base.swap_data = swap_data;
+			moved++;
+		}
+	}
+
+	return moved;
+}
+
+#ifdef CONFIG_EVENTS
+void z_sched_wake_event_list(struct k_thread *head)
+{
+	struct k_thread *thread;
+	struct k_thread *next;
+	uint32_t ipi_mask = 0U;
+	bool woken = false;
+
+	K_SPINLOCK(&_sched_spinlock) {
+		for (thread = head; thread != NULL; thread = next) {
+			next = thread->next_event_link;
+
+			/* As z_sched_wake_thread() for a non-timeout wake */
+			thread->no_wake_on_timeout = false;
+
+			if ((thread->base.thread_state &
+			     (_THREAD_DEAD | _THREAD_ABORTING)) != 0U) {
+				continue;
+			}
+
+			if (thread->base.pended_on != NULL) {
+				unpend_thread_no_timeout(thread);
+			}
+			z_mark_thread_as_not_suspended(thread);
+			woken = ready_thread_batched(thread, &ipi_mask) || woken;
+		}
+
+		if (woken) {
+			ready_batch_done(ipi_mask);
+		}
+	}
+}
+#endif /* CONFIG_EVENTS */
+
 int z_sched_wait(struct k_spinlock *lock, k_spinlock_key_t key,
 		 _wait_q_t *wait_q, k_timeout_t timeout, void **data)
 {
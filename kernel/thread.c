@@ -628,6 +628,9 @@ char *z_setup_new_thread(struct k_thread *new_thread,
 #endif /* CONFIG_USERSPACE */
 #ifdef CONFIG_SCHED_DEADLINE
 	new_thread->base.prio_deadline = 0;
+#ifdef CONFIG_SCHED_MULTIQ
+	new_thread->base.has_deadline = 0U;
+#endif /* CONFIG_SCHED_MULTIQ */
 #endif /* CONFIG_SCHED_DEADLINE */
 	new_thread->resource_pool = arch_current_thread()->resource_pool;
 
@@ -640,6 +643,9 @@ char *z_setup_new_thread(struct k_thread *new_thread,
 	new_thread->base.usage.track_usage =
 		CONFIG_SCHED_THREAD_USAGE_AUTO_ENABLE;
 #endif /* CONFIG_SCHED_THREAD_USAGE */
+#ifdef CONFIG_SCHED_THREAD_USAGE_LATENCY
+	new_thread->base.ready0 = 0U;
+#endif /* CONFIG_SCHED_THREAD_USAGE_LATENCY */
 
 	SYS_PORT_TRACING_OBJ_FUNC(k_thread, create, new_thread);
 
@@ -985,6 +991,12 @@ int k_thread_runtime_stats_all_get(k_thread_runtime_stats_t *stats)
 		stats->average_cycles   += tmp_stats.average_cycles;
 #endif /* CONFIG_SCHED_THREAD_USAGE_ANALYSIS */
 		stats->idle_cycles      += tmp_stats.idle_cycles;
+#ifdef CONFIG_SCHED_THREAD_USAGE_LATENCY
+		for (unsigned int j = 0; j < ARRAY_SIZE(stats->latency); j++) {
+			stats->latency[j] += tmp_stats.latency[j];
+		}
+		stats->latency_max = MAX(stats->latency_max, tmp_stats.latency_max);
+#endif /* CONFIG_SCHED_THREAD_USAGE_LATENCY */
 	}
 #endif /* CONFIG_SCHED_THREAD_USAGE_ALL */
 
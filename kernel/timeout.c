@@ -11,18 +11,8 @@
 #include <zephyr/internal/syscall_handler.h>
 #include <zephyr/drivers/timer/system_timer.h>
 #include <zephyr/sys_clock.h>
-
-static uint64_t curr_tick;
-
-static sys_dlist_t timeout_list = SYS_DLIST_STATIC_INIT(&timeout_list);
-
-static struct k_spinlock timeout_lock;
-
-#define MAX_WAIT (IS_ENABLED(CONFIG_SYSTEM_CLOCK_SLOPPY_IDLE) \
-		  ? K_TICKS_FOREVER : INT_MAX)
-
-/* Ticks left to process in the currently-executing sys_clock_announce() */
-static int announce_remaining;
+#include <zephyr/sys/math_extras.h>
+#include <ipi.h>
 
 #if defined(CONFIG_TIMER_READS_ITS_FREQUENCY_AT_RUNTIME)
 int z_clock_hw_cycles_per_sec = CONFIG_SYS_CLOCK_HW_CYCLES_PER_SEC;
@@ -36,34 +26,382 @@ static inline int z_vrfy_sys_clock_hw_cycles_per_sec_runtime_get(void)
 #endif /* CONFIG_USERSPACE */
 #endif /* CONFIG_TIMER_READS_ITS_FREQUENCY_AT_RUNTIME */
 
-static struct _timeout *first(void)
+
+#define MAX_WAIT (IS_ENABLED(CONFIG_SYSTEM_CLOCK_SLOPPY_IDLE) \
+		  ? K_TICKS_FOREVER : INT_MAX)
+
+#ifdef CONFIG_TIMEOUT_QUEUE_WHEEL
+#define WHEEL_BITS   6
+#define WHEEL_SLOTS  BIT(WHEEL_BITS)
+#define WHEEL_MASK   (WHEEL_SLOTS - 1)
+#define WHEEL_LEVELS CONFIG_TIMEOUT_QUEUE_WHEEL_LEVELS
+
+BUILD_ASSERT(WHEEL_BITS * WHEEL_LEVELS < 31);
+#endif /* CONFIG_TIMEOUT_QUEUE_WHEEL */
+
+struct timeout_q {
+	struct k_spinlock lock;
+
+	/* Tick the queued timeouts are relative to: the last tick
+	 * announced to this queue, or the tick of the timeout currently
+	 * firing while an announce is being processed.
+	 */
+	uint64_t tick;
+
+	/* Ticks left to process in the currently-executing announce */
+	int announce_remaining;
+
+#ifdef CONFIG_TIMEOUT_QUEUE_PERCPU
+	/* Set when another CPU saw expired timeouts on this queue */
+	atomic_t expire_pending;
+#endif /* CONFIG_TIMEOUT_QUEUE_PERCPU */
+
+#ifdef CONFIG_TIMEOUT_QUEUE_WHEEL
+	sys_dlist_t wheel[WHEEL_LEVELS][WHEEL_SLOTS];
+
+	/* Bit set if the slot may be non-empty.  Bits are set on
+	 * insertion but only cleared lazily when a scan finds the slot
+	 * empty, so that z_abort_timeout() does not need to know where
+	 * the timeout lives.
+	 */
+	uint64_t wheel_map[WHEEL_LEVELS];
+
+	bool wheel_ready;
+#else
+	sys_dlist_t list;
+#endif /* CONFIG_TIMEOUT_QUEUE_WHEEL */
+};
+
+#ifdef CONFIG_TIMEOUT_QUEUE_WHEEL
+#define TIMEOUT_Q_INIT(q) { }
+#else
+#define TIMEOUT_Q_INIT(q) { .list = SYS_DLIST_STATIC_INIT(&(q).list) }
+#endif /* CONFIG_TIMEOUT_QUEUE_WHEEL */
+
+#ifdef CONFIG_TIMEOUT_QUEUE_PERCPU
+
+#define TIMEOUT_Q_INIT_CPU(i, _) TIMEOUT_Q_INIT(timeout_queues[i])
+
+static struct timeout_q timeout_queues[CONFIG_MP_MAX_NUM_CPUS] = {
+	LISTIFY(CONFIG_MP_MAX_NUM_CPUS, TIMEOUT_Q_INIT_CPU, (,))
+};
+
+/* With per-CPU queues, timeout_lock only guards the global tick
+ * count and the programmed timer deadline.  Queue locks nest
+ * outside of it.
+ */
+static struct k_spinlock timeout_lock;
+
+static uint64_t curr_tick;
+
+/* Absolute tick the system timer is programmed for */
+static uint64_t next_deadline = UINT64_MAX;
+
+static inline struct timeout_q *queue_of(const struct _timeout *to)
+{
+	__ASSERT(to->cpu < CONFIG_MP_MAX_NUM_CPUS, "timeout %p on invalid CPU %u",
+		 to, to->cpu);
+
+	return &timeout_queues[to->cpu];
+}
+
+#else
+
+static struct timeout_q timeout_queue = TIMEOUT_Q_INIT(timeout_queue);
+
+static inline struct timeout_q *queue_of(const struct _timeout *to)
+{
+	ARG_UNUSED(to);
+
+	return &timeout_queue;
+}
+
+#endif /* CONFIG_TIMEOUT_QUEUE_PERCPU */
+
+static inline struct timeout_q *local_queue(void)
+{
+#ifdef CONFIG_TIMEOUT_QUEUE_PERCPU
+	/* Any queue is correct, the local one is just the cheapest, so
+	 * it does not matter if we migrate right after looking.
+	 */
+	return &timeout_queues[arch_curr_cpu()->id];
+#else
+	return &timeout_queue;
+#endif /* CONFIG_TIMEOUT_QUEUE_PERCPU */
+}
+
+#ifdef CONFIG_TIMEOUT_QUEUE_WHEEL
+
+/*
+ * Hierarchical timing wheel.  Each level has WHEEL_SLOTS slots of
+ * BIT(WHEEL_BITS * level) ticks each, indexed by the absolute
+ * expiry tick, so insertion and removal are O(1).  Timeouts beyond
+ * the horizon of the top level are parked in its last reachable slot
+ * and re-filed when that slot is reached.  A higher level slot is
+ * "cascaded" down into the lower levels when the queue tick enters
+ * its range, which costs at most WHEEL_LEVELS - 1 moves per timeout.
+ *
+ * The dticks field of a queued timeout holds its absolute expiry
+ * tick (truncated to the width of the field) rather than a delta.
+ */
+
+static inline unsigned int level_shift(int lvl)
+{
+	return WHEEL_BITS * lvl;
+}
+
+static uint64_t expiry_of(struct timeout_q *q, const struct _timeout *t)
+{
+	/* Relative timeouts never exceed INT32_MAX ticks, so the low
+	 * bits of the expiry are enough to recover the full value when
+	 * the field is only 32 bits wide.
+	 */
+#ifdef CONFIG_TIMEOUT_64BIT
+	ARG_UNUSED(q);
+
+	return (uint64_t)t->dticks;
+#else
+	return q->tick + (int32_t)((uint32_t)t->dticks - (uint32_t)q->tick);
+#endif /* CONFIG_TIMEOUT_64BIT */
+}
+
+static void wheel_file(struct timeout_q *q, struct _timeout *t, uint64_t expiry)
+{
+	uint64_t pos = expiry;
+	int lvl = 0;
+
+	/* Pick the lowest level at which the expiry lands within one
+	 * rotation of the queue tick.
+	 */
+	while ((lvl < (WHEEL_LEVELS - 1)) &&
+	       (((pos >> level_shift(lvl)) - (q->tick >> level_shift(lvl))) >= WHEEL_SLOTS)) {
+		lvl++;
+	}
+
+	if (((pos >> level_shift(lvl)) - (q->tick >> level_shift(lvl))) >= WHEEL_SLOTS) {
+		/* Beyond the horizon: park in the farthest slot */
+		pos = ((q->tick >> level_shift(lvl)) + WHEEL_MASK) << level_shift(lvl);
+	}
+
+	unsigned int idx = (pos >> level_shift(lvl)) & WHEEL_MASK;
+
+	sys_dlist_append(&q->wheel[lvl][idx], &t->node);
+	q->wheel_map[lvl] |= BIT64(idx);
+}
+
+/* Ticks from q->tick to the first expiry, INT64_MAX if none */
+static int64_t next_dticks(struct timeout_q *q)
+{
+	int64_t ret = INT64_MAX;
+
+	for (int lvl = 0; lvl < WHEEL_LEVELS; lvl++) {
+		uint64_t base = q->tick >> level_shift(lvl);
+		unsigned int cur = base & WHEEL_MASK;
+
+		while (q->wheel_map[lvl] != 0) {
+			uint64_t map = q->wheel_map[lvl];
+			uint64_t rot = (cur == 0U) ? map : ((map >> cur) | (map << (WHEEL_SLOTS - cur)));
+			unsigned int off = u64_count_trailing_zeros(rot);
+			unsigned int idx = (cur + off) & WHEEL_MASK;
+
+			if (sys_dlist_is_empty(&q->wheel[lvl][idx])) {
+				q->wheel_map[lvl] &= ~BIT64(idx);
+				continue;
+			}
+
+			/* Lower bound of the expiry of anything in the slot,
+			 * exact for level zero.
+			 */
+			int64_t dt = MAX((base + off) << level_shift(lvl), q->tick) - q->tick;
+
+			ret = MIN(ret, dt);
+			break;
+		}
+	}
+
+	return ret;
+}
+
+/* Returns true if the new timeout moved the first expiry earlier.  The
+ * first expiry of a higher level slot is the start of the slot, so it
+ * is compared rather than the exact expiry of the new timeout.
+ */
+static bool insert_timeout(struct timeout_q *q, struct _timeout *to)
+{
+	uint64_t expiry = q->tick + to->dticks;
+	int64_t prev;
+
+	if (!q->wheel_ready) {
+		for (int lvl = 0; lvl < WHEEL_LEVELS; lvl++) {
+			for (int i = 0; i < WHEEL_SLOTS; i++) {
+				sys_dlist_init(&q->wheel[lvl][i]);
+			}
+		}
+		q->wheel_ready = true;
+	}
+
+	prev = next_dticks(q);
+
+	to->dticks = expiry;
+	wheel_file(q, to, expiry);
+
+	return next_dticks(q) < prev;
+}
+
+static void remove_timeout(struct timeout_q *q, struct _timeout *t)
 {
-	sys_dnode_t *t = sys_dlist_peek_head(&timeout_list);
+	ARG_UNUSED(q);
+
+	sys_dlist_remove(&t->node);
+}
+
+/* must be locked */
+static k_ticks_t timeout_rem(struct timeout_q *q, const struct _timeout *timeout)
+{
+	return (k_ticks_t)(expiry_of(q, timeout) - q->tick);
+}
+
+/* Called with q->tick already moved forward by dt: re-files the
+ * contents of any higher level slot the queue tick has entered,
+ * then hands back one timeout expiring now, if any.
+ */
+static struct _timeout *expire_next(struct timeout_q *q, int64_t dt)
+{
+	ARG_UNUSED(dt);
+
+	for (int lvl = WHEEL_LEVELS - 1; lvl > 0; lvl--) {
+		unsigned int idx = (q->tick >> level_shift(lvl)) & WHEEL_MASK;
+		sys_dlist_t *slot = &q->wheel[lvl][idx];
+		sys_dnode_t *node;
+
+		if ((q->wheel_map[lvl] & BIT64(idx)) == 0U) {
+			continue;
+		}
+
+		q->wheel_map[lvl] &= ~BIT64(idx);
+		while ((node = sys_dlist_get(slot)) != NULL) {
+			struct _timeout *t = CONTAINER_OF(node, struct _timeout, node);
+
+			wheel_file(q, t, expiry_of(q, t));
+		}
+	}
+
+	unsigned int idx = q->tick & WHEEL_MASK;
+	sys_dnode_t *node = NULL;
+
+	if ((q->wheel_map[0] & BIT64(idx)) != 0U) {
+		node = sys_dlist_get(&q->wheel[0][idx]);
+	}
+
+	return (node == NULL) ? NULL : CONTAINER_OF(node, struct _timeout, node);
+}
+
+static void advance_timeouts(struct timeout_q *q, int64_t dt)
+{
+	/* Expiries are absolute, nothing to adjust */
+	ARG_UNUSED(q);
+	ARG_UNUSED(dt);
+}
+
+#else /* CONFIG_TIMEOUT_QUEUE_DLIST */
+
+static struct _timeout *first(struct timeout_q *q)
+{
+	sys_dnode_t *t = sys_dlist_peek_head(&q->list);
 
 	return (t == NULL) ? NULL : CONTAINER_OF(t, struct _timeout, node);
 }
 
-static struct _timeout *next(struct _timeout *t)
+static struct _timeout *next(struct timeout_q *q, struct _timeout *t)
 {
-	sys_dnode_t *n = sys_dlist_peek_next(&timeout_list, &t->node);
+	sys_dnode_t *n = sys_dlist_peek_next(&q->list, &t->node);
 
 	return (n == NULL) ? NULL : CONTAINER_OF(n, struct _timeout, node);
 }
 
-static void remove_timeout(struct _timeout *t)
+static void remove_timeout(struct timeout_q *q, struct _timeout *t)
 {
-	if (next(t) != NULL) {
-		next(t)->dticks += t->dticks;
+	if (next(q, t) != NULL) {
+		next(q, t)->dticks += t->dticks;
 	}
 
 	sys_dlist_remove(&t->node);
 }
 
-static int32_t elapsed(void)
+/* Ticks from q->tick to the first expiry, INT64_MAX if none */
+static int64_t next_dticks(struct timeout_q *q)
+{
+	struct _timeout *to = first(q);
+
+	return (to == NULL) ? INT64_MAX : to->dticks;
+}
+
+/* Returns true if the new timeout is the first to expire */
+static bool insert_timeout(struct timeout_q *q, struct _timeout *to)
+{
+	struct _timeout *t;
+
+	for (t = first(q); t != NULL; t = next(q, t)) {
+		if (t->dticks > to->dticks) {
+			t->dticks -= to->dticks;
+			sys_dlist_insert(&t->node, &to->node);
+			break;
+		}
+		to->dticks -= t->dticks;
+	}
+
+	if (t == NULL) {
+		sys_dlist_append(&q->list, &to->node);
+	}
+
+	return to == first(q);
+}
+
+/* must be locked */
+static k_ticks_t timeout_rem(struct timeout_q *q, const struct _timeout *timeout)
+{
+	k_ticks_t ticks = 0;
+
+	for (struct _timeout *t = first(q); t != NULL; t = next(q, t)) {
+		ticks += t->dticks;
+		if (timeout == t) {
+			break;
+		}
+	}
+
+	return ticks;
+}
+
+/* Called with q->tick already moved forward by dt, which is the
+ * delta of the head of the list: unlinks and returns the head.
+ */
+static struct _timeout *expire_next(struct timeout_q *q, int64_t dt)
+{
+	struct _timeout *t = first(q);
+
+	__ASSERT_NO_MSG(t->dticks == dt);
+	t->dticks = 0;
+	remove_timeout(q, t);
+
+	return t;
+}
+
+static void advance_timeouts(struct timeout_q *q, int64_t dt)
+{
+	struct _timeout *t = first(q);
+
+	if (t != NULL) {
+		t->dticks -= dt;
+	}
+}
+
+#endif /* CONFIG_TIMEOUT_QUEUE_WHEEL */
+
+static int32_t elapsed(struct timeout_q *q)
 {
 	/* While sys_clock_announce() is executing, new relative timeouts will be
 	 * scheduled relatively to the currently firing timeout's original tick
-	 * value (=curr_tick) rather than relative to the current
+	 * value (=q->tick) rather than relative to the current
 	 * sys_clock_elapsed().
 	 *
 	 * This means that timeouts being scheduled from within timeout callbacks
@@ -77,25 +415,170 @@ static int32_t elapsed(void)
 	 * will be non-zero while sys_clock_announce() is executing and zero
 	 * otherwise.
 	 */
-	return announce_remaining == 0 ? sys_clock_elapsed() : 0U;
+	if (q->announce_remaining != 0) {
+		return 0;
+	}
+
+#ifdef CONFIG_TIMEOUT_QUEUE_PERCPU
+	int32_t ret = 0;
+
+	/* The queue may not have caught up with the latest announce yet */
+	K_SPINLOCK(&timeout_lock) {
+		ret = (int32_t)(curr_tick - q->tick) + sys_clock_elapsed();
+	}
+
+	return ret;
+#else
+	return sys_clock_elapsed();
+#endif /* CONFIG_TIMEOUT_QUEUE_PERCPU */
 }
 
-static int32_t next_timeout(void)
+static int32_t next_timeout(struct timeout_q *q)
 {
-	struct _timeout *to = first();
-	int32_t ticks_elapsed = elapsed();
+	int64_t dticks = next_dticks(q);
+	int32_t ticks_elapsed = elapsed(q);
 	int32_t ret;
 
-	if ((to == NULL) ||
-	    ((int64_t)(to->dticks - ticks_elapsed) > (int64_t)INT_MAX)) {
+	if ((dticks - ticks_elapsed) > (int64_t)INT_MAX) {
 		ret = MAX_WAIT;
 	} else {
-		ret = MAX(0, to->dticks - ticks_elapsed);
+		ret = MAX(0, dticks - ticks_elapsed);
 	}
 
 	return ret;
 }
 
+/* Expire everything due on the queue within the next @ticks.  Called
+ * with q->lock held, which is released around each callback.
+ */
+static k_spinlock_key_t expire_timeouts(struct timeout_q *q, k_spinlock_key_t key,
+					int32_t ticks)
+{
+	q->announce_remaining = ticks;
+
+	for (int64_t dt = next_dticks(q);
+	     dt <= q->announce_remaining;
+	     dt = next_dticks(q)) {
+		struct _timeout *t;
+
+		q->tick += dt;
+		t = expire_next(q, dt);
+
+		if (t != NULL) {
+			k_spin_unlock(&q->lock, key);
+			t->fn(t);
+			key = k_spin_lock(&q->lock);
+		}
+		q->announce_remaining -= dt;
+	}
+
+	advance_timeouts(q, q->announce_remaining);
+
+	q->tick += q->announce_remaining;
+	q->announce_remaining = 0;
+
+	return key;
+}
+
+#ifdef CONFIG_TIMEOUT_QUEUE_PERCPU
+
+/* Absolute tick of the first expiry on the queue, UINT64_MAX if none.
+ * Must be locked.
+ */
+static uint64_t queue_deadline(struct timeout_q *q)
+{
+	int64_t dt = next_dticks(q);
+
+	return (dt == INT64_MAX) ? UINT64_MAX : (q->tick + dt);
+}
+
+/* timeout_lock must be held */
+static void set_deadline(uint64_t deadline)
+{
+	int32_t ticks = MAX_WAIT;
+
+	next_deadline = deadline;
+
+	if (deadline != UINT64_MAX) {
+		int64_t dt = (int64_t)(deadline - curr_tick) - sys_clock_elapsed();
+
+		if (dt <= (int64_t)INT_MAX) {
+			ticks = MAX(0, dt);
+		}
+	}
+
+	sys_clock_set_timeout(ticks, false);
+}
+
+/* Program the system timer for the earliest expiry of all queues.
+ * Queues with an expiry pass pending on their CPU are skipped, that
+ * CPU reprograms the timer once it is done.
+ */
+static void update_deadline(void)
+{
+	uint64_t deadline = UINT64_MAX;
+
+	/* Anything armed while we scan lowers next_deadline again */
+	K_SPINLOCK(&timeout_lock) {
+		next_deadline = UINT64_MAX;
+	}
+
+	for (unsigned int i = 0; i < arch_num_cpus(); i++) {
+		struct timeout_q *q = &timeout_queues[i];
+
+		if (atomic_get(&q->expire_pending) != 0) {
+			continue;
+		}
+
+		K_SPINLOCK(&q->lock) {
+			deadline = MIN(deadline, queue_deadline(q));
+		}
+	}
+
+	K_SPINLOCK(&timeout_lock) {
+		set_deadline(MIN(deadline, next_deadline));
+	}
+}
+
+/* Run the local queue up to the last announced tick */
+static void expire_local_queue(void)
+{
+	struct timeout_q *q = &timeout_queues[_current_cpu->id];
+	uint64_t target = 0;
+
+	atomic_clear(&q->expire_pending);
+
+	K_SPINLOCK(&timeout_lock) {
+		target = curr_tick;
+	}
+
+	k_spinlock_key_t key = k_spin_lock(&q->lock);
+
+	if (q->announce_remaining != 0) {
+		/* We interrupted a pass on this CPU: extend it instead
+		 * of running callbacks out of order.
+		 */
+		q->announce_remaining = MAX(q->announce_remaining,
+					    (int)(target - q->tick));
+	} else {
+		key = expire_timeouts(q, key, (int32_t)(target - q->tick));
+	}
+
+	k_spin_unlock(&q->lock, key);
+}
+
+void z_timeout_ipi(void)
+{
+	struct timeout_q *q = &timeout_queues[_current_cpu->id];
+
+	if (atomic_get(&q->expire_pending) != 0) {
+		expire_local_queue();
+		update_deadline();
+	}
+}
+
+#endif /* CONFIG_TIMEOUT_QUEUE_PERCPU */
+
 void z_add_timeout(struct _timeout *to, _timeout_func_t fn,
 		   k_timeout_t timeout)
 {
@@ -110,44 +593,46 @@ void z_add_timeout(struct _timeout *to, _timeout_func_t fn,
 	__ASSERT(!sys_dnode_is_linked(&to->node), "");
 	to->fn = fn;
 
-	K_SPINLOCK(&timeout_lock) {
-		struct _timeout *t;
+	struct timeout_q *q = local_queue();
 
+	K_SPINLOCK(&q->lock) {
 		if (IS_ENABLED(CONFIG_TIMEOUT_64BIT) &&
 		    (Z_TICK_ABS(timeout.ticks) >= 0)) {
-			k_ticks_t ticks = Z_TICK_ABS(timeout.ticks) - curr_tick;
+			k_ticks_t ticks = Z_TICK_ABS(timeout.ticks) - q->tick;
 
 			to->dticks = MAX(1, ticks);
 		} else {
-			to->dticks = timeout.ticks + 1 + elapsed();
+			to->dticks = timeout.ticks + 1 + elapsed(q);
 		}
 
-		for (t = first(); t != NULL; t = next(t)) {
-			if (t->dticks > to->dticks) {
-				t->dticks -= to->dticks;
-				sys_dlist_insert(&t->node, &to->node);
-				break;
-			}
-			to->dticks -= t->dticks;
-		}
+#ifdef CONFIG_TIMEOUT_QUEUE_PERCPU
+		to->cpu = q - timeout_queues;
 
-		if (t == NULL) {
-			sys_dlist_append(&timeout_list, &to->node);
-		}
+		uint64_t expiry = q->tick + to->dticks;
 
-		if (to == first() && announce_remaining == 0) {
-			sys_clock_set_timeout(next_timeout(), false);
+		if (insert_timeout(q, to) && q->announce_remaining == 0) {
+			K_SPINLOCK(&timeout_lock) {
+				if (expiry < next_deadline) {
+					set_deadline(expiry);
+				}
+			}
 		}
+#else
+		if (insert_timeout(q, to) && q->announce_remaining == 0) {
+			sys_clock_set_timeout(next_timeout(q), false);
+		}
+#endif /* CONFIG_TIMEOUT_QUEUE_PERCPU */
 	}
 }
 
 int z_abort_timeout(struct _timeout *to)
 {
+	struct timeout_q *q = queue_of(to);
 	int ret = -EINVAL;
 
-	K_SPINLOCK(&timeout_lock) {
+	K_SPINLOCK(&q->lock) {
 		if (sys_dnode_is_linked(&to->node)) {
-			remove_timeout(to);
+			remove_timeout(q, to);
 			ret = 0;
 		}
 	}
@@ -155,28 +640,79 @@ int z_abort_timeout(struct _timeout *to)
 	return ret;
 }
 
-/* must be locked */
-static k_ticks_t timeout_rem(const struct _timeout *timeout)
+#ifdef CONFIG_TIMEOUT_QUEUE_PERCPU
+void z_timeout_migrate(struct _timeout *to, uint32_t cpu_mask)
 {
-	k_ticks_t ticks = 0;
+	unsigned int cpu = u32_count_trailing_zeros(cpu_mask);
+	struct timeout_q *dst, *src, *lo, *hi;
+	k_spinlock_key_t lo_key, hi_key;
 
-	for (struct _timeout *t = first(); t != NULL; t = next(t)) {
-		ticks += t->dticks;
-		if (timeout == t) {
+	if (cpu >= arch_num_cpus()) {
+		return;
+	}
+
+	dst = &timeout_queues[cpu];
+
+	while (true) {
+		if ((cpu_mask & BIT(to->cpu)) != 0U) {
+			return;
+		}
+
+		src = queue_of(to);
+		lo = MIN(src, dst);
+		hi = MAX(src, dst);
+
+		/* Queue locks are always taken in index order */
+		lo_key = k_spin_lock(&lo->lock);
+		hi_key = k_spin_lock(&hi->lock);
+
+		/* The timeout may have been re-armed on another queue
+		 * before the locks were taken: look again.
+		 */
+		if (queue_of(to) == src) {
 			break;
 		}
+
+		k_spin_unlock(&hi->lock, hi_key);
+		k_spin_unlock(&lo->lock, lo_key);
 	}
 
-	return ticks;
+	if (sys_dnode_is_linked(&to->node)) {
+		uint64_t expiry = src->tick + timeout_rem(src, to);
+
+		remove_timeout(src, to);
+
+		/* The destination may be ahead of the source if the
+		 * source has not processed the latest announce yet.
+		 */
+		expiry = MAX(expiry, dst->tick + 1);
+		to->dticks = expiry - dst->tick;
+		to->cpu = cpu;
+
+		if (insert_timeout(dst, to) && dst->announce_remaining == 0) {
+			K_SPINLOCK(&timeout_lock) {
+				if (expiry < next_deadline) {
+					set_deadline(expiry);
+				}
+			}
+		}
+	} else {
+		to->cpu = cpu;
+	}
+
+	k_spin_unlock(&hi->lock, hi_key);
+	k_spin_unlock(&lo->lock, lo_key);
 }
+#endif /* CONFIG_TIMEOUT_QUEUE_PERCPU */
 
 k_ticks_t z_timeout_remaining(const struct _timeout *timeout)
 {
+	struct timeout_q *q = queue_of(timeout);
 	k_ticks_t ticks = 0;
 
-	K_SPINLOCK(&timeout_lock) {
+	K_SPINLOCK(&q->lock) {
 		if (!z_is_inactive_timeout(timeout)) {
-			ticks = timeout_rem(timeout) - elapsed();
+			ticks = timeout_rem(q, timeout) - elapsed(q);
 		}
 	}
 
@@ -185,12 +721,13 @@ k_ticks_t z_timeout_remaining(const struct _timeout *timeout)
 
 k_ticks_t z_timeout_expires(const struct _timeout *timeout)
 {
+	struct timeout_q *q = queue_of(timeout);
 	k_ticks_t ticks = 0;
 
-	K_SPINLOCK(&timeout_lock) {
-		ticks = curr_tick;
+	K_SPINLOCK(&q->lock) {
+		ticks = q->tick;
 		if (!z_is_inactive_timeout(timeout)) {
-			ticks += timeout_rem(timeout);
+			ticks += timeout_rem(q, timeout);
 		}
 	}
 
@@ -201,70 +738,119 @@ int32_t z_get_next_timeout_expiry(void)
 {
 	int32_t ret = (int32_t) K_TICKS_FOREVER;
 
-	K_SPINLOCK(&timeout_lock) {
-		ret = next_timeout();
+#ifdef CONFIG_TIMEOUT_QUEUE_PERCPU
+	ret = MAX_WAIT;
+
+	for (unsigned int i = 0; i < arch_num_cpus(); i++) {
+		struct timeout_q *q = &timeout_queues[i];
+
+		K_SPINLOCK(&q->lock) {
+			int32_t next = next_timeout(q);
+
+			/* K_TICKS_FOREVER is the largest value when cast
+			 * to unsigned.
+			 */
+			if ((uint32_t)next < (uint32_t)ret) {
+				ret = next;
+			}
+		}
 	}
+#else
+	K_SPINLOCK(&timeout_queue.lock) {
+		ret = next_timeout(&timeout_queue);
+	}
+#endif /* CONFIG_TIMEOUT_QUEUE_PERCPU */
+
 	return ret;
 }
 
+#ifdef CONFIG_TIMEOUT_QUEUE_PERCPU
+
 void sys_clock_announce(int32_t ticks)
 {
-	k_spinlock_key_t key = k_spin_lock(&timeout_lock);
+	uint64_t target = 0;
+	uint32_t ipi_mask = 0;
 
-	/* We release the lock around the callbacks below, so on SMP
-	 * systems someone might be already running the loop.  Don't
-	 * race (which will cause parallel execution of "sequential"
-	 * timeouts and confuse apps), just increment the tick count
-	 * and return.
-	 */
-	if (IS_ENABLED(CONFIG_SMP) && (announce_remaining != 0)) {
-		announce_remaining += ticks;
-		k_spin_unlock(&timeout_lock, key);
-		return;
+	K_SPINLOCK(&timeout_lock) {
+		curr_tick += ticks;
+		target = curr_tick;
 	}
 
-	announce_remaining = ticks;
+	expire_local_queue();
 
-	struct _timeout *t;
+	/* Timeouts are expired on the CPU that armed them */
+	for (unsigned int i = 0; i < arch_num_cpus(); i++) {
+		struct timeout_q *q = &timeout_queues[i];
 
-	for (t = first();
-	     (t != NULL) && (t->dticks <= announce_remaining);
-	     t = first()) {
-		int dt = t->dticks;
+		if (i == _current_cpu->id) {
+			continue;
+		}
 
-		curr_tick += dt;
-		t->dticks = 0;
-		remove_timeout(t);
+		K_SPINLOCK(&q->lock) {
+			if (queue_deadline(q) <= target) {
+				atomic_set(&q->expire_pending, 1);
+				ipi_mask |= BIT(i);
+			}
+		}
+	}
 
-		k_spin_unlock(&timeout_lock, key);
-		t->fn(t);
-		key = k_spin_lock(&timeout_lock);
-		announce_remaining -= dt;
+	if (ipi_mask != 0U) {
+		flag_ipi(ipi_mask);
+		signal_pending_ipi();
 	}
 
-	if (t != NULL) {
-		t->dticks -= announce_remaining;
+	update_deadline();
+
+#ifdef CONFIG_TIMESLICING
+	z_time_slice();
+#endif /* CONFIG_TIMESLICING */
+}
+
+#else
+
+void sys_clock_announce(int32_t ticks)
+{
+	struct timeout_q *q = &timeout_queue;
+	k_spinlock_key_t key = k_spin_lock(&q->lock);
+
+	/* We release the lock around the callbacks below, so on SMP
+	 * systems someone might be already running the loop.  Don't
+	 * race (which will cause parallel execution of "sequential"
+	 * timeouts and confuse apps), just increment the tick count
+	 * and return.
+	 */
+	if (IS_ENABLED(CONFIG_SMP) && (q->announce_remaining != 0)) {
+		q->announce_remaining += ticks;
+		k_spin_unlock(&q->lock, key);
+		return;
 	}
 
-	curr_tick += announce_remaining;
-	announce_remaining = 0;
+	key = expire_timeouts(q, key, ticks);
 
-	sys_clock_set_timeout(next_timeout(), false);
+	sys_clock_set_timeout(next_timeout(q), false);
 
-	k_spin_unlock(&timeout_lock, key);
+	k_spin_unlock(&q->lock, key);
 
 #ifdef CONFIG_TIMESLICING
 	z_time_slice();
 #endif /* CONFIG_TIMESLICING */
 }
 
+#endif /* CONFIG_TIMEOUT_QUEUE_PERCPU */
+
 int64_t sys_clock_tick_get(void)
 {
 	uint64_t t = 0U;
 
+#ifdef CONFIG_TIMEOUT_QUEUE_PERCPU
 	K_SPINLOCK(&timeout_lock) {
-		t = curr_tick + elapsed();
+		t = curr_tick + sys_clock_elapsed();
+	}
+#else
+	K_SPINLOCK(&timeout_queue.lock) {
+		t = timeout_queue.tick + elapsed(&timeout_queue);
 	}
+#endif /* CONFIG_TIMEOUT_QUEUE_PERCPU */
 	return t;
 }
 
@@ -272,8 +858,10 @@ uint32_t sys_clock_tick_get_32(void)
 {
 #ifdef CONFIG_TICKLESS_KERNEL
 	return (uint32_t)sys_clock_tick_get();
-#else
+#elif defined(CONFIG_TIMEOUT_QUEUE_PERCPU)
 	return (uint32_t)curr_tick;
+#else
+	return (uint32_t)timeout_queue.tick;
 #endif /* CONFIG_TICKLESS_KERNEL */
 }
 
@@ -330,7 +918,14 @@ k_timeout_t sys_timepoint_timeout(k_timepoint_t timepoint)
 #ifdef CONFIG_ZTEST
 void z_impl_sys_clock_tick_set(uint64_t tick)
 {
+#ifdef CONFIG_TIMEOUT_QUEUE_PERCPU
 	curr_tick = tick;
+	for (unsigned int i = 0; i < arch_num_cpus(); i++) {
+		timeout_queues[i].tick = tick;
+	}
+#else
+	timeout_queue.tick = tick;
+#endif /* CONFIG_TIMEOUT_QUEUE_PERCPU */
 }
 
 void z_vrfy_sys_clock_tick_set(uint64_t tick)
@@ -10,6 +10,7 @@
 #include <ksched.h>
 #include <zephyr/spinlock.h>
 #include <zephyr/sys/check.h>
+#include <zephyr/sys/math_extras.h>
 
 /* Need one of these for this to work */
 #if !defined(CONFIG_USE_SWITCH) && !defined(CONFIG_INSTRUMENT_THREAD_SWITCHING)
@@ -58,6 +59,47 @@ static void sched_cpu_update_usage(struct _cpu *cpu, uint32_t cycles)
 #define sched_cpu_update_usage(cpu, cycles)   do { } while (0)
 #endif /* CONFIG_SCHED_THREAD_USAGE_ALL */
 
+#ifdef CONFIG_SCHED_THREAD_USAGE_LATENCY
+static void sched_latency_add(struct k_cycle_stats *stats, uint32_t cycles)
+{
+	unsigned int bucket;
+
+	bucket = (cycles == 0U) ? 0U : (31U - u32_count_leading_zeros(cycles));
+	bucket = MIN(bucket, ARRAY_SIZE(stats->latency) - 1U);
+
+	stats->latency[bucket]++;
+	stats->latency_max = MAX(stats->latency_max, cycles);
+}
+
+static void sched_update_latency(struct _cpu *cpu, struct k_thread *thread,
+				 uint32_t now)
+{
+	uint32_t r0 = thread->base.ready0;
+	uint32_t cycles;
+
+	/* Only the first switch in after becoming ready counts */
+	if (r0 == 0U) {
+		return;
+	}
+
+	thread->base.ready0 = 0U;
+	cycles = now - r0;
+
+	if (thread->base.usage.track_usage) {
+		sched_latency_add(&thread->base.usage, cycles);
+	}
+
+	if (cpu->usage->track_usage) {
+		sched_latency_add(cpu->usage, cycles);
+	}
+}
+
+void z_sched_usage_ready(struct k_thread *thread)
+{
+	thread->base.ready0 = usage_now();
+}
+#endif /* CONFIG_SCHED_THREAD_USAGE_LATENCY */
+
 static void sched_thread_update_usage(struct k_thread *thread, uint32_t cycles)
 {
 	thread->base.usage.total += cycles;
@@ -73,17 +115,23 @@ static void sched_thread_update_usage(struct k_thread *thread, uint32_t cycles)
 
 void z_sched_usage_start(struct k_thread *thread)
 {
-#ifdef CONFIG_SCHED_THREAD_USAGE_ANALYSIS
+#if defined(CONFIG_SCHED_THREAD_USAGE_ANALYSIS) || defined(CONFIG_SCHED_THREAD_USAGE_LATENCY)
 	k_spinlock_key_t  key;
 
 	key = k_spin_lock(&usage_lock);
 
 	_current_cpu->usage0 = usage_now();   /* Always update */
 
+#ifdef CONFIG_SCHED_THREAD_USAGE_ANALYSIS
 	if (thread->base.usage.track_usage) {
 		thread->base.usage.num_windows++;
 		thread->base.usage.current = 0;
 	}
+#endif /* CONFIG_SCHED_THREAD_USAGE_ANALYSIS */
+
+#ifdef CONFIG_SCHED_THREAD_USAGE_LATENCY
+	sched_update_latency(_current_cpu, thread, _current_cpu->usage0);
+#endif /* CONFIG_SCHED_THREAD_USAGE_LATENCY */
 
 	k_spin_unlock(&usage_lock, key);
 #else
@@ -93,7 +141,7 @@ void z_sched_usage_start(struct k_thread *thread)
 	 */
 
 	_current_cpu->usage0 = usage_now();
-#endif /* CONFIG_SCHED_THREAD_USAGE_ANALYSIS */
+#endif /* CONFIG_SCHED_THREAD_USAGE_ANALYSIS || CONFIG_SCHED_THREAD_USAGE_LATENCY */
 }
 
 void z_sched_usage_stop(void)
@@ -164,6 +212,12 @@ void z_sched_cpu_usage(uint8_t cpu_id, struct k_thread_runtime_stats *stats)
 	stats->idle_cycles =
 		_kernel.cpus[cpu_id].idle_thread->base.usage.total;
 
+#ifdef CONFIG_SCHED_THREAD_USAGE_LATENCY
+	memcpy(stats->latency, _kernel.cpus[cpu_id].usage->latency,
+	       sizeof(stats->latency));
+	stats->latency_max = _kernel.cpus[cpu_id].usage->latency_max;
+#endif /* CONFIG_SCHED_THREAD_USAGE_LATENCY */
+
 	stats->execution_cycles = stats->total_cycles + stats->idle_cycles;
 
 	k_spin_unlock(&usage_lock, key);
@@ -221,6 +275,12 @@ void z_sched_thread_usage(struct k_thread *thread,
 	stats->idle_cycles = 0;
 #endif /* CONFIG_SCHED_THREAD_USAGE_ALL */
 
+#ifdef CONFIG_SCHED_THREAD_USAGE_LATENCY
+	memcpy(stats->latency, thread->base.usage.latency,
+	       sizeof(stats->latency));
+	stats->latency_max = thread->base.usage.latency_max;
+#endif /* CONFIG_SCHED_THREAD_USAGE_LATENCY */
+
 	k_spin_unlock(&usage_lock, key);
 }
 
@@ -382,6 +442,10 @@ int z_thread_stats_reset(struct k_obj_core *obj_core)
 	stats->longest = 0ULL;
 	stats->num_windows = (thread->base.usage.track_usage) ?  1U : 0U;
 #endif /* CONFIG_SCHED_THREAD_USAGE_ANALYSIS */
+#ifdef CONFIG_SCHED_THREAD_USAGE_LATENCY
+	memset(stats->latency, 0, sizeof(stats->latency));
+	stats->latency_max = 0U;
+#endif /* CONFIG_SCHED_THREAD_USAGE_LATENCY */
 
 	if (thread != _current_cpu->current) {
 
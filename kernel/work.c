@@ -235,6 +235,131 @@ static inline bool notify_queue_locked(struct k_work_q *queue)
 	return rv;
 }
 
+#ifdef CONFIG_WORKQUEUE_POOL
+/* Wake one idle sibling of a pool worker so that it can steal work.
+ *
+ * Invoked with work lock held.
+ *
+ * @param queue pool worker that has more work than it can start now.
+ */
+static void pool_wake_idle_locked(struct k_work_q *queue)
+{
+	struct k_work_pool *pool = queue->pool;
+	unsigned int self = (unsigned int)(queue - pool->workers);
+
+	for (unsigned int i = 1; i < pool->num_workers; i++) {
+		struct k_work_q *sibling =
+			&pool->workers[(self + i) % pool->num_workers];
+
+		if (notify_queue_locked(sibling)) {
+			break;
+		}
+	}
+}
+
+/* Remove from a pool worker's queue the oldest item another worker may run.
+ *
+ * Flushers are left alone, as are items followed by a flusher: a flusher
+ * must be processed by the queue that runs the item it waits for.  Items
+ * resubmitted while running are left alone too, as they must run on the
+ * queue already running them to prevent handler re-entrancy.
+ *
+ * Invoked with work lock held.
+ *
+ * @param victim the queue to steal from
+ *
+ * @return the stolen work item, or NULL if there is none.
+ */
+static struct k_work *queue_steal_locked(struct k_work_q *victim)
+{
+	sys_snode_t *prev = NULL;
+	sys_snode_t *cand_prev = NULL;
+	sys_snode_t *cand = NULL;
+	sys_snode_t *node;
+
+	SYS_SLIST_FOR_EACH_NODE(&victim->pending, node) {
+		struct k_work *work = CONTAINER_OF(node, struct k_work, node);
+		sys_snode_t *next = sys_slist_peek_next(node);
+
+		if ((work->handler != handle_flush)
+		    && !flag_test(&work->flags, K_WORK_RUNNING_BIT)
+		    && ((next == NULL)
+			|| (CONTAINER_OF(next, struct k_work, node)->handler
+			    != handle_flush))) {
+			cand = node;
+			cand_prev = prev;
+		}
+		prev = node;
+	}
+
+	if (cand == NULL) {
+		return NULL;
+	}
+
+	sys_slist_remove(&victim->pending, cand_prev, cand);
+
+	return CONTAINER_OF(cand, struct k_work, node);
+}
+
+/* Steal an item for an idle pool worker from its siblings.
+ *
+ * Invoked with work lock held.
+ *
+ * @param queue the idle pool worker
+ *
+ * @return the list node of the stolen item, now owned by @p queue, or NULL.
+ */
+static sys_snode_t *pool_steal_locked(struct k_work_q *queue)
+{
+	struct k_work_pool *pool = queue->pool;
+	unsigned int self = (unsigned int)(queue - pool->workers);
+
+	for (unsigned int i = 1; i < pool->num_workers; i++) {
+		struct k_work_q *victim =
+			&pool->workers[(self + i) % pool->num_workers];
+		struct k_work *work = queue_steal_locked(victim);
+
+		if (work != NULL) {
+			work->queue = queue;
+			if (!sys_slist_is_empty(&victim->pending)) {
+				pool_wake_idle_locked(queue);
+			}
+
+			return &work->node;
+		}
+	}
+
+	return NULL;
+}
+#endif /* CONFIG_WORKQUEUE_POOL */
+
+/* Add a work item to a queue's pending list.
+ *
+ * Pool workers take their own items newest first, as the most recently
+ * submitted item is the most likely to still be in the local cache, while
+ * thieves take the oldest ones.
+ *
+ * Invoked with work lock held.
+ *
+ * @param queue the queue to add to
+ * @param work the work item to add
+ */
+static inline void queue_push_locked(struct k_work_q *queue,
+				     struct k_work *work)
+{
+#ifdef CONFIG_WORKQUEUE_POOL
+	if (queue->pool != NULL) {
+		sys_slist_prepend(&queue->pending, &work->node);
+		if (flag_test(&queue->flags, K_WORK_QUEUE_BUSY_BIT)) {
+			pool_wake_idle_locked(queue);
+		}
+		return;
+	}
+#endif /* CONFIG_WORKQUEUE_POOL */
+
+	sys_slist_append(&queue->pending, &work->node);
+}
+
 /* Submit an work item to a queue if queue state allows new work.
  *
  * Submission is rejected if no queue is provided, or if the queue is
@@ -280,7 +405,7 @@ static inline int queue_submit_locked(struct k_work_q *queue,
 	} else if (plugged && !draining) {
 		ret = -EBUSY;
 	} else {
-		sys_slist_append(&queue->pending, &work->node);
+		queue_push_locked(queue, work);
 		ret = 1;
 		(void)notify_queue_locked(queue);
 	}
@@ -619,6 +744,20 @@ static void work_queue_main(void *workq_ptr, void *p2, void *p3)
 
 		/* Check for and prepare any new work. */
 		node = sys_slist_get(&queue->pending);
+#ifdef CONFIG_WORKQUEUE_POOL
+		if (queue->pool != NULL) {
+			/* A draining or plugged worker takes no new work. */
+			if (node == NULL) {
+				if ((flags_get(&queue->flags)
+				     & (K_WORK_QUEUE_DRAIN
+					| K_WORK_QUEUE_PLUGGED)) == 0U) {
+					node = pool_steal_locked(queue);
+				}
+			} else if (!sys_slist_is_empty(&queue->pending)) {
+				pool_wake_idle_locked(queue);
+			}
+		}
+#endif /* CONFIG_WORKQUEUE_POOL */
 		if (node != NULL) {
 			/* Mark that there's some work active that's
 			 * not on the pending list.
@@ -716,19 +855,21 @@ void k_work_queue_init(struct k_work_q *queue)
 	SYS_PORT_TRACING_OBJ_INIT(k_work_queue, queue);
 }
 
-void k_work_queue_start(struct k_work_q *queue,
-			k_thread_stack_t *stack,
-			size_t stack_size,
-			int prio,
-			const struct k_work_queue_config *cfg)
+/* Prepare a work queue and create its thread without starting it.
+ *
+ * See k_work_queue_start() for parameters.
+ */
+static void work_queue_setup(struct k_work_q *queue,
+			     k_thread_stack_t *stack,
+			     size_t stack_size,
+			     int prio,
+			     const struct k_work_queue_config *cfg)
 {
 	__ASSERT_NO_MSG(queue);
 	__ASSERT_NO_MSG(stack);
 	__ASSERT_NO_MSG(!flag_test(&queue->flags, K_WORK_QUEUE_STARTED_BIT));
 	uint32_t flags = K_WORK_QUEUE_STARTED;
 
-	SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_work_queue, start, queue);
-
 	sys_slist_init(&queue->pending);
 	z_waitq_init(&queue->notifyq);
 	z_waitq_init(&queue->drainq);
@@ -754,7 +895,17 @@ void k_work_queue_start(struct k_work_q *queue,
 	if ((cfg != NULL) && (cfg->essential)) {
 		queue->thread.base.user_options |= K_ESSENTIAL;
 	}
+}
 
+void k_work_queue_start(struct k_work_q *queue,
+			k_thread_stack_t *stack,
+			size_t stack_size,
+			int prio,
+			const struct k_work_queue_config *cfg)
+{
+	SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_work_queue, start, queue);
+
+	work_queue_setup(queue, stack, stack_size, prio, cfg);
 	k_thread_start(&queue->thread);
 
 	SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_work_queue, start, queue);
@@ -812,6 +963,133 @@ int k_work_queue_unplug(struct k_work_q *queue)
 	return ret;
 }
 
+#ifdef CONFIG_WORKQUEUE_POOL
+
+void k_work_pool_start(struct k_work_pool *pool,
+		       k_thread_stack_t *stacks,
+		       size_t stack_size,
+		       int prio,
+		       const struct k_work_queue_config *cfg)
+{
+	__ASSERT_NO_MSG(pool);
+	__ASSERT_NO_MSG(stacks);
+	__ASSERT_NO_MSG(pool->num_workers == 0U);
+
+	unsigned int num_workers = arch_num_cpus();
+
+	for (unsigned int i = 0; i < num_workers; i++) {
+		struct k_work_q *queue = &pool->workers[i];
+
+		k_work_queue_init(queue);
+		queue->pool = pool;
+		work_queue_setup(queue,
+				 stacks + (i * K_THREAD_STACK_LEN(stack_size)),
+				 stack_size, prio, cfg);
+#ifdef CONFIG_SCHED_CPU_MASK
+		(void)k_thread_cpu_pin(&queue->thread, i);
+#endif /* CONFIG_SCHED_CPU_MASK */
+	}
+
+	/* Workers only look for siblings once all of them exist. */
+	k_spinlock_key_t key = k_spin_lock(&lock);
+
+	pool->num_workers = num_workers;
+
+	k_spin_unlock(&lock, key);
+
+	for (unsigned int i = 0; i < num_workers; i++) {
+		k_thread_start(&pool->workers[i].thread);
+	}
+}
+
+int k_work_pool_submit(struct k_work_pool *pool,
+		       struct k_work *work)
+{
+	__ASSERT_NO_MSG(pool != NULL);
+	__ASSERT_NO_MSG(work != NULL);
+	__ASSERT_NO_MSG(work->handler != NULL);
+
+	k_spinlock_key_t key = k_spin_lock(&lock);
+	unsigned int cpu = _current_cpu->id;
+
+	/* A pool that has not been started rejects the item with -ENODEV
+	 * from its first worker.
+	 */
+	if (cpu >= pool->num_workers) {
+		cpu = 0U;
+	}
+
+	struct k_work_q *queue = &pool->workers[cpu];
+	int ret = submit_to_queue_locked(work, &queue);
+
+	k_spin_unlock(&lock, key);
+
+	if (ret > 0) {
+		z_reschedule_unlocked();
+	}
+
+	return ret;
+}
+
+int k_work_pool_drain(struct k_work_pool *pool,
+		      bool plug)
+{
+	__ASSERT_NO_MSG(pool);
+	__ASSERT_NO_MSG(!k_is_in_isr());
+
+	int ret = 0;
+	bool plugged = false;
+	bool waited;
+
+	/* Workers not yet reached by a pass still accept submissions and
+	 * steal, so keep the whole pool plugged and repeat until a pass finds
+	 * no worker with anything left to do.
+	 */
+	do {
+		waited = false;
+
+		for (unsigned int i = 0; i < pool->num_workers; i++) {
+			int rc = k_work_queue_drain(&pool->workers[i], !plugged);
+
+			if (rc < 0) {
+				ret = rc;
+				waited = false;
+				break;
+			}
+
+			if (rc > 0) {
+				waited = true;
+				ret = 1;
+			}
+		}
+
+		plugged = true;
+	} while (waited);
+
+	if (!plug) {
+		(void)k_work_pool_unplug(pool);
+	}
+
+	return ret;
+}
+
+int k_work_pool_unplug(struct k_work_pool *pool)
+{
+	__ASSERT_NO_MSG(pool);
+
+	int ret = -EALREADY;
+
+	for (unsigned int i = 0; i < pool->num_workers; i++) {
+		if (k_work_queue_unplug(&pool->workers[i]) == 0) {
+			ret = 0;
+		}
+	}
+
+	return ret;
+}
+
+#endif /* CONFIG_WORKQUEUE_POOL */
+
 #ifdef CONFIG_SYS_CLOCK_EXISTS
 
 /* Timeout handler for delayable work.
@@ -0,0 +1,570 @@
+/*
+ * Copyright (c) 2026 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * Table [0] is the usual bytewise table. Table [k] holds the CRC of
+ * byte n followed by k zero bytes, so that eight input bytes can be
+ * folded into the CRC with eight independent lookups.
+ */
+
+#ifndef ZEPHYR_LIB_CRC_CRC16_SLICE8_H_
+#define ZEPHYR_LIB_CRC_CRC16_SLICE8_H_
+
+#include <stdint.h>
+
+/* Slicing-by-8 tables for reflected polynomial 0x8408 (CCITT) */
+static const uint16_t crc16_ccitt_slice8[8][256] = {
+	{
+		0x0000U, 0x1189U, 0x2312U, 0x329bU, 0x4624U, 0x57adU, 0x6536U, 0x74bfU,
+		0x8c48U, 0x9dc1U, 0xaf5aU, 0xbed3U, 0xca6cU, 0xdbe5U, 0xe97eU, 0xf8f7U,
+		0x1081U, 0x0108U, 0x3393U, 0x221aU, 0x56a5U, 0x472cU, 0x75b7U, 0x643eU,
+		0x9cc9U, 0x8d40U, 0xbfdbU, 0xae52U, 0xdaedU, 0xcb64U, 0xf9ffU, 0xe876U,
+		0x2102U, 0x308bU, 0x0210U, 0x1399U, 0x6726U, 0x76afU, 0x4434U, 0x55bdU,
+		0xad4aU, 0xbcc3U, 0x8e58U, 0x9fd1U, 0xeb6eU, 0xfae7U, 0xc87cU, 0xd9f5U,
+		0x3183U, 0x200aU, 0x1291U, 0x0318U, 0x77a7U, 0x662eU, 0x54b5U, 0x453cU,
+		0xbdcbU, 0xac42U, 0x9ed9U, 0x8f50U, 0xfbefU, 0xea66U, 0xd8fdU, 0xc974U,
+		0x4204U, 0x538dU, 0x6116U, 0x709fU, 0x0420U, 0x15a9U, 0x2732U, 0x36bbU,
+		0xce4cU, 0xdfc5U, 0xed5eU, 0xfcd7U, 0x8868U, 0x99e1U, 0xab7aU, 0xbaf3U,
+		0x5285U, 0x430cU, 0x7197U, 0x601eU, 0x14a1U, 0x0528U, 0x37b3U, 0x263aU,
+		0xdecdU, 0xcf44U, 0xfddfU, 0xec56U, 0x98e9U, 0x8960U, 0xbbfbU, 0xaa72U,
+		0x6306U, 0x728fU, 0x4014U, 0x519dU, 0x2522U, 0x34abU, 0x0630U, 0x17b9U,
+		0xef4eU, 0xfec7U, 0xcc5cU, 0xddd5U, 0xa96aU, 0xb8e3U, 0x8a78U, 0x9bf1U,
+		0x7387U, 0x620eU, 0x5095U, 0x411cU, 0x35a3U, 0x242aU, 0x16b1U, 0x0738U,
+		0xffcfU, 0xee46U, 0xdcddU, 0xcd54U, 0xb9ebU, 0xa862U, 0x9af9U, 0x8b70U,
+		0x8408U, 0x9581U, 0xa71aU, 0xb693U, 0xc22cU, 0xd3a5U, 0xe13eU, 0xf0b7U,
+		0x0840U, 0x19c9U, 0x2b52U, 0x3adbU, 0x4e64U, 0x5fedU, 0x6d76U, 0x7cffU,
+		0x9489U, 0x8500U, 0xb79bU, 0xa612U, 0xd2adU, 0xc324U, 0xf1bfU, 0xe036U,
+		0x18c1U, 0x0948U, 0x3bd3U, 0x2a5aU, 0x5ee5U, 0x4f6cU, 0x7df7U, 0x6c7eU,
+		0xa50aU, 0xb483U, 0x8618U, 0x9791U, 0xe32eU, 0xf2a7U, 0xc03cU, 0xd1b5U,
+		0x2942U, 0x38cbU, 0x0a50U, 0x1bd9U, 0x6f66U, 0x7eefU, 0x4c74U, 0x5dfdU,
+		0xb58bU, 0xa402U, 0x9699U, 0x8710U, 0xf3afU, 0xe226U, 0xd0bdU, 0xc134U,
+		0x39c3U, 0x284aU, 0x1ad1U, 0x0b58U, 0x7fe7U, 0x6e6eU, 0x5cf5U, 0x4d7cU,
+		0xc60cU, 0xd785U, 0xe51eU, 0xf497U, 0x8028U, 0x91a1U, 0xa33aU, 0xb2b3U,
+		0x4a44U, 0x5bcdU, 0x6956U, 0x78dfU, 0x0c60U, 0x1de9U, 0x2f72U, 0x3efbU,
+		0xd68dU, 0xc704U, 0xf59fU, 0xe416U, 0x90a9U, 0x8120U, 0xb3bbU, 0xa232U,
+		0x5ac5U, 0x4b4cU, 0x79d7U, 0x685eU, 0x1ce1U, 0x0d68U, 0x3ff3U, 0x2e7aU,
+		0xe70eU, 0xf687U, 0xc41cU, 0xd595U, 0xa12aU, 0xb0a3U, 0x8238U, 0x93b1U,
+		0x6b46U, 0x7acfU, 0x4854U, 0x59ddU, 0x2d62U, 0x3cebU, 0x0e70U, 0x1ff9U,
+		0xf78fU, 0xe606U, 0xd49dU, 0xc514U, 0xb1abU, 0xa022U, 0x92b9U, 0x8330U,
+		0x7bc7U, 0x6a4eU, 0x58d5U, 0x495cU, 0x3de3U, 0x2c6aU, 0x1ef1U, 0x0f78U,
+	},
+	{
+		0x0000U, 0x19d8U, 0x33b0U, 0x2a68U, 0x6760U, 0x7eb8U, 0x54d0U, 0x4d08U,
+		0xcec0U, 0xd718U, 0xfd70U, 0xe4a8U, 0xa9a0U, 0xb078U, 0x9a10U, 0x83c8U,
+		0x9591U, 0x8c49U, 0xa621U, 0xbff9U, 0xf2f1U, 0xeb29U, 0xc141U, 0xd899U,
+		0x5b51U, 0x4289U, 0x68e1U, 0x7139U, 0x3c31U, 0x25e9U, 0x0f81U, 0x1659U,
+		0x2333U, 0x3aebU, 0x1083U, 0x095bU, 0x4453U, 0x5d8bU, 0x77e3U, 0x6e3bU,
+		0xedf3U, 0xf42bU, 0xde43U, 0xc79bU, 0x8a93U, 0x934bU, 0xb923U, 0xa0fbU,
+		0xb6a2U, 0xaf7aU, 0x8512U, 0x9ccaU, 0xd1c2U, 0xc81aU, 0xe272U, 0xfbaaU,
+		0x7862U, 0x61baU, 0x4bd2U, 0x520aU, 0x1f02U, 0x06daU, 0x2cb2U, 0x356aU,
+		0x4666U, 0x5fbeU, 0x75d6U, 0x6c0eU, 0x2106U, 0x38deU, 0x12b6U, 0x0b6eU,
+		0x88a6U, 0x917eU, 0xbb16U, 0xa2ceU, 0xefc6U, 0xf61eU, 0xdc76U, 0xc5aeU,
+		0xd3f7U, 0xca2fU, 0xe047U, 0xf99fU, 0xb497U, 0xad4fU, 0x8727U, 0x9effU,
+		0x1d37U, 0x04efU, 0x2e87U, 0x375fU, 0x7a57U, 0x638fU, 0x49e7U, 0x503fU,
+		0x6555U, 0x7c8dU, 0x56e5U, 0x4f3dU, 0x0235U, 0x1bedU, 0x3185U, 0x285dU,
+		0xab95U, 0xb24dU, 0x9825U, 0x81fdU, 0xccf5U, 0xd52dU, 0xff45U, 0xe69dU,
+		0xf0c4U, 0xe91cU, 0xc374U, 0xdaacU, 0x97a4U, 0x8e7cU, 0xa414U, 0xbdccU,
+		0x3e04U, 0x27dcU, 0x0db4U, 0x146cU, 0x5964U, 0x40bcU, 0x6ad4U, 0x730cU,
+		0x8cccU, 0x9514U, 0xbf7cU, 0xa6a4U, 0xebacU, 0xf274U, 0xd81cU, 0xc1c4U,
+		0x420cU, 0x5bd4U, 0x71bcU, 0x6864U, 0x256cU, 0x3cb4U, 0x16dcU, 0x0f04U,
+		0x195dU, 0x0085U, 0x2aedU, 0x3335U, 0x7e3dU, 0x67e5U, 0x4d8dU, 0x5455U,
+		0xd79dU, 0xce45U, 0xe42dU, 0xfdf5U, 0xb0fdU, 0xa925U, 0x834dU, 0x9a95U,
+		0xafffU, 0xb627U, 0x9c4fU, 0x8597U, 0xc89fU, 0xd147U, 0xfb2fU, 0xe2f7U,
+		0x613fU, 0x78e7U, 0x528fU, 0x4b57U, 0x065fU, 0x1f87U, 0x35efU, 0x2c37U,
+		0x3a6eU, 0x23b6U, 0x09deU, 0x1006U, 0x5d0eU, 0x44d6U, 0x6ebeU, 0x7766U,
+		0xf4aeU, 0xed76U, 0xc71eU, 0xdec6U, 0x93ceU, 0x8a16U, 0xa07eU, 0xb9a6U,
+		0xcaaaU, 0xd372U, 0xf91aU, 0xe0c2U, 0xadcaU, 0xb412U, 0x9e7aU, 0x87a2U,
+		0x046aU, 0x1db2U, 0x37daU, 0x2e02U, 0x630aU, 0x7ad2U, 0x50baU, 0x4962U,
+		0x5f3bU, 0x46e3U, 0x6c8bU, 0x7553U, 0x385bU, 0x2183U, 0x0bebU, 0x1233U,
+		0x91fbU, 0x8823U, 0xa24bU, 0xbb93U, 0xf69bU, 0xef43U, 0xc52bU, 0xdcf3U,
+		0xe999U, 0xf041U, 0xda29U, 0xc3f1U, 0x8ef9U, 0x9721U, 0xbd49U, 0xa491U,
+		0x2759U, 0x3e81U, 0x14e9U, 0x0d31U, 0x4039U, 0x59e1U, 0x7389U, 0x6a51U,
+		0x7c08U, 0x65d0U, 0x4fb8U, 0x5660U, 0x1b68U, 0x02b0U, 0x28d8U, 0x3100U,
+		0xb2c8U, 0xab10U, 0x8178U, 0x98a0U, 0xd5a8U, 0xcc70U, 0xe618U, 0xffc0U,
+	},
+	{
+		0x0000U, 0x5adcU, 0xb5b8U, 0xef64U, 0x6361U, 0x39bdU, 0xd6d9U, 0x8c05U,
+		0xc6c2U, 0x9c1eU, 0x737aU, 0x29a6U, 0xa5a3U, 0xff7fU, 0x101bU, 0x4ac7U,
+		0x8595U, 0xdf49U, 0x302dU, 0x6af1U, 0xe6f4U, 0xbc28U, 0x534cU, 0x0990U,
+		0x4357U, 0x198bU, 0xf6efU, 0xac33U, 0x2036U, 0x7aeaU, 0x958eU, 0xcf52U,
+		0x033bU, 0x59e7U, 0xb683U, 0xec5fU, 0x605aU, 0x3a86U, 0xd5e2U, 0x8f3eU,
+		0xc5f9U, 0x9f25U, 0x7041U, 0x2a9dU, 0xa698U, 0xfc44U, 0x1320U, 0x49fcU,
+		0x86aeU, 0xdc72U, 0x3316U, 0x69caU, 0xe5cfU, 0xbf13U, 0x5077U, 0x0aabU,
+		0x406cU, 0x1ab0U, 0xf5d4U, 0xaf08U, 0x230dU, 0x79d1U, 0x96b5U, 0xcc69U,
+		0x0676U, 0x5caaU, 0xb3ceU, 0xe912U, 0x6517U, 0x3fcbU, 0xd0afU, 0x8a73U,
+		0xc0b4U, 0x9a68U, 0x750cU, 0x2fd0U, 0xa3d5U, 0xf909U, 0x166dU, 0x4cb1U,
+		0x83e3U, 0xd93fU, 0x365bU, 0x6c87U, 0xe082U, 0xba5eU, 0x553aU, 0x0fe6U,
+		0x4521U, 0x1ffdU, 0xf099U, 0xaa45U, 0x2640U, 0x7c9cU, 0x93f8U, 0xc924U,
+		0x054dU, 0x5f91U, 0xb0f5U, 0xea29U, 0x662cU, 0x3cf0U, 0xd394U, 0x8948U,
+		0xc38fU, 0x9953U, 0x7637U, 0x2cebU, 0xa0eeU, 0xfa32U, 0x1556U, 0x4f8aU,
+		0x80d8U, 0xda04U, 0x3560U, 0x6fbcU, 0xe3b9U, 0xb965U, 0x5601U, 0x0cddU,
+		0x461aU, 0x1cc6U, 0xf3a2U, 0xa97eU, 0x257bU, 0x7fa7U, 0x90c3U, 0xca1fU,
+		0x0cecU, 0x5630U, 0xb954U, 0xe388U, 0x6f8dU, 0x3551U, 0xda35U, 0x80e9U,
+		0xca2eU, 0x90f2U, 0x7f96U, 0x254aU, 0xa94fU, 0xf393U, 0x1cf7U, 0x462bU,
+		0x8979U, 0xd3a5U, 0x3cc1U, 0x661dU, 0xea18U, 0xb0c4U, 0x5fa0U, 0x057cU,
+		0x4fbbU, 0x1567U, 0xfa03U, 0xa0dfU, 0x2cdaU, 0x7606U, 0x9962U, 0xc3beU,
+		0x0fd7U, 0x550bU, 0xba6fU, 0xe0b3U, 0x6cb6U, 0x366aU, 0xd90eU, 0x83d2U,
+		0xc915U, 0x93c9U, 0x7cadU, 0x2671U, 0xaa74U, 0xf0a8U, 0x1fccU, 0x4510U,
+		0x8a42U, 0xd09eU, 0x3ffaU, 0x6526U, 0xe923U, 0xb3ffU, 0x5c9bU, 0x0647U,
+		0x4c80U, 0x165cU, 0xf938U, 0xa3e4U, 0x2fe1U, 0x753dU, 0x9a59U, 0xc085U,
+		0x0a9aU, 0x5046U, 0xbf22U, 0xe5feU, 0x69fbU, 0x3327U, 0xdc43U, 0x869fU,
+		0xcc58U, 0x9684U, 0x79e0U, 0x233cU, 0xaf39U, 0xf5e5U, 0x1a81U, 0x405dU,
+		0x8f0fU, 0xd5d3U, 0x3ab7U, 0x606bU, 0xec6eU, 0xb6b2U, 0x59d6U, 0x030aU,
+		0x49cdU, 0x1311U, 0xfc75U, 0xa6a9U, 0x2aacU, 0x7070U, 0x9f14U, 0xc5c8U,
+		0x09a1U, 0x537dU, 0xbc19U, 0xe6c5U, 0x6ac0U, 0x301cU, 0xdf78U, 0x85a4U,
+		0xcf63U, 0x95bfU, 0x7adbU, 0x2007U, 0xac02U, 0xf6deU, 0x19baU, 0x4366U,
+		0x8c34U, 0xd6e8U, 0x398cU, 0x6350U, 0xef55U, 0xb589U, 0x5aedU, 0x0031U,
+		0x4af6U, 0x102aU, 0xff4eU, 0xa592U, 0x2997U, 0x734bU, 0x9c2fU, 0xc6f3U,
+	},
+	{
+		0x0000U, 0x1cbbU, 0x3976U, 0x25cdU, 0x72ecU, 0x6e57U, 0x4b9aU, 0x5721U,
+		0xe5d8U, 0xf963U, 0xdcaeU, 0xc015U, 0x9734U, 0x8b8fU, 0xae42U, 0xb2f9U,
+		0xc3a1U, 0xdf1aU, 0xfad7U, 0xe66cU, 0xb14dU, 0xadf6U, 0x883bU, 0x9480U,
+		0x2679U, 0x3ac2U, 0x1f0fU, 0x03b4U, 0x5495U, 0x482eU, 0x6de3U, 0x7158U,
+		0x8f53U, 0x93e8U, 0xb625U, 0xaa9eU, 0xfdbfU, 0xe104U, 0xc4c9U, 0xd872U,
+		0x6a8bU, 0x7630U, 0x53fdU, 0x4f46U, 0x1867U, 0x04dcU, 0x2111U, 0x3daaU,
+		0x4cf2U, 0x5049U, 0x7584U, 0x693fU, 0x3e1eU, 0x22a5U, 0x0768U, 0x1bd3U,
+		0xa92aU, 0xb591U, 0x905cU, 0x8ce7U, 0xdbc6U, 0xc77dU, 0xe2b0U, 0xfe0bU,
+		0x16b7U, 0x0a0cU, 0x2fc1U, 0x337aU, 0x645bU, 0x78e0U, 0x5d2dU, 0x4196U,
+		0xf36fU, 0xefd4U, 0xca19U, 0xd6a2U, 0x8183U, 0x9d38U, 0xb8f5U, 0xa44eU,
+		0xd516U, 0xc9adU, 0xec60U, 0xf0dbU, 0xa7faU, 0xbb41U, 0x9e8cU, 0x8237U,
+		0x30ceU, 0x2c75U, 0x09b8U, 0x1503U, 0x4222U, 0x5e99U, 0x7b54U, 0x67efU,
+		0x99e4U, 0x855fU, 0xa092U, 0xbc29U, 0xeb08U, 0xf7b3U, 0xd27eU, 0xcec5U,
+		0x7c3cU, 0x6087U, 0x454aU, 0x59f1U, 0x0ed0U, 0x126bU, 0x37a6U, 0x2b1dU,
+		0x5a45U, 0x46feU, 0x6333U, 0x7f88U, 0x28a9U, 0x3412U, 0x11dfU, 0x0d64U,
+		0xbf9dU, 0xa326U, 0x86ebU, 0x9a50U, 0xcd71U, 0xd1caU, 0xf407U, 0xe8bcU,
+		0x2d6eU, 0x31d5U, 0x1418U, 0x08a3U, 0x5f82U, 0x4339U, 0x66f4U, 0x7a4fU,
+		0xc8b6U, 0xd40dU, 0xf1c0U, 0xed7bU, 0xba5aU, 0xa6e1U, 0x832cU, 0x9f97U,
+		0xeecfU, 0xf274U, 0xd7b9U, 0xcb02U, 0x9c23U, 0x8098U, 0xa555U, 0xb9eeU,
+		0x0b17U, 0x17acU, 0x3261U, 0x2edaU, 0x79fbU, 0x6540U, 0x408dU, 0x5c36U,
+		0xa23dU, 0xbe86U, 0x9b4bU, 0x87f0U, 0xd0d1U, 0xcc6aU, 0xe9a7U, 0xf51cU,
+		0x47e5U, 0x5b5eU, 0x7e93U, 0x6228U, 0x3509U, 0x29b2U, 0x0c7fU, 0x10c4U,
+		0x619cU, 0x7d27U, 0x58eaU, 0x4451U, 0x1370U, 0x0fcbU, 0x2a06U, 0x36bdU,
+		0x8444U, 0x98ffU, 0xbd32U, 0xa189U, 0xf6a8U, 0xea13U, 0xcfdeU, 0xd365U,
+		0x3bd9U, 0x2762U, 0x02afU, 0x1e14U, 0x4935U, 0x558eU, 0x7043U, 0x6cf8U,
+		0xde01U, 0xc2baU, 0xe777U, 0xfbccU, 0xacedU, 0xb056U, 0x959bU, 0x8920U,
+		0xf878U, 0xe4c3U, 0xc10eU, 0xddb5U, 0x8a94U, 0x962fU, 0xb3e2U, 0xaf59U,
+		0x1da0U, 0x011bU, 0x24d6U, 0x386dU, 0x6f4cU, 0x73f7U, 0x563aU, 0x4a81U,
+		0xb48aU, 0xa831U, 0x8dfcU, 0x9147U, 0xc666U, 0xdaddU, 0xff10U, 0xe3abU,
+		0x5152U, 0x4de9U, 0x6824U, 0x749fU, 0x23beU, 0x3f05U, 0x1ac8U, 0x0673U,
+		0x772bU, 0x6b90U, 0x4e5dU, 0x52e6U, 0x05c7U, 0x197cU, 0x3cb1U, 0x200aU,
+		0x92f3U, 0x8e48U, 0xab85U, 0xb73eU, 0xe01fU, 0xfca4U, 0xd969U, 0xc5d2U,
+	},
+	{
+		0x0000U, 0x0b44U, 0x1688U, 0x1dccU, 0x2d10U, 0x2654U, 0x3b98U, 0x30dcU,
+		0x5a20U, 0x5164U, 0x4ca8U, 0x47ecU, 0x7730U, 0x7c74U, 0x61b8U, 0x6afcU,
+		0xb440U, 0xbf04U, 0xa2c8U, 0xa98cU, 0x9950U, 0x9214U, 0x8fd8U, 0x849cU,
+		0xee60U, 0xe524U, 0xf8e8U, 0xf3acU, 0xc370U, 0xc834U, 0xd5f8U, 0xdebcU,
+		0x6091U, 0x6bd5U, 0x7619U, 0x7d5dU, 0x4d81U, 0x46c5U, 0x5b09U, 0x504dU,
+		0x3ab1U, 0x31f5U, 0x2c39U, 0x277dU, 0x17a1U, 0x1ce5U, 0x0129U, 0x0a6dU,
+		0xd4d1U, 0xdf95U, 0xc259U, 0xc91dU, 0xf9c1U, 0xf285U, 0xef49U, 0xe40dU,
+		0x8ef1U, 0x85b5U, 0x9879U, 0x933dU, 0xa3e1U, 0xa8a5U, 0xb569U, 0xbe2dU,
+		0xc122U, 0xca66U, 0xd7aaU, 0xdceeU, 0xec32U, 0xe776U, 0xfabaU, 0xf1feU,
+		0x9b02U, 0x9046U, 0x8d8aU, 0x86ceU, 0xb612U, 0xbd56U, 0xa09aU, 0xabdeU,
+		0x7562U, 0x7e26U, 0x63eaU, 0x68aeU, 0x5872U, 0x5336U, 0x4efaU, 0x45beU,
+		0x2f42U, 0x2406U, 0x39caU, 0x328eU, 0x0252U, 0x0916U, 0x14daU, 0x1f9eU,
+		0xa1b3U, 0xaaf7U, 0xb73bU, 0xbc7fU, 0x8ca3U, 0x87e7U, 0x9a2bU, 0x916fU,
+		0xfb93U, 0xf0d7U, 0xed1bU, 0xe65fU, 0xd683U, 0xddc7U, 0xc00bU, 0xcb4fU,
+		0x15f3U, 0x1eb7U, 0x037bU, 0x083fU, 0x38e3U, 0x33a7U, 0x2e6bU, 0x252fU,
+		0x4fd3U, 0x4497U, 0x595bU, 0x521fU, 0x62c3U, 0x6987U, 0x744bU, 0x7f0fU,
+		0x8a55U, 0x8111U, 0x9cddU, 0x9799U, 0xa745U, 0xac01U, 0xb1cdU, 0xba89U,
+		0xd075U, 0xdb31U, 0xc6fdU, 0xcdb9U, 0xfd65U, 0xf621U, 0xebedU, 0xe0a9U,
+		0x3e15U, 0x3551U, 0x289dU, 0x23d9U, 0x1305U, 0x1841U, 0x058dU, 0x0ec9U,
+		0x6435U, 0x6f71U, 0x72bdU, 0x79f9U, 0x4925U, 0x4261U, 0x5fadU, 0x54e9U,
+		0xeac4U, 0xe180U, 0xfc4cU, 0xf708U, 0xc7d4U, 0xcc90U, 0xd15cU, 0xda18U,
+		0xb0e4U, 0xbba0U, 0xa66cU, 0xad28U, 0x9df4U, 0x96b0U, 0x8b7cU, 0x8038U,
+		0x5e84U, 0x55c0U, 0x480cU, 0x4348U, 0x7394U, 0x78d0U, 0x651cU, 0x6e58U,
+		0x04a4U, 0x0fe0U, 0x122cU, 0x1968U, 0x29b4U, 0x22f0U, 0x3f3cU, 0x3478U,
+		0x4b77U, 0x4033U, 0x5dffU, 0x56bbU, 0x6667U, 0x6d23U, 0x70efU, 0x7babU,
+		0x1157U, 0x1a13U, 0x07dfU, 0x0c9bU, 0x3c47U, 0x3703U, 0x2acfU, 0x218bU,
+		0xff37U, 0xf473U, 0xe9bfU, 0xe2fbU, 0xd227U, 0xd963U, 0xc4afU, 0xcfebU,
+		0xa517U, 0xae53U, 0xb39fU, 0xb8dbU, 0x8807U, 0x8343U, 0x9e8fU, 0x95cbU,
+		0x2be6U, 0x20a2U, 0x3d6eU, 0x362aU, 0x06f6U, 0x0db2U, 0x107eU, 0x1b3aU,
+		0x71c6U, 0x7a82U, 0x674eU, 0x6c0aU, 0x5cd6U, 0x5792U, 0x4a5eU, 0x411aU,
+		0x9fa6U, 0x94e2U, 0x892eU, 0x826aU, 0xb2b6U, 0xb9f2U, 0xa43eU, 0xaf7aU,
+		0xc586U, 0xcec2U, 0xd30eU, 0xd84aU, 0xe896U, 0xe3d2U, 0xfe1eU, 0xf55aU,
+	},
+	{
+		0x0000U, 0x042bU, 0x0856U, 0x0c7dU, 0x10acU, 0x1487U, 0x18faU, 0x1cd1U,
+		0x2158U, 0x2573U, 0x290eU, 0x2d25U, 0x31f4U, 0x35dfU, 0x39a2U, 0x3d89U,
+		0x42b0U, 0x469bU, 0x4ae6U, 0x4ecdU, 0x521cU, 0x5637U, 0x5a4aU, 0x5e61U,
+		0x63e8U, 0x67c3U, 0x6bbeU, 0x6f95U, 0x7344U, 0x776fU, 0x7b12U, 0x7f39U,
+		0x8560U, 0x814bU, 0x8d36U, 0x891dU, 0x95ccU, 0x91e7U, 0x9d9aU, 0x99b1U,
+		0xa438U, 0xa013U, 0xac6eU, 0xa845U, 0xb494U, 0xb0bfU, 0xbcc2U, 0xb8e9U,
+		0xc7d0U, 0xc3fbU, 0xcf86U, 0xcbadU, 0xd77cU, 0xd357U, 0xdf2aU, 0xdb01U,
+		0xe688U, 0xe2a3U, 0xeedeU, 0xeaf5U, 0xf624U, 0xf20fU, 0xfe72U, 0xfa59U,
+		0x02d1U, 0x06faU, 0x0a87U, 0x0eacU, 0x127dU, 0x1656U, 0x1a2bU, 0x1e00U,
+		0x2389U, 0x27a2U, 0x2bdfU, 0x2ff4U, 0x3325U, 0x370eU, 0x3b73U, 0x3f58U,
+		0x4061U, 0x444aU, 0x4837U, 0x4c1cU, 0x50cdU, 0x54e6U, 0x589bU, 0x5cb0U,
+		0x6139U, 0x6512U, 0x696fU, 0x6d44U, 0x7195U, 0x75beU, 0x79c3U, 0x7de8U,
+		0x87b1U, 0x839aU, 0x8fe7U, 0x8bccU, 0x971dU, 0x9336U, 0x9f4bU, 0x9b60U,
+		0xa6e9U, 0xa2c2U, 0xaebfU, 0xaa94U, 0xb645U, 0xb26eU, 0xbe13U, 0xba38U,
+		0xc501U, 0xc12aU, 0xcd57U, 0xc97cU, 0xd5adU, 0xd186U, 0xddfbU, 0xd9d0U,
+		0xe459U, 0xe072U, 0xec0fU, 0xe824U, 0xf4f5U, 0xf0deU, 0xfca3U, 0xf888U,
+		0x05a2U, 0x0189U, 0x0df4U, 0x09dfU, 0x150eU, 0x1125U, 0x1d58U, 0x1973U,
+		0x24faU, 0x20d1U, 0x2cacU, 0x2887U, 0x3456U, 0x307dU, 0x3c00U, 0x382bU,
+		0x4712U, 0x4339U, 0x4f44U, 0x4b6fU, 0x57beU, 0x5395U, 0x5fe8U, 0x5bc3U,
+		0x664aU, 0x6261U, 0x6e1cU, 0x6a37U, 0x76e6U, 0x72cdU, 0x7eb0U, 0x7a9bU,
+		0x80c2U, 0x84e9U, 0x8894U, 0x8cbfU, 0x906eU, 0x9445U, 0x9838U, 0x9c13U,
+		0xa19aU, 0xa5b1U, 0xa9ccU, 0xade7U, 0xb136U, 0xb51dU, 0xb960U, 0xbd4bU,
+		0xc272U, 0xc659U, 0xca24U, 0xce0fU, 0xd2deU, 0xd6f5U, 0xda88U, 0xdea3U,
+		0xe32aU, 0xe701U, 0xeb7cU, 0xef57U, 0xf386U, 0xf7adU, 0xfbd0U, 0xfffbU,
+		0x0773U, 0x0358U, 0x0f25U, 0x0b0eU, 0x17dfU, 0x13f4U, 0x1f89U, 0x1ba2U,
+		0x262bU, 0x2200U, 0x2e7dU, 0x2a56U, 0x3687U, 0x32acU, 0x3ed1U, 0x3afaU,
+		0x45c3U, 0x41e8U, 0x4d95U, 0x49beU, 0x556fU, 0x5144U, 0x5d39U, 0x5912U,
+		0x649bU, 0x60b0U, 0x6ccdU, 0x68e6U, 0x7437U, 0x701cU, 0x7c61U, 0x784aU,
+		0x8213U, 0x8638U, 0x8a45U, 0x8e6eU, 0x92bfU, 0x9694U, 0x9ae9U, 0x9ec2U,
+		0xa34bU, 0xa760U, 0xab1dU, 0xaf36U, 0xb3e7U, 0xb7ccU, 0xbbb1U, 0xbf9aU,
+		0xc0a3U, 0xc488U, 0xc8f5U, 0xccdeU, 0xd00fU, 0xd424U, 0xd859U, 0xdc72U,
+		0xe1fbU, 0xe5d0U, 0xe9adU, 0xed86U, 0xf157U, 0xf57cU, 0xf901U, 0xfd2aU,
+	},
+	{
+		0x0000U, 0x9fd5U, 0x37bbU, 0xa86eU, 0x6f76U, 0xf0a3U, 0x58cdU, 0xc718U,
+		0xdeecU, 0x4139U, 0xe957U, 0x7682U, 0xb19aU, 0x2e4fU, 0x8621U, 0x19f4U,
+		0xb5c9U, 0x2a1cU, 0x8272U, 0x1da7U, 0xdabfU, 0x456aU, 0xed04U, 0x72d1U,
+		0x6b25U, 0xf4f0U, 0x5c9eU, 0xc34bU, 0x0453U, 0x9b86U, 0x33e8U, 0xac3dU,
+		0x6383U, 0xfc56U, 0x5438U, 0xcbedU, 0x0cf5U, 0x9320U, 0x3b4eU, 0xa49bU,
+		0xbd6fU, 0x22baU, 0x8ad4U, 0x1501U, 0xd219U, 0x4dccU, 0xe5a2U, 0x7a77U,
+		0xd64aU, 0x499fU, 0xe1f1U, 0x7e24U, 0xb93cU, 0x26e9U, 0x8e87U, 0x1152U,
+		0x08a6U, 0x9773U, 0x3f1dU, 0xa0c8U, 0x67d0U, 0xf805U, 0x506bU, 0xcfbeU,
+		0xc706U, 0x58d3U, 0xf0bdU, 0x6f68U, 0xa870U, 0x37a5U, 0x9fcbU, 0x001eU,
+		0x19eaU, 0x863fU, 0x2e51U, 0xb184U, 0x769cU, 0xe949U, 0x4127U, 0xdef2U,
+		0x72cfU, 0xed1aU, 0x4574U, 0xdaa1U, 0x1db9U, 0x826cU, 0x2a02U, 0xb5d7U,
+		0xac23U, 0x33f6U, 0x9b98U, 0x044dU, 0xc355U, 0x5c80U, 0xf4eeU, 0x6b3bU,
+		0xa485U, 0x3b50U, 0x933eU, 0x0cebU, 0xcbf3U, 0x5426U, 0xfc48U, 0x639dU,
+		0x7a69U, 0xe5bcU, 0x4dd2U, 0xd207U, 0x151fU, 0x8acaU, 0x22a4U, 0xbd71U,
+		0x114cU, 0x8e99U, 0x26f7U, 0xb922U, 0x7e3aU, 0xe1efU, 0x4981U, 0xd654U,
+		0xcfa0U, 0x5075U, 0xf81bU, 0x67ceU, 0xa0d6U, 0x3f03U, 0x976dU, 0x08b8U,
+		0x861dU, 0x19c8U, 0xb1a6U, 0x2e73U, 0xe96bU, 0x76beU, 0xded0U, 0x4105U,
+		0x58f1U, 0xc724U, 0x6f4aU, 0xf09fU, 0x3787U, 0xa852U, 0x003cU, 0x9fe9U,
+		0x33d4U, 0xac01U, 0x046fU, 0x9bbaU, 0x5ca2U, 0xc377U, 0x6b19U, 0xf4ccU,
+		0xed38U, 0x72edU, 0xda83U, 0x4556U, 0x824eU, 0x1d9bU, 0xb5f5U, 0x2a20U,
+		0xe59eU, 0x7a4bU, 0xd225U, 0x4df0U, 0x8ae8U, 0x153dU, 0xbd53U, 0x2286U,
+		0x3b72U, 0xa4a7U, 0x0cc9U, 0x931cU, 0x5404U, 0xcbd1U, 0x63bfU, 0xfc6aU,
+		0x5057U, 0xcf82U, 0x67ecU, 0xf839U, 0x3f21U, 0xa0f4U, 0x089aU, 0x974fU,
+		0x8ebbU, 0x116eU, 0xb900U, 0x26d5U, 0xe1cdU, 0x7e18U, 0xd676U, 0x49a3U,
+		0x411bU, 0xdeceU, 0x76a0U, 0xe975U, 0x2e6dU, 0xb1b8U, 0x19d6U, 0x8603U,
+		0x9ff7U, 0x0022U, 0xa84cU, 0x3799U, 0xf081U, 0x6f54U, 0xc73aU, 0x58efU,
+		0xf4d2U, 0x6b07U, 0xc369U, 0x5cbcU, 0x9ba4U, 0x0471U, 0xac1fU, 0x33caU,
+		0x2a3eU, 0xb5ebU, 0x1d85U, 0x8250U, 0x4548U, 0xda9dU, 0x72f3U, 0xed26U,
+		0x2298U, 0xbd4dU, 0x1523U, 0x8af6U, 0x4deeU, 0xd23bU, 0x7a55U, 0xe580U,
+		0xfc74U, 0x63a1U, 0xcbcfU, 0x541aU, 0x9302U, 0x0cd7U, 0xa4b9U, 0x3b6cU,
+		0x9751U, 0x0884U, 0xa0eaU, 0x3f3fU, 0xf827U, 0x67f2U, 0xcf9cU, 0x5049U,
+		0x49bdU, 0xd668U, 0x7e06U, 0xe1d3U, 0x26cbU, 0xb91eU, 0x1170U, 0x8ea5U,
+	},
+	{
+		0x0000U, 0x81bfU, 0x0b6fU, 0x8ad0U, 0x16deU, 0x9761U, 0x1db1U, 0x9c0eU,
+		0x2dbcU, 0xac03U, 0x26d3U, 0xa76cU, 0x3b62U, 0xbaddU, 0x300dU, 0xb1b2U,
+		0x5b78U, 0xdac7U, 0x5017U, 0xd1a8U, 0x4da6U, 0xcc19U, 0x46c9U, 0xc776U,
+		0x76c4U, 0xf77bU, 0x7dabU, 0xfc14U, 0x601aU, 0xe1a5U, 0x6b75U, 0xeacaU,
+		0xb6f0U, 0x374fU, 0xbd9fU, 0x3c20U, 0xa02eU, 0x2191U, 0xab41U, 0x2afeU,
+		0x9b4cU, 0x1af3U, 0x9023U, 0x119cU, 0x8d92U, 0x0c2dU, 0x86fdU, 0x0742U,
+		0xed88U, 0x6c37U, 0xe6e7U, 0x6758U, 0xfb56U, 0x7ae9U, 0xf039U, 0x7186U,
+		0xc034U, 0x418bU, 0xcb5bU, 0x4ae4U, 0xd6eaU, 0x5755U, 0xdd85U, 0x5c3aU,
+		0x65f1U, 0xe44eU, 0x6e9eU, 0xef21U, 0x732fU, 0xf290U, 0x7840U, 0xf9ffU,
+		0x484dU, 0xc9f2U, 0x4322U, 0xc29dU, 0x5e93U, 0xdf2cU, 0x55fcU, 0xd443U,
+		0x3e89U, 0xbf36U, 0x35e6U, 0xb459U, 0x2857U, 0xa9e8U, 0x2338U, 0xa287U,
+		0x1335U, 0x928aU, 0x185aU, 0x99e5U, 0x05ebU, 0x8454U, 0x0e84U, 0x8f3bU,
+		0xd301U, 0x52beU, 0xd86eU, 0x59d1U, 0xc5dfU, 0x4460U, 0xceb0U, 0x4f0fU,
+		0xfebdU, 0x7f02U, 0xf5d2U, 0x746dU, 0xe863U, 0x69dcU, 0xe30cU, 0x62b3U,
+		0x8879U, 0x09c6U, 0x8316U, 0x02a9U, 0x9ea7U, 0x1f18U, 0x95c8U, 0x1477U,
+		0xa5c5U, 0x247aU, 0xaeaaU, 0x2f15U, 0xb31bU, 0x32a4U, 0xb874U, 0x39cbU,
+		0xcbe2U, 0x4a5dU, 0xc08dU, 0x4132U, 0xdd3cU, 0x5c83U, 0xd653U, 0x57ecU,
+		0xe65eU, 0x67e1U, 0xed31U, 0x6c8eU, 0xf080U, 0x713fU, 0xfbefU, 0x7a50U,
+		0x909aU, 0x1125U, 0x9bf5U, 0x1a4aU, 0x8644U, 0x07fbU, 0x8d2bU, 0x0c94U,
+		0xbd26U, 0x3c99U, 0xb649U, 0x37f6U, 0xabf8U, 0x2a47U, 0xa097U, 0x2128U,
+		0x7d12U, 0xfcadU, 0x767dU, 0xf7c2U, 0x6bccU, 0xea73U, 0x60a3U, 0xe11cU,
+		0x50aeU, 0xd111U, 0x5bc1U, 0xda7eU, 0x4670U, 0xc7cfU, 0x4d1fU, 0xcca0U,
+		0x266aU, 0xa7d5U, 0x2d05U, 0xacbaU, 0x30b4U, 0xb10bU, 0x3bdbU, 0xba64U,
+		0x0bd6U, 0x8a69U, 0x00b9U, 0x8106U, 0x1d08U, 0x9cb7U, 0x1667U, 0x97d8U,
+		0xae13U, 0x2facU, 0xa57cU, 0x24c3U, 0xb8cdU, 0x3972U, 0xb3a2U, 0x321dU,
+		0x83afU, 0x0210U, 0x88c0U, 0x097fU, 0x9571U, 0x14ceU, 0x9e1eU, 0x1fa1U,
+		0xf56bU, 0x74d4U, 0xfe04U, 0x7fbbU, 0xe3b5U, 0x620aU, 0xe8daU, 0x6965U,
+		0xd8d7U, 0x5968U, 0xd3b8U, 0x5207U, 0xce09U, 0x4fb6U, 0xc566U, 0x44d9U,
+		0x18e3U, 0x995cU, 0x138cU, 0x9233U, 0x0e3dU, 0x8f82U, 0x0552U, 0x84edU,
+		0x355fU, 0xb4e0U, 0x3e30U, 0xbf8fU, 0x2381U, 0xa23eU, 0x28eeU, 0xa951U,
+		0x439bU, 0xc224U, 0x48f4U, 0xc94bU, 0x5545U, 0xd4faU, 0x5e2aU, 0xdf95U,
+		0x6e27U, 0xef98U, 0x6548U, 0xe4f7U, 0x78f9U, 0xf946U, 0x7396U, 0xf229U,
+	},
+};
+
+/* Slicing-by-8 tables for polynomial 0x1021 (ITU-T) */
+static const uint16_t crc16_itu_t_slice8[8][256] = {
+	{
+		0x0000U, 0x1021U, 0x2042U, 0x3063U, 0x4084U, 0x50a5U, 0x60c6U, 0x70e7U,
+		0x8108U, 0x9129U, 0xa14aU, 0xb16bU, 0xc18cU, 0xd1adU, 0xe1ceU, 0xf1efU,
+		0x1231U, 0x0210U, 0x3273U, 0x2252U, 0x52b5U, 0x4294U, 0x72f7U, 0x62d6U,
+		0x9339U, 0x8318U, 0xb37bU, 0xa35aU, 0xd3bdU, 0xc39cU, 0xf3ffU, 0xe3deU,
+		0x2462U, 0x3443U, 0x0420U, 0x1401U, 0x64e6U, 0x74c7U, 0x44a4U, 0x5485U,
+		0xa56aU, 0xb54bU, 0x8528U, 0x9509U, 0xe5eeU, 0xf5cfU, 0xc5acU, 0xd58dU,
+		0x3653U, 0x2672U, 0x1611U, 0x0630U, 0x76d7U, 0x66f6U, 0x5695U, 0x46b4U,
+		0xb75bU, 0xa77aU, 0x9719U, 0x8738U, 0xf7dfU, 0xe7feU, 0xd79dU, 0xc7bcU,
+		0x48c4U, 0x58e5U, 0x6886U, 0x78a7U, 0x0840U, 0x1861U, 0x2802U, 0x3823U,
+		0xc9ccU, 0xd9edU, 0xe98eU, 0xf9afU, 0x8948U, 0x9969U, 0xa90aU, 0xb92bU,
+		0x5af5U, 0x4ad4U, 0x7ab7U, 0x6a96U, 0x1a71U, 0x0a50U, 0x3a33U, 0x2a12U,
+		0xdbfdU, 0xcbdcU, 0xfbbfU, 0xeb9eU, 0x9b79U, 0x8b58U, 0xbb3bU, 0xab1aU,
+		0x6ca6U, 0x7c87U, 0x4ce4U, 0x5cc5U, 0x2c22U, 0x3c03U, 0x0c60U, 0x1c41U,
+		0xedaeU, 0xfd8fU, 0xcdecU, 0xddcdU, 0xad2aU, 0xbd0bU, 0x8d68U, 0x9d49U,
+		0x7e97U, 0x6eb6U, 0x5ed5U, 0x4ef4U, 0x3e13U, 0x2e32U, 0x1e51U, 0x0e70U,
+		0xff9fU, 0xefbeU, 0xdfddU, 0xcffcU, 0xbf1bU, 0xaf3aU, 0x9f59U, 0x8f78U,
+		0x9188U, 0x81a9U, 0xb1caU, 0xa1ebU, 0xd10cU, 0xc12dU, 0xf14eU, 0xe16fU,
+		0x1080U, 0x00a1U, 0x30c2U, 0x20e3U, 0x5004U, 0x4025U, 0x7046U, 0x6067U,
+		0x83b9U, 0x9398U, 0xa3fbU, 0xb3daU, 0xc33dU, 0xd31cU, 0xe37fU, 0xf35eU,
+		0x02b1U, 0x1290U, 0x22f3U, 0x32d2U, 0x4235U, 0x5214U, 0x6277U, 0x7256U,
+		0xb5eaU, 0xa5cbU, 0x95a8U, 0x8589U, 0xf56eU, 0xe54fU, 0xd52cU, 0xc50dU,
+		0x34e2U, 0x24c3U, 0x14a0U, 0x0481U, 0x7466U, 0x6447U, 0x5424U, 0x4405U,
+		0xa7dbU, 0xb7faU, 0x8799U, 0x97b8U, 0xe75fU, 0xf77eU, 0xc71dU, 0xd73cU,
+		0x26d3U, 0x36f2U, 0x0691U, 0x16b0U, 0x6657U, 0x7676U, 0x4615U, 0x5634U,
+		0xd94cU, 0xc96dU, 0xf90eU, 0xe92fU, 0x99c8U, 0x89e9U, 0xb98aU, 0xa9abU,
+		0x5844U, 0x4865U, 0x7806U, 0x6827U, 0x18c0U, 0x08e1U, 0x3882U, 0x28a3U,
+		0xcb7dU, 0xdb5cU, 0xeb3fU, 0xfb1eU, 0x8bf9U, 0x9bd8U, 0xabbbU, 0xbb9aU,
+		0x4a75U, 0x5a54U, 0x6a37U, 0x7a16U, 0x0af1U, 0x1ad0U, 0x2ab3U, 0x3a92U,
+		0xfd2eU, 0xed0fU, 0xdd6cU, 0xcd4dU, 0xbdaaU, 0xad8bU, 0x9de8U, 0x8dc9U,
+		0x7c26U, 0x6c07U, 0x5c64U, 0x4c45U, 0x3ca2U, 0x2c83U, 0x1ce0U, 0x0cc1U,
+		0xef1fU, 0xff3eU, 0xcf5dU, 0xdf7cU, 0xaf9bU, 0xbfbaU, 0x8fd9U, 0x9ff8U,
+		0x6e17U, 0x7e36U, 0x4e55U, 0x5e74U, 0x2e93U, 0x3eb2U, 0x0ed1U, 0x1ef0U,
+	},
+	{
+		0x0000U, 0x3331U, 0x6662U, 0x5553U, 0xccc4U, 0xfff5U, 0xaaa6U, 0x9997U,
+		0x89a9U, 0xba98U, 0xefcbU, 0xdcfaU, 0x456dU, 0x765cU, 0x230fU, 0x103eU,
+		0x0373U, 0x3042U, 0x6511U, 0x5620U, 0xcfb7U, 0xfc86U, 0xa9d5U, 0x9ae4U,
+		0x8adaU, 0xb9ebU, 0xecb8U, 0xdf89U, 0x461eU, 0x752fU, 0x207cU, 0x134dU,
+		0x06e6U, 0x35d7U, 0x6084U, 0x53b5U, 0xca22U, 0xf913U, 0xac40U, 0x9f71U,
+		0x8f4fU, 0xbc7eU, 0xe92dU, 0xda1cU, 0x438bU, 0x70baU, 0x25e9U, 0x16d8U,
+		0x0595U, 0x36a4U, 0x63f7U, 0x50c6U, 0xc951U, 0xfa60U, 0xaf33U, 0x9c02U,
+		0x8c3cU, 0xbf0dU, 0xea5eU, 0xd96fU, 0x40f8U, 0x73c9U, 0x269aU, 0x15abU,
+		0x0dccU, 0x3efdU, 0x6baeU, 0x589fU, 0xc108U, 0xf239U, 0xa76aU, 0x945bU,
+		0x8465U, 0xb754U, 0xe207U, 0xd136U, 0x48a1U, 0x7b90U, 0x2ec3U, 0x1df2U,
+		0x0ebfU, 0x3d8eU, 0x68ddU, 0x5becU, 0xc27bU, 0xf14aU, 0xa419U, 0x9728U,
+		0x8716U, 0xb427U, 0xe174U, 0xd245U, 0x4bd2U, 0x78e3U, 0x2db0U, 0x1e81U,
+		0x0b2aU, 0x381bU, 0x6d48U, 0x5e79U, 0xc7eeU, 0xf4dfU, 0xa18cU, 0x92bdU,
+		0x8283U, 0xb1b2U, 0xe4e1U, 0xd7d0U, 0x4e47U, 0x7d76U, 0x2825U, 0x1b14U,
+		0x0859U, 0x3b68U, 0x6e3bU, 0x5d0aU, 0xc49dU, 0xf7acU, 0xa2ffU, 0x91ceU,
+		0x81f0U, 0xb2c1U, 0xe792U, 0xd4a3U, 0x4d34U, 0x7e05U, 0x2b56U, 0x1867U,
+		0x1b98U, 0x28a9U, 0x7dfaU, 0x4ecbU, 0xd75cU, 0xe46dU, 0xb13eU, 0x820fU,
+		0x9231U, 0xa100U, 0xf453U, 0xc762U, 0x5ef5U, 0x6dc4U, 0x3897U, 0x0ba6U,
+		0x18ebU, 0x2bdaU, 0x7e89U, 0x4db8U, 0xd42fU, 0xe71eU, 0xb24dU, 0x817cU,
+		0x9142U, 0xa273U, 0xf720U, 0xc411U, 0x5d86U, 0x6eb7U, 0x3be4U, 0x08d5U,
+		0x1d7eU, 0x2e4fU, 0x7b1cU, 0x482dU, 0xd1baU, 0xe28bU, 0xb7d8U, 0x84e9U,
+		0x94d7U, 0xa7e6U, 0xf2b5U, 0xc184U, 0x5813U, 0x6b22U, 0x3e71U, 0x0d40U,
+		0x1e0dU, 0x2d3cU, 0x786fU, 0x4b5eU, 0xd2c9U, 0xe1f8U, 0xb4abU, 0x879aU,
+		0x97a4U, 0xa495U, 0xf1c6U, 0xc2f7U, 0x5b60U, 0x6851U, 0x3d02U, 0x0e33U,
+		0x1654U, 0x2565U, 0x7036U, 0x4307U, 0xda90U, 0xe9a1U, 0xbcf2U, 0x8fc3U,
+		0x9ffdU, 0xacccU, 0xf99fU, 0xcaaeU, 0x5339U, 0x6008U, 0x355bU, 0x066aU,
+		0x1527U, 0x2616U, 0x7345U, 0x4074U, 0xd9e3U, 0xead2U, 0xbf81U, 0x8cb0U,
+		0x9c8eU, 0xafbfU, 0xfaecU, 0xc9ddU, 0x504aU, 0x637bU, 0x3628U, 0x0519U,
+		0x10b2U, 0x2383U, 0x76d0U, 0x45e1U, 0xdc76U, 0xef47U, 0xba14U, 0x8925U,
+		0x991bU, 0xaa2aU, 0xff79U, 0xcc48U, 0x55dfU, 0x66eeU, 0x33bdU, 0x008cU,
+		0x13c1U, 0x20f0U, 0x75a3U, 0x4692U, 0xdf05U, 0xec34U, 0xb967U, 0x8a56U,
+		0x9a68U, 0xa959U, 0xfc0aU, 0xcf3bU, 0x56acU, 0x659dU, 0x30ceU, 0x03ffU,
+	},
+	{
+		0x0000U, 0x3730U, 0x6e60U, 0x5950U, 0xdcc0U, 0xebf0U, 0xb2a0U, 0x8590U,
+		0xa9a1U, 0x9e91U, 0xc7c1U, 0xf0f1U, 0x7561U, 0x4251U, 0x1b01U, 0x2c31U,
+		0x4363U, 0x7453U, 0x2d03U, 0x1a33U, 0x9fa3U, 0xa893U, 0xf1c3U, 0xc6f3U,
+		0xeac2U, 0xddf2U, 0x84a2U, 0xb392U, 0x3602U, 0x0132U, 0x5862U, 0x6f52U,
+		0x86c6U, 0xb1f6U, 0xe8a6U, 0xdf96U, 0x5a06U, 0x6d36U, 0x3466U, 0x0356U,
+		0x2f67U, 0x1857U, 0x4107U, 0x7637U, 0xf3a7U, 0xc497U, 0x9dc7U, 0xaaf7U,
+		0xc5a5U, 0xf295U, 0xabc5U, 0x9cf5U, 0x1965U, 0x2e55U, 0x7705U, 0x4035U,
+		0x6c04U, 0x5b34U, 0x0264U, 0x3554U, 0xb0c4U, 0x87f4U, 0xdea4U, 0xe994U,
+		0x1dadU, 0x2a9dU, 0x73cdU, 0x44fdU, 0xc16dU, 0xf65dU, 0xaf0dU, 0x983dU,
+		0xb40cU, 0x833cU, 0xda6cU, 0xed5cU, 0x68ccU, 0x5ffcU, 0x06acU, 0x319cU,
+		0x5eceU, 0x69feU, 0x30aeU, 0x079eU, 0x820eU, 0xb53eU, 0xec6eU, 0xdb5eU,
+		0xf76fU, 0xc05fU, 0x990fU, 0xae3fU, 0x2bafU, 0x1c9fU, 0x45cfU, 0x72ffU,
+		0x9b6bU, 0xac5bU, 0xf50bU, 0xc23bU, 0x47abU, 0x709bU, 0x29cbU, 0x1efbU,
+		0x32caU, 0x05faU, 0x5caaU, 0x6b9aU, 0xee0aU, 0xd93aU, 0x806aU, 0xb75aU,
+		0xd808U, 0xef38U, 0xb668U, 0x8158U, 0x04c8U, 0x33f8U, 0x6aa8U, 0x5d98U,
+		0x71a9U, 0x4699U, 0x1fc9U, 0x28f9U, 0xad69U, 0x9a59U, 0xc309U, 0xf439U,
+		0x3b5aU, 0x0c6aU, 0x553aU, 0x620aU, 0xe79aU, 0xd0aaU, 0x89faU, 0xbecaU,
+		0x92fbU, 0xa5cbU, 0xfc9bU, 0xcbabU, 0x4e3bU, 0x790bU, 0x205bU, 0x176bU,
+		0x7839U, 0x4f09U, 0x1659U, 0x2169U, 0xa4f9U, 0x93c9U, 0xca99U, 0xfda9U,
+		0xd198U, 0xe6a8U, 0xbff8U, 0x88c8U, 0x0d58U, 0x3a68U, 0x6338U, 0x5408U,
+		0xbd9cU, 0x8aacU, 0xd3fcU, 0xe4ccU, 0x615cU, 0x566cU, 0x0f3cU, 0x380cU,
+		0x143dU, 0x230dU, 0x7a5dU, 0x4d6dU, 0xc8fdU, 0xffcdU, 0xa69dU, 0x91adU,
+		0xfeffU, 0xc9cfU, 0x909fU, 0xa7afU, 0x223fU, 0x150fU, 0x4c5fU, 0x7b6fU,
+		0x575eU, 0x606eU, 0x393eU, 0x0e0eU, 0x8b9eU, 0xbcaeU, 0xe5feU, 0xd2ceU,
+		0x26f7U, 0x11c7U, 0x4897U, 0x7fa7U, 0xfa37U, 0xcd07U, 0x9457U, 0xa367U,
+		0x8f56U, 0xb866U, 0xe136U, 0xd606U, 0x5396U, 0x64a6U, 0x3df6U, 0x0ac6U,
+		0x6594U, 0x52a4U, 0x0bf4U, 0x3cc4U, 0xb954U, 0x8e64U, 0xd734U, 0xe004U,
+		0xcc35U, 0xfb05U, 0xa255U, 0x9565U, 0x10f5U, 0x27c5U, 0x7e95U, 0x49a5U,
+		0xa031U, 0x9701U, 0xce51U, 0xf961U, 0x7cf1U, 0x4bc1U, 0x1291U, 0x25a1U,
+		0x0990U, 0x3ea0U, 0x67f0U, 0x50c0U, 0xd550U, 0xe260U, 0xbb30U, 0x8c00U,
+		0xe352U, 0xd462U, 0x8d32U, 0xba02U, 0x3f92U, 0x08a2U, 0x51f2U, 0x66c2U,
+		0x4af3U, 0x7dc3U, 0x2493U, 0x13a3U, 0x9633U, 0xa103U, 0xf853U, 0xcf63U,
+	},
+	{
+		0x0000U, 0x76b4U, 0xed68U, 0x9bdcU, 0xcaf1U, 0xbc45U, 0x2799U, 0x512dU,
+		0x85c3U, 0xf377U, 0x68abU, 0x1e1fU, 0x4f32U, 0x3986U, 0xa25aU, 0xd4eeU,
+		0x1ba7U, 0x6d13U, 0xf6cfU, 0x807bU, 0xd156U, 0xa7e2U, 0x3c3eU, 0x4a8aU,
+		0x9e64U, 0xe8d0U, 0x730cU, 0x05b8U, 0x5495U, 0x2221U, 0xb9fdU, 0xcf49U,
+		0x374eU, 0x41faU, 0xda26U, 0xac92U, 0xfdbfU, 0x8b0bU, 0x10d7U, 0x6663U,
+		0xb28dU, 0xc439U, 0x5fe5U, 0x2951U, 0x787cU, 0x0ec8U, 0x9514U, 0xe3a0U,
+		0x2ce9U, 0x5a5dU, 0xc181U, 0xb735U, 0xe618U, 0x90acU, 0x0b70U, 0x7dc4U,
+		0xa92aU, 0xdf9eU, 0x4442U, 0x32f6U, 0x63dbU, 0x156fU, 0x8eb3U, 0xf807U,
+		0x6e9cU, 0x1828U, 0x83f4U, 0xf540U, 0xa46dU, 0xd2d9U, 0x4905U, 0x3fb1U,
+		0xeb5fU, 0x9debU, 0x0637U, 0x7083U, 0x21aeU, 0x571aU, 0xccc6U, 0xba72U,
+		0x753bU, 0x038fU, 0x9853U, 0xeee7U, 0xbfcaU, 0xc97eU, 0x52a2U, 0x2416U,
+		0xf0f8U, 0x864cU, 0x1d90U, 0x6b24U, 0x3a09U, 0x4cbdU, 0xd761U, 0xa1d5U,
+		0x59d2U, 0x2f66U, 0xb4baU, 0xc20eU, 0x9323U, 0xe597U, 0x7e4bU, 0x08ffU,
+		0xdc11U, 0xaaa5U, 0x3179U, 0x47cdU, 0x16e0U, 0x6054U, 0xfb88U, 0x8d3cU,
+		0x4275U, 0x34c1U, 0xaf1dU, 0xd9a9U, 0x8884U, 0xfe30U, 0x65ecU, 0x1358U,
+		0xc7b6U, 0xb102U, 0x2adeU, 0x5c6aU, 0x0d47U, 0x7bf3U, 0xe02fU, 0x969bU,
+		0xdd38U, 0xab8cU, 0x3050U, 0x46e4U, 0x17c9U, 0x617dU, 0xfaa1U, 0x8c15U,
+		0x58fbU, 0x2e4fU, 0xb593U, 0xc327U, 0x920aU, 0xe4beU, 0x7f62U, 0x09d6U,
+		0xc69fU, 0xb02bU, 0x2bf7U, 0x5d43U, 0x0c6eU, 0x7adaU, 0xe106U, 0x97b2U,
+		0x435cU, 0x35e8U, 0xae34U, 0xd880U, 0x89adU, 0xff19U, 0x64c5U, 0x1271U,
+		0xea76U, 0x9cc2U, 0x071eU, 0x71aaU, 0x2087U, 0x5633U, 0xcdefU, 0xbb5bU,
+		0x6fb5U, 0x1901U, 0x82ddU, 0xf469U, 0xa544U, 0xd3f0U, 0x482cU, 0x3e98U,
+		0xf1d1U, 0x8765U, 0x1cb9U, 0x6a0dU, 0x3b20U, 0x4d94U, 0xd648U, 0xa0fcU,
+		0x7412U, 0x02a6U, 0x997aU, 0xefceU, 0xbee3U, 0xc857U, 0x538bU, 0x253fU,
+		0xb3a4U, 0xc510U, 0x5eccU, 0x2878U, 0x7955U, 0x0fe1U, 0x943dU, 0xe289U,
+		0x3667U, 0x40d3U, 0xdb0fU, 0xadbbU, 0xfc96U, 0x8a22U, 0x11feU, 0x674aU,
+		0xa803U, 0xdeb7U, 0x456bU, 0x33dfU, 0x62f2U, 0x1446U, 0x8f9aU, 0xf92eU,
+		0x2dc0U, 0x5b74U, 0xc0a8U, 0xb61cU, 0xe731U, 0x9185U, 0x0a59U, 0x7cedU,
+		0x84eaU, 0xf25eU, 0x6982U, 0x1f36U, 0x4e1bU, 0x38afU, 0xa373U, 0xd5c7U,
+		0x0129U, 0x779dU, 0xec41U, 0x9af5U, 0xcbd8U, 0xbd6cU, 0x26b0U, 0x5004U,
+		0x9f4dU, 0xe9f9U, 0x7225U, 0x0491U, 0x55bcU, 0x2308U, 0xb8d4U, 0xce60U,
+		0x1a8eU, 0x6c3aU, 0xf7e6U, 0x8152U, 0xd07fU, 0xa6cbU, 0x3d17U, 0x4ba3U,
+	},
+	{
+		0x0000U, 0xaa51U, 0x4483U, 0xeed2U, 0x8906U, 0x2357U, 0xcd85U, 0x67d4U,
+		0x022dU, 0xa87cU, 0x46aeU, 0xecffU, 0x8b2bU, 0x217aU, 0xcfa8U, 0x65f9U,
+		0x045aU, 0xae0bU, 0x40d9U, 0xea88U, 0x8d5cU, 0x270dU, 0xc9dfU, 0x638eU,
+		0x0677U, 0xac26U, 0x42f4U, 0xe8a5U, 0x8f71U, 0x2520U, 0xcbf2U, 0x61a3U,
+		0x08b4U, 0xa2e5U, 0x4c37U, 0xe666U, 0x81b2U, 0x2be3U, 0xc531U, 0x6f60U,
+		0x0a99U, 0xa0c8U, 0x4e1aU, 0xe44bU, 0x839fU, 0x29ceU, 0xc71cU, 0x6d4dU,
+		0x0ceeU, 0xa6bfU, 0x486dU, 0xe23cU, 0x85e8U, 0x2fb9U, 0xc16bU, 0x6b3aU,
+		0x0ec3U, 0xa492U, 0x4a40U, 0xe011U, 0x87c5U, 0x2d94U, 0xc346U, 0x6917U,
+		0x1168U, 0xbb39U, 0x55ebU, 0xffbaU, 0x986eU, 0x323fU, 0xdcedU, 0x76bcU,
+		0x1345U, 0xb914U, 0x57c6U, 0xfd97U, 0x9a43U, 0x3012U, 0xdec0U, 0x7491U,
+		0x1532U, 0xbf63U, 0x51b1U, 0xfbe0U, 0x9c34U, 0x3665U, 0xd8b7U, 0x72e6U,
+		0x171fU, 0xbd4eU, 0x539cU, 0xf9cdU, 0x9e19U, 0x3448U, 0xda9aU, 0x70cbU,
+		0x19dcU, 0xb38dU, 0x5d5fU, 0xf70eU, 0x90daU, 0x3a8bU, 0xd459U, 0x7e08U,
+		0x1bf1U, 0xb1a0U, 0x5f72U, 0xf523U, 0x92f7U, 0x38a6U, 0xd674U, 0x7c25U,
+		0x1d86U, 0xb7d7U, 0x5905U, 0xf354U, 0x9480U, 0x3ed1U, 0xd003U, 0x7a52U,
+		0x1fabU, 0xb5faU, 0x5b28U, 0xf179U, 0x96adU, 0x3cfcU, 0xd22eU, 0x787fU,
+		0x22d0U, 0x8881U, 0x6653U, 0xcc02U, 0xabd6U, 0x0187U, 0xef55U, 0x4504U,
+		0x20fdU, 0x8aacU, 0x647eU, 0xce2fU, 0xa9fbU, 0x03aaU, 0xed78U, 0x4729U,
+		0x268aU, 0x8cdbU, 0x6209U, 0xc858U, 0xaf8cU, 0x05ddU, 0xeb0fU, 0x415eU,
+		0x24a7U, 0x8ef6U, 0x6024U, 0xca75U, 0xada1U, 0x07f0U, 0xe922U, 0x4373U,
+		0x2a64U, 0x8035U, 0x6ee7U, 0xc4b6U, 0xa362U, 0x0933U, 0xe7e1U, 0x4db0U,
+		0x2849U, 0x8218U, 0x6ccaU, 0xc69bU, 0xa14fU, 0x0b1eU, 0xe5ccU, 0x4f9dU,
+		0x2e3eU, 0x846fU, 0x6abdU, 0xc0ecU, 0xa738U, 0x0d69U, 0xe3bbU, 0x49eaU,
+		0x2c13U, 0x8642U, 0x6890U, 0xc2c1U, 0xa515U, 0x0f44U, 0xe196U, 0x4bc7U,
+		0x33b8U, 0x99e9U, 0x773bU, 0xdd6aU, 0xbabeU, 0x10efU, 0xfe3dU, 0x546cU,
+		0x3195U, 0x9bc4U, 0x7516U, 0xdf47U, 0xb893U, 0x12c2U, 0xfc10U, 0x5641U,
+		0x37e2U, 0x9db3U, 0x7361U, 0xd930U, 0xbee4U, 0x14b5U, 0xfa67U, 0x5036U,
+		0x35cfU, 0x9f9eU, 0x714cU, 0xdb1dU, 0xbcc9U, 0x1698U, 0xf84aU, 0x521bU,
+		0x3b0cU, 0x915dU, 0x7f8fU, 0xd5deU, 0xb20aU, 0x185bU, 0xf689U, 0x5cd8U,
+		0x3921U, 0x9370U, 0x7da2U, 0xd7f3U, 0xb027U, 0x1a76U, 0xf4a4U, 0x5ef5U,
+		0x3f56U, 0x9507U, 0x7bd5U, 0xd184U, 0xb650U, 0x1c01U, 0xf2d3U, 0x5882U,
+		0x3d7bU, 0x972aU, 0x79f8U, 0xd3a9U, 0xb47dU, 0x1e2cU, 0xf0feU, 0x5aafU,
+	},
+	{
+		0x0000U, 0x45a0U, 0x8b40U, 0xcee0U, 0x06a1U, 0x4301U, 0x8de1U, 0xc841U,
+		0x0d42U, 0x48e2U, 0x8602U, 0xc3a2U, 0x0be3U, 0x4e43U, 0x80a3U, 0xc503U,
+		0x1a84U, 0x5f24U, 0x91c4U, 0xd464U, 0x1c25U, 0x5985U, 0x9765U, 0xd2c5U,
+		0x17c6U, 0x5266U, 0x9c86U, 0xd926U, 0x1167U, 0x54c7U, 0x9a27U, 0xdf87U,
+		0x3508U, 0x70a8U, 0xbe48U, 0xfbe8U, 0x33a9U, 0x7609U, 0xb8e9U, 0xfd49U,
+		0x384aU, 0x7deaU, 0xb30aU, 0xf6aaU, 0x3eebU, 0x7b4bU, 0xb5abU, 0xf00bU,
+		0x2f8cU, 0x6a2cU, 0xa4ccU, 0xe16cU, 0x292dU, 0x6c8dU, 0xa26dU, 0xe7cdU,
+		0x22ceU, 0x676eU, 0xa98eU, 0xec2eU, 0x246fU, 0x61cfU, 0xaf2fU, 0xea8fU,
+		0x6a10U, 0x2fb0U, 0xe150U, 0xa4f0U, 0x6cb1U, 0x2911U, 0xe7f1U, 0xa251U,
+		0x6752U, 0x22f2U, 0xec12U, 0xa9b2U, 0x61f3U, 0x2453U, 0xeab3U, 0xaf13U,
+		0x7094U, 0x3534U, 0xfbd4U, 0xbe74U, 0x7635U, 0x3395U, 0xfd75U, 0xb8d5U,
+		0x7dd6U, 0x3876U, 0xf696U, 0xb336U, 0x7b77U, 0x3ed7U, 0xf037U, 0xb597U,
+		0x5f18U, 0x1ab8U, 0xd458U, 0x91f8U, 0x59b9U, 0x1c19U, 0xd2f9U, 0x9759U,
+		0x525aU, 0x17faU, 0xd91aU, 0x9cbaU, 0x54fbU, 0x115bU, 0xdfbbU, 0x9a1bU,
+		0x459cU, 0x003cU, 0xcedcU, 0x8b7cU, 0x433dU, 0x069dU, 0xc87dU, 0x8dddU,
+		0x48deU, 0x0d7eU, 0xc39eU, 0x863eU, 0x4e7fU, 0x0bdfU, 0xc53fU, 0x809fU,
+		0xd420U, 0x9180U, 0x5f60U, 0x1ac0U, 0xd281U, 0x9721U, 0x59c1U, 0x1c61U,
+		0xd962U, 0x9cc2U, 0x5222U, 0x1782U, 0xdfc3U, 0x9a63U, 0x5483U, 0x1123U,
+		0xcea4U, 0x8b04U, 0x45e4U, 0x0044U, 0xc805U, 0x8da5U, 0x4345U, 0x06e5U,
+		0xc3e6U, 0x8646U, 0x48a6U, 0x0d06U, 0xc547U, 0x80e7U, 0x4e07U, 0x0ba7U,
+		0xe128U, 0xa488U, 0x6a68U, 0x2fc8U, 0xe789U, 0xa229U, 0x6cc9U, 0x2969U,
+		0xec6aU, 0xa9caU, 0x672aU, 0x228aU, 0xeacbU, 0xaf6bU, 0x618bU, 0x242bU,
+		0xfbacU, 0xbe0cU, 0x70ecU, 0x354cU, 0xfd0dU, 0xb8adU, 0x764dU, 0x33edU,
+		0xf6eeU, 0xb34eU, 0x7daeU, 0x380eU, 0xf04fU, 0xb5efU, 0x7b0fU, 0x3eafU,
+		0xbe30U, 0xfb90U, 0x3570U, 0x70d0U, 0xb891U, 0xfd31U, 0x33d1U, 0x7671U,
+		0xb372U, 0xf6d2U, 0x3832U, 0x7d92U, 0xb5d3U, 0xf073U, 0x3e93U, 0x7b33U,
+		0xa4b4U, 0xe114U, 0x2ff4U, 0x6a54U, 0xa215U, 0xe7b5U, 0x2955U, 0x6cf5U,
+		0xa9f6U, 0xec56U, 0x22b6U, 0x6716U, 0xaf57U, 0xeaf7U, 0x2417U, 0x61b7U,
+		0x8b38U, 0xce98U, 0x0078U, 0x45d8U, 0x8d99U, 0xc839U, 0x06d9U, 0x4379U,
+		0x867aU, 0xc3daU, 0x0d3aU, 0x489aU, 0x80dbU, 0xc57bU, 0x0b9bU, 0x4e3bU,
+		0x91bcU, 0xd41cU, 0x1afcU, 0x5f5cU, 0x971dU, 0xd2bdU, 0x1c5dU, 0x59fdU,
+		0x9cfeU, 0xd95eU, 0x17beU, 0x521eU, 0x9a5fU, 0xdfffU, 0x111fU, 0x54bfU,
+	},
+	{
+		0x0000U, 0xb861U, 0x60e3U, 0xd882U, 0xc1c6U, 0x79a7U, 0xa125U, 0x1944U,
+		0x93adU, 0x2bccU, 0xf34eU, 0x4b2fU, 0x526bU, 0xea0aU, 0x3288U, 0x8ae9U,
+		0x377bU, 0x8f1aU, 0x5798U, 0xeff9U, 0xf6bdU, 0x4edcU, 0x965eU, 0x2e3fU,
+		0xa4d6U, 0x1cb7U, 0xc435U, 0x7c54U, 0x6510U, 0xdd71U, 0x05f3U, 0xbd92U,
+		0x6ef6U, 0xd697U, 0x0e15U, 0xb674U, 0xaf30U, 0x1751U, 0xcfd3U, 0x77b2U,
+		0xfd5bU, 0x453aU, 0x9db8U, 0x25d9U, 0x3c9dU, 0x84fcU, 0x5c7eU, 0xe41fU,
+		0x598dU, 0xe1ecU, 0x396eU, 0x810fU, 0x984bU, 0x202aU, 0xf8a8U, 0x40c9U,
+		0xca20U, 0x7241U, 0xaac3U, 0x12a2U, 0x0be6U, 0xb387U, 0x6b05U, 0xd364U,
+		0xddecU, 0x658dU, 0xbd0fU, 0x056eU, 0x1c2aU, 0xa44bU, 0x7cc9U, 0xc4a8U,
+		0x4e41U, 0xf620U, 0x2ea2U, 0x96c3U, 0x8f87U, 0x37e6U, 0xef64U, 0x5705U,
+		0xea97U, 0x52f6U, 0x8a74U, 0x3215U, 0x2b51U, 0x9330U, 0x4bb2U, 0xf3d3U,
+		0x793aU, 0xc15bU, 0x19d9U, 0xa1b8U, 0xb8fcU, 0x009dU, 0xd81fU, 0x607eU,
+		0xb31aU, 0x0b7bU, 0xd3f9U, 0x6b98U, 0x72dcU, 0xcabdU, 0x123fU, 0xaa5eU,
+		0x20b7U, 0x98d6U, 0x4054U, 0xf835U, 0xe171U, 0x5910U, 0x8192U, 0x39f3U,
+		0x8461U, 0x3c00U, 0xe482U, 0x5ce3U, 0x45a7U, 0xfdc6U, 0x2544U, 0x9d25U,
+		0x17ccU, 0xafadU, 0x772fU, 0xcf4eU, 0xd60aU, 0x6e6bU, 0xb6e9U, 0x0e88U,
+		0xabf9U, 0x1398U, 0xcb1aU, 0x737bU, 0x6a3fU, 0xd25eU, 0x0adcU, 0xb2bdU,
+		0x3854U, 0x8035U, 0x58b7U, 0xe0d6U, 0xf992U, 0x41f3U, 0x9971U, 0x2110U,
+		0x9c82U, 0x24e3U, 0xfc61U, 0x4400U, 0x5d44U, 0xe525U, 0x3da7U, 0x85c6U,
+		0x0f2fU, 0xb74eU, 0x6fccU, 0xd7adU, 0xcee9U, 0x7688U, 0xae0aU, 0x166bU,
+		0xc50fU, 0x7d6eU, 0xa5ecU, 0x1d8dU, 0x04c9U, 0xbca8U, 0x642aU, 0xdc4bU,
+		0x56a2U, 0xeec3U, 0x3641U, 0x8e20U, 0x9764U, 0x2f05U, 0xf787U, 0x4fe6U,
+		0xf274U, 0x4a15U, 0x9297U, 0x2af6U, 0x33b2U, 0x8bd3U, 0x5351U, 0xeb30U,
+		0x61d9U, 0xd9b8U, 0x013aU, 0xb95bU, 0xa01fU, 0x187eU, 0xc0fcU, 0x789dU,
+		0x7615U, 0xce74U, 0x16f6U, 0xae97U, 0xb7d3U, 0x0fb2U, 0xd730U, 0x6f51U,
+		0xe5b8U, 0x5dd9U, 0x855bU, 0x3d3aU, 0x247eU, 0x9c1fU, 0x449dU, 0xfcfcU,
+		0x416eU, 0xf90fU, 0x218dU, 0x99ecU, 0x80a8U, 0x38c9U, 0xe04bU, 0x582aU,
+		0xd2c3U, 0x6aa2U, 0xb220U, 0x0a41U, 0x1305U, 0xab64U, 0x73e6U, 0xcb87U,
+		0x18e3U, 0xa082U, 0x7800U, 0xc061U, 0xd925U, 0x6144U, 0xb9c6U, 0x01a7U,
+		0x8b4eU, 0x332fU, 0xebadU, 0x53ccU, 0x4a88U, 0xf2e9U, 0x2a6bU, 0x920aU,
+		0x2f98U, 0x97f9U, 0x4f7bU, 0xf71aU, 0xee5eU, 0x563fU, 0x8ebdU, 0x36dcU,
+		0xbc35U, 0x0454U, 0xdcd6U, 0x64b7U, 0x7df3U, 0xc592U, 0x1d10U, 0xa571U,
+	},
+	{
+		0x0000U, 0x47d3U, 0x8fa6U, 0xc875U, 0x0f6dU, 0x48beU, 0x80cbU, 0xc718U,
+		0x1edaU, 0x5909U, 0x917cU, 0xd6afU, 0x11b7U, 0x5664U, 0x9e11U, 0xd9c2U,
+		0x3db4U, 0x7a67U, 0xb212U, 0xf5c1U, 0x32d9U, 0x750aU, 0xbd7fU, 0xfaacU,
+		0x236eU, 0x64bdU, 0xacc8U, 0xeb1bU, 0x2c03U, 0x6bd0U, 0xa3a5U, 0xe476U,
+		0x7b68U, 0x3cbbU, 0xf4ceU, 0xb31dU, 0x7405U, 0x33d6U, 0xfba3U, 0xbc70U,
+		0x65b2U, 0x2261U, 0xea14U, 0xadc7U, 0x6adfU, 0x2d0cU, 0xe579U, 0xa2aaU,
+		0x46dcU, 0x010fU, 0xc97aU, 0x8ea9U, 0x49b1U, 0x0e62U, 0xc617U, 0x81c4U,
+		0x5806U, 0x1fd5U, 0xd7a0U, 0x9073U, 0x576bU, 0x10b8U, 0xd8cdU, 0x9f1eU,
+		0xf6d0U, 0xb103U, 0x7976U, 0x3ea5U, 0xf9bdU, 0xbe6eU, 0x761bU, 0x31c8U,
+		0xe80aU, 0xafd9U, 0x67acU, 0x207fU, 0xe767U, 0xa0b4U, 0x68c1U, 0x2f12U,
+		0xcb64U, 0x8cb7U, 0x44c2U, 0x0311U, 0xc409U, 0x83daU, 0x4bafU, 0x0c7cU,
+		0xd5beU, 0x926dU, 0x5a18U, 0x1dcbU, 0xdad3U, 0x9d00U, 0x5575U, 0x12a6U,
+		0x8db8U, 0xca6bU, 0x021eU, 0x45cdU, 0x82d5U, 0xc506U, 0x0d73U, 0x4aa0U,
+		0x9362U, 0xd4b1U, 0x1cc4U, 0x5b17U, 0x9c0fU, 0xdbdcU, 0x13a9U, 0x547aU,
+		0xb00cU, 0xf7dfU, 0x3faaU, 0x7879U, 0xbf61U, 0xf8b2U, 0x30c7U, 0x7714U,
+		0xaed6U, 0xe905U, 0x2170U, 0x66a3U, 0xa1bbU, 0xe668U, 0x2e1dU, 0x69ceU,
+		0xfd81U, 0xba52U, 0x7227U, 0x35f4U, 0xf2ecU, 0xb53fU, 0x7d4aU, 0x3a99U,
+		0xe35bU, 0xa488U, 0x6cfdU, 0x2b2eU, 0xec36U, 0xabe5U, 0x6390U, 0x2443U,
+		0xc035U, 0x87e6U, 0x4f93U, 0x0840U, 0xcf58U, 0x888bU, 0x40feU, 0x072dU,
+		0xdeefU, 0x993cU, 0x5149U, 0x169aU, 0xd182U, 0x9651U, 0x5e24U, 0x19f7U,
+		0x86e9U, 0xc13aU, 0x094fU, 0x4e9cU, 0x8984U, 0xce57U, 0x0622U, 0x41f1U,
+		0x9833U, 0xdfe0U, 0x1795U, 0x5046U, 0x975eU, 0xd08dU, 0x18f8U, 0x5f2bU,
+		0xbb5dU, 0xfc8eU, 0x34fbU, 0x7328U, 0xb430U, 0xf3e3U, 0x3b96U, 0x7c45U,
+		0xa587U, 0xe254U, 0x2a21U, 0x6df2U, 0xaaeaU, 0xed39U, 0x254cU, 0x629fU,
+		0x0b51U, 0x4c82U, 0x84f7U, 0xc324U, 0x043cU, 0x43efU, 0x8b9aU, 0xcc49U,
+		0x158bU, 0x5258U, 0x9a2dU, 0xddfeU, 0x1ae6U, 0x5d35U, 0x9540U, 0xd293U,
+		0x36e5U, 0x7136U, 0xb943U, 0xfe90U, 0x3988U, 0x7e5bU, 0xb62eU, 0xf1fdU,
+		0x283fU, 0x6fecU, 0xa799U, 0xe04aU, 0x2752U, 0x6081U, 0xa8f4U, 0xef27U,
+		0x7039U, 0x37eaU, 0xff9fU, 0xb84cU, 0x7f54U, 0x3887U, 0xf0f2U, 0xb721U,
+		0x6ee3U, 0x2930U, 0xe145U, 0xa696U, 0x618eU, 0x265dU, 0xee28U, 0xa9fbU,
+		0x4d8dU, 0x0a5eU, 0xc22bU, 0x85f8U, 0x42e0U, 0x0533U, 0xcd46U, 0x8a95U,
+		0x5357U, 0x1484U, 0xdcf1U, 0x9b22U, 0x5c3aU, 0x1be9U, 0xd39cU, 0x944fU,
+	},
+};
+
+#endif /* ZEPHYR_LIB_CRC_CRC16_SLICE8_H_ */
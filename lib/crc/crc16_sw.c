@@ -6,6 +6,10 @@
 
 #include <zephyr/sys/crc.h>
 
+#ifdef CONFIG_CRC_SLICE_BY_8
+#include "crc16_slice8.h"
+#endif /* CONFIG_CRC_SLICE_BY_8 */
+
 uint16_t crc16(uint16_t poly, uint16_t seed, const uint8_t *src, size_t len)
 {
 	uint16_t crc = seed;
@@ -51,6 +55,22 @@ uint16_t crc16_reflect(uint16_t poly, uint16_t seed, const uint8_t *src, size_t
 
 uint16_t crc16_ccitt(uint16_t seed, const uint8_t *src, size_t len)
 {
+#ifdef CONFIG_CRC_SLICE_BY_8
+	const uint16_t (*t)[256] = crc16_ccitt_slice8;
+
+	for (; len >= 8; len -= 8, src += 8) {
+		seed = t[7][(src[0] ^ seed) & 0xff] ^ t[6][src[1] ^ (seed >> 8)] ^
+		       t[5][src[2]] ^ t[4][src[3]] ^ t[3][src[4]] ^
+		       t[2][src[5]] ^ t[1][src[6]] ^ t[0][src[7]];
+	}
+
+	for (; len > 0; len--) {
+		seed = (seed >> 8) ^ t[0][(seed ^ *src) & 0xff];
+		++src;
+	}
+
+	return seed;
+#else
 	for (; len > 0; len--) {
 		uint8_t e, f;
 
@@ -61,10 +81,27 @@ uint16_t crc16_ccitt(uint16_t seed, const uint8_t *src, size_t len)
 	}
 
 	return seed;
+#endif /* CONFIG_CRC_SLICE_BY_8 */
 }
 
 uint16_t crc16_itu_t(uint16_t seed, const uint8_t *src, size_t len)
 {
+#ifdef CONFIG_CRC_SLICE_BY_8
+	const uint16_t (*t)[256] = crc16_itu_t_slice8;
+
+	for (; len >= 8; len -= 8, src += 8) {
+		seed = t[7][src[0] ^ (seed >> 8)] ^ t[6][(src[1] ^ seed) & 0xff] ^
+		       t[5][src[2]] ^ t[4][src[3]] ^ t[3][src[4]] ^
+		       t[2][src[5]] ^ t[1][src[6]] ^ t[0][src[7]];
+	}
+
+	for (; len > 0; len--) {
+		seed = (uint16_t)(seed << 8) ^ t[0][(seed >> 8) ^ *src];
+		++src;
+	}
+
+	return seed;
+#else
 	for (; len > 0; len--) {
 		seed = (seed >> 8U) | (seed << 8U);
 		seed ^= *src;
@@ -75,4 +112,5 @@ uint16_t crc16_itu_t(uint16_t seed, const uint8_t *src, size_t len)
 	}
 
 	return seed;
+#endif /* CONFIG_CRC_SLICE_BY_8 */
 }
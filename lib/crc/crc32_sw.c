@@ -6,12 +6,44 @@
 
 #include <zephyr/sys/crc.h>
 
+#ifdef CONFIG_CRC_ARCH
+#include <zephyr/arch/cpu.h>
+#endif /* CONFIG_CRC_ARCH */
+
+#ifdef CONFIG_CRC_SLICE_BY_8
+#include "crc32_slice8.h"
+#endif /* CONFIG_CRC_SLICE_BY_8 */
+
 uint32_t crc32_ieee(const uint8_t *data, size_t len)
 {
 	return crc32_ieee_update(0x0, data, len);
 }
 
-uint32_t crc32_ieee_update(uint32_t crc, const uint8_t *data, size_t len)
+#ifdef CONFIG_CRC_SLICE_BY_8
+static uint32_t crc32_ieee_tables(uint32_t crc, const uint8_t *data, size_t len)
+{
+	const uint32_t (*t)[256] = crc32_ieee_slice8;
+
+	for (; len >= 8; len -= 8, data += 8) {
+		uint32_t one = crc ^ ((uint32_t)data[0] | ((uint32_t)data[1] << 8) |
+				      ((uint32_t)data[2] << 16) | ((uint32_t)data[3] << 24));
+		uint32_t two = (uint32_t)data[4] | ((uint32_t)data[5] << 8) |
+			       ((uint32_t)data[6] << 16) | ((uint32_t)data[7] << 24);
+
+		crc = t[7][one & 0xff] ^ t[6][(one >> 8) & 0xff] ^
+		      t[5][(one >> 16) & 0xff] ^ t[4][one >> 24] ^
+		      t[3][two & 0xff] ^ t[2][(two >> 8) & 0xff] ^
+		      t[1][(two >> 16) & 0xff] ^ t[0][two >> 24];
+	}
+
+	for (size_t i = 0; i < len; i++) {
+		crc = (crc >> 8) ^ t[0][(crc ^ data[i]) & 0xff];
+	}
+
+	return crc;
+}
+#else
+static uint32_t crc32_ieee_tables(uint32_t crc, const uint8_t *data, size_t len)
 {
 	/* crc table generated from polynomial 0xedb88320 */
 	static const uint32_t table[16] = {
@@ -21,8 +53,6 @@ uint32_t crc32_ieee_update(uint32_t crc, const uint8_t *data, size_t len)
 		0x9b64c2b0U, 0x86d3d2d4U, 0xa00ae278U, 0xbdbdf21cU,
 	};
 
-	crc = ~crc;
-
 	for (size_t i = 0; i < len; i++) {
 		uint8_t byte = data[i];
 
@@ -30,5 +60,21 @@ uint32_t crc32_ieee_update(uint32_t crc, const uint8_t *data, size_t len)
 		crc = (crc >> 4) ^ table[(crc ^ ((uint32_t)byte >> 4)) & 0x0f];
 	}
 
+	return crc;
+}
+#endif /* CONFIG_CRC_SLICE_BY_8 */
+
+uint32_t crc32_ieee_update(uint32_t crc, const uint8_t *data, size_t len)
+{
+	crc = ~crc;
+
+#ifdef CONFIG_CRC_ARCH
+	if (!arch_crc32_ieee_update(&crc, data, len)) {
+		crc = crc32_ieee_tables(crc, data, len);
+	}
+#else
+	crc = crc32_ieee_tables(crc, data, len);
+#endif /* CONFIG_CRC_ARCH */
+
 	return (~crc);
 }
@@ -6,6 +6,13 @@
 
 #include <zephyr/sys/crc.h>
 
+#ifdef CONFIG_CRC_ARCH
+#include <zephyr/arch/cpu.h>
+#endif /* CONFIG_CRC_ARCH */
+
+#ifdef CONFIG_CRC_SLICE_BY_8
+#include "crc32c_slice8.h"
+#else
 /* crc table generated from polynomial 0x1EDC6F41UL (Castagnoli) */
 static const uint32_t crc32c_table[16] = {
 	0x00000000UL, 0x105EC76FUL, 0x20BD8EDEUL, 0x30E349B1UL,
@@ -13,6 +20,7 @@ static const uint32_t crc32c_table[16] = {
 	0x82F63B78UL, 0x92A8FC17UL, 0xA24BB5A6UL, 0xB21572C9UL,
 	0xC38D26C4UL, 0xD3D3E1ABUL, 0xE330A81AUL, 0xF36E6F75UL
 };
+#endif /* CONFIG_CRC_SLICE_BY_8 */
 
 /* This value needs to be XORed with the final crc value once crc for
  * the entire stream is calculated. This is a requirement of crc32c algo.
@@ -24,6 +32,41 @@ static const uint32_t crc32c_table[16] = {
  */
 #define CRC32C_INIT	0xFFFFFFFFUL
 
+#ifdef CONFIG_CRC_SLICE_BY_8
+static uint32_t crc32c_tables(uint32_t crc, const uint8_t *data, size_t len)
+{
+	const uint32_t (*t)[256] = crc32c_slice8;
+
+	for (; len >= 8; len -= 8, data += 8) {
+		uint32_t one = crc ^ ((uint32_t)data[0] | ((uint32_t)data[1] << 8) |
+				      ((uint32_t)data[2] << 16) | ((uint32_t)data[3] << 24));
+		uint32_t two = (uint32_t)data[4] | ((uint32_t)data[5] << 8) |
+			       ((uint32_t)data[6] << 16) | ((uint32_t)data[7] << 24);
+
+		crc = t[7][one & 0xff] ^ t[6][(one >> 8) & 0xff] ^
+		      t[5][(one >> 16) & 0xff] ^ t[4][one >> 24] ^
+		      t[3][two & 0xff] ^ t[2][(two >> 8) & 0xff] ^
+		      t[1][(two >> 16) & 0xff] ^ t[0][two >> 24];
+	}
+
+	for (size_t i = 0; i < len; i++) {
+		crc = (crc >> 8) ^ t[0][(crc ^ data[i]) & 0xff];
+	}
+
+	return crc;
+}
+#else
+static uint32_t crc32c_tables(uint32_t crc, const uint8_t *data, size_t len)
+{
+	for (size_t i = 0; i < len; i++) {
+		crc = crc32c_table[(crc ^ data[i]) & 0x0F] ^ (crc >> 4);
+		crc = crc32c_table[(crc ^ ((uint32_t)data[i] >> 4)) & 0x0F] ^ (crc >> 4);
+	}
+
+	return crc;
+}
+#endif /* CONFIG_CRC_SLICE_BY_8 */
+
 uint32_t crc32_c(uint32_t crc, const uint8_t *data,
 		 size_t len, bool first_pkt, bool last_pkt)
 {
@@ -31,10 +74,13 @@ uint32_t crc32_c(uint32_t crc, const uint8_t *data,
 		crc = CRC32C_INIT;
 	}
 
-	for (size_t i = 0; i < len; i++) {
-		crc = crc32c_table[(crc ^ data[i]) & 0x0F] ^ (crc >> 4);
-		crc = crc32c_table[(crc ^ ((uint32_t)data[i] >> 4)) & 0x0F] ^ (crc >> 4);
+#ifdef CONFIG_CRC_ARCH
+	if (!arch_crc32c_update(&crc, data, len)) {
+		crc = crc32c_tables(crc, data, len);
 	}
+#else
+	crc = crc32c_tables(crc, data, len);
+#endif /* CONFIG_CRC_ARCH */
 
 	return last_pkt ? (crc ^ CRC32C_XOR_OUT) : crc;
 }
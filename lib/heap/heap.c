@@ -133,13 +133,13 @@ static void merge_chunks(struct z_heap *h, chunkid_t lc, chunkid_t rc)
 static void free_chunk(struct z_heap *h, chunkid_t c)
 {
 	/* Merge with free right chunk? */
-	if (!chunk_used(h, right_chunk(h, c))) {
+	if (!chunk_used(h, right_chunk(h, c)) && !chunk_parked(h, right_chunk(h, c))) {
 		free_list_remove(h, right_chunk(h, c));
 		merge_chunks(h, c, right_chunk(h, c));
 	}
 
 	/* Merge with free left chunk? */
-	if (!chunk_used(h, left_chunk(h, c))) {
+	if (!chunk_used(h, left_chunk(h, c)) && !chunk_parked(h, left_chunk(h, c))) {
 		free_list_remove(h, left_chunk(h, c));
 		merge_chunks(h, left_chunk(h, c), c);
 		c = left_chunk(h, c);
@@ -148,6 +148,97 @@ static void free_chunk(struct z_heap *h, chunkid_t c)
 	free_list_add(h, c);
 }
 
+#ifdef CONFIG_SYS_HEAP_SIZE_CLASSES
+/*
+ * Size-class front end.  Freed chunks small enough to belong to a class
+ * are not merged back into the heap but parked, marked free, on a
+ * per-size LIFO list so that the next request for the same chunk count
+ * is served without bucket search, split or merge.  Keeping them marked
+ * free lets sys_heap_free() catch a double free of a parked chunk.  Parked chunks count
+ * as free in the runtime stats and are handed back to the bucket
+ * allocator whenever it runs out of space.
+ */
+static chunkid_t class_alloc(struct z_heap *h, chunksz_t sz)
+{
+	if (sz > Z_HEAP_NUM_CLASSES) {
+		return 0;
+	}
+
+	chunkid_t c = h->class_next[sz - 1];
+
+	if (c != 0U) {
+		CHECK(chunk_parked(h, c) && chunk_size(h, c) == sz);
+		h->class_next[sz - 1] = next_free_chunk(h, c);
+		h->class_depth[sz - 1]--;
+		set_chunk_used(h, c, true);
+#ifdef CONFIG_SYS_HEAP_RUNTIME_STATS
+		h->free_bytes -= chunksz_to_bytes(h, sz);
+#endif
+	}
+
+	return c;
+}
+
+static bool class_free(struct z_heap *h, chunkid_t c)
+{
+	chunksz_t sz = chunk_size(h, c);
+
+	if ((sz > Z_HEAP_NUM_CLASSES) ||
+	    (h->class_depth[sz - 1] >= CONFIG_SYS_HEAP_SIZE_CLASS_DEPTH)) {
+		return false;
+	}
+
+	set_chunk_used(h, c, false);
+	set_prev_free_chunk(h, c, 0);
+	set_next_free_chunk(h, c, h->class_next[sz - 1]);
+	h->class_next[sz - 1] = c;
+	h->class_depth[sz - 1]++;
+#ifdef CONFIG_SYS_HEAP_RUNTIME_STATS
+	h->free_bytes += chunksz_to_bytes(h, sz);
+#endif
+
+	return true;
+}
+
+/* Returns every parked chunk to the bucket allocator */
+static bool class_flush(struct z_heap *h)
+{
+	bool flushed = false;
+
+	for (chunksz_t sz = 1; sz <= Z_HEAP_NUM_CLASSES; sz++) {
+		chunkid_t c;
+
+		while ((c = class_alloc(h, sz)) != 0U) {
+			set_chunk_used(h, c, false);
+			free_chunk(h, c);
+			flushed = true;
+		}
+	}
+
+	return flushed;
+}
+#else
+static inline chunkid_t class_alloc(struct z_heap *h, chunksz_t sz)
+{
+	ARG_UNUSED(h);
+	ARG_UNUSED(sz);
+	return 0;
+}
+
+static inline bool class_free(struct z_heap *h, chunkid_t c)
+{
+	ARG_UNUSED(h);
+	ARG_UNUSED(c);
+	return false;
+}
+
+static inline bool class_flush(struct z_heap *h)
+{
+	ARG_UNUSED(h);
+	return false;
+}
+#endif
+
 /*
  * Return the closest chunk ID corresponding to given memory pointer.
  * Here "closest" is only meaningful in the context of sys_heap_aligned_alloc()
@@ -184,7 +275,6 @@ void sys_heap_free(struct sys_heap *heap, void *mem)
 		 "corrupted heap bounds (buffer overflow?) for memory at %p",
 		 mem);
 
-	set_chunk_used(h, c, false);
 #ifdef CONFIG_SYS_HEAP_RUNTIME_STATS
 	h->allocated_bytes -= chunksz_to_bytes(h, chunk_size(h, c));
 #endif
@@ -194,6 +284,11 @@ void sys_heap_free(struct sys_heap *heap, void *mem)
 				  chunksz_to_bytes(h, chunk_size(h, c)));
 #endif
 
+	if (class_free(h, c)) {
+		return;
+	}
+
+	set_chunk_used(h, c, false);
 	free_chunk(h, c);
 }
 
@@ -270,18 +365,25 @@ void *sys_heap_alloc(struct sys_heap *heap, size_t bytes)
 	}
 
 	chunksz_t chunk_sz = bytes_to_chunksz(h, bytes);
-	chunkid_t c = alloc_chunk(h, chunk_sz);
+	chunkid_t c = class_alloc(h, chunk_sz);
+
 	if (c == 0U) {
-		return NULL;
-	}
+		c = alloc_chunk(h, chunk_sz);
+		if ((c == 0U) && class_flush(h)) {
+			c = alloc_chunk(h, chunk_sz);
+		}
+		if (c == 0U) {
+			return NULL;
+		}
 
-	/* Split off remainder if any */
-	if (chunk_size(h, c) > chunk_sz) {
-		split_chunks(h, c, c + chunk_sz);
-		free_list_add(h, c + chunk_sz);
-	}
+		/* Split off remainder if any */
+		if (chunk_size(h, c) > chunk_sz) {
+			split_chunks(h, c, c + chunk_sz);
+			free_list_add(h, c + chunk_sz);
+		}
 
-	set_chunk_used(h, c, true);
+		set_chunk_used(h, c, true);
+	}
 
 	mem = chunk_mem(h, c);
 
@@ -335,6 +437,9 @@ void *sys_heap_aligned_alloc(struct sys_heap *heap, size_t align, size_t bytes)
 	chunksz_t padded_sz = bytes_to_chunksz(h, bytes + align - gap);
 	chunkid_t c0 = alloc_chunk(h, padded_sz);
 
+	if ((c0 == 0) && class_flush(h)) {
+		c0 = alloc_chunk(h, padded_sz);
+	}
 	if (c0 == 0) {
 		return NULL;
 	}
@@ -429,7 +534,7 @@ void *sys_heap_aligned_realloc(struct sys_heap *heap, void *ptr,
 #endif
 
 		return ptr;
-	} else if (!chunk_used(h, rc) &&
+	} else if (!chunk_used(h, rc) && !chunk_parked(h, rc) &&
 		   (chunk_size(h, c) + chunk_size(h, rc) >= chunks_need)) {
 		/* Expand: split the right chunk and append */
 		chunksz_t split_size = chunks_need - chunk_size(h, c);
@@ -527,6 +632,13 @@ void sys_heap_init(struct sys_heap *heap, void *mem, size_t bytes)
 		h->buckets[i].next = 0;
 	}
 
+#ifdef CONFIG_SYS_HEAP_SIZE_CLASSES
+	for (int i = 0; i < Z_HEAP_NUM_CLASSES; i++) {
+		h->class_next[i] = 0;
+		h->class_depth[i] = 0;
+	}
+#endif
+
 	/* chunk containing our struct z_heap */
 	set_chunk_size(h, 0, chunk0_size);
 	set_left_chunk_size(h, 0, 0);
@@ -65,6 +65,14 @@ struct z_heap_bucket {
 	chunkid_t next;
 };
 
+#ifdef CONFIG_SYS_HEAP_SIZE_CLASSES
+/* One size class per chunk count, up to the largest chunk needed for a
+ * CONFIG_SYS_HEAP_SIZE_CLASS_MAX byte request with a big heap header.
+ * Keep in sync with Z_HEAP_SIZE_CLASS_BYTES in kernel.h.
+ */
+#define Z_HEAP_NUM_CLASSES ((CONFIG_SYS_HEAP_SIZE_CLASS_MAX + 15) / 8)
+#endif
+
 struct z_heap {
 	chunkid_t chunk0_hdr[2];
 	chunkid_t end_chunk;
@@ -73,6 +81,13 @@ struct z_heap {
 	size_t free_bytes;
 	size_t allocated_bytes;
 	size_t max_allocated_bytes;
+#endif
+#ifdef CONFIG_SYS_HEAP_SIZE_CLASSES
+	/* Cached chunks of exactly (index + 1) units, marked free with a
+	 * zero FREE_PREV and linked through their FREE_NEXT field.
+	 */
+	chunkid_t class_next[Z_HEAP_NUM_CLASSES];
+	uint16_t class_depth[Z_HEAP_NUM_CLASSES];
 #endif
 	struct z_heap_bucket buckets[0];
 };
@@ -217,6 +232,24 @@ static inline bool solo_free_header(struct z_heap *h, chunkid_t c)
 	return big_heap(h) && (chunk_size(h, c) == 1U);
 }
 
+/*
+ * A freed chunk parked on a size-class list instead of a bucket.  It is
+ * told apart by its zero FREE_PREV: a chunk in a bucket always links to
+ * another free chunk, and chunk 0 is the heap header.  Parked chunks are
+ * never merged with their neighbors.
+ */
+static inline bool chunk_parked(struct z_heap *h, chunkid_t c)
+{
+#ifdef CONFIG_SYS_HEAP_SIZE_CLASSES
+	return !chunk_used(h, c) && !solo_free_header(h, c) &&
+	       (prev_free_chunk(h, c) == 0U);
+#else
+	ARG_UNUSED(h);
+	ARG_UNUSED(c);
+	return false;
+#endif
+}
+
 static inline size_t chunk_header_bytes(struct z_heap *h)
 {
 	return big_heap(h) ? 8 : 4;
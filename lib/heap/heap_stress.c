@@ -6,6 +6,7 @@
 #include <zephyr/sys/sys_heap.h>
 #include <zephyr/sys/util.h>
 #include <zephyr/kernel.h>
+#include <string.h>
 #include "heap.h"
 
 struct z_heap_stress_rec {
@@ -25,6 +26,79 @@ struct z_heap_stress_block {
 	size_t sz;
 };
 
+/* Log-linear histogram of alloc latencies: exact counts below
+ * LAT_LINEAR cycles, then LAT_SUBBINS bins per power of two, which
+ * bounds the reported percentile error to about 12%.
+ */
+#define LAT_SUB_BITS 3
+#define LAT_SUBBINS  BIT(LAT_SUB_BITS)
+#define LAT_LINEAR   (2 * LAT_SUBBINS)
+#define LAT_OCTAVE0  (LAT_SUB_BITS + 1)
+#define LAT_NBINS    (LAT_LINEAR + (32 - LAT_OCTAVE0) * LAT_SUBBINS)
+
+static uint32_t lat_hist[LAT_NBINS];
+
+static unsigned int lat_bin(uint32_t cycles)
+{
+	if (cycles < LAT_LINEAR) {
+		return cycles;
+	}
+
+	unsigned int octave = 31 - __builtin_clz(cycles);
+	unsigned int sub = (cycles >> (octave - LAT_SUB_BITS)) & (LAT_SUBBINS - 1);
+
+	return LAT_LINEAR + (octave - LAT_OCTAVE0) * LAT_SUBBINS + sub;
+}
+
+/* Lowest cycle count falling into a bin */
+static uint32_t lat_bin_cycles(unsigned int bin)
+{
+	if (bin < LAT_LINEAR) {
+		return bin;
+	}
+
+	unsigned int octave = LAT_OCTAVE0 + (bin - LAT_LINEAR) / LAT_SUBBINS;
+	unsigned int sub = (bin - LAT_LINEAR) % LAT_SUBBINS;
+
+	return (LAT_SUBBINS + sub) << (octave - LAT_SUB_BITS);
+}
+
+static uint32_t lat_percentile(uint32_t count, uint32_t pct)
+{
+	uint32_t rank = (uint32_t)(((uint64_t)count * pct + 99) / 100);
+	uint32_t seen = 0;
+
+	for (unsigned int i = 0; i < LAT_NBINS; i++) {
+		seen += lat_hist[i];
+		if (seen >= rank && seen != 0) {
+			return lat_bin_cycles(i);
+		}
+	}
+
+	return 0;
+}
+
+/* Binary search for the largest block the heap can still hand out */
+static size_t probe_largest_free(struct z_heap_stress_rec *sr)
+{
+	size_t lo = 0;
+	size_t hi = sr->total_bytes;
+
+	while (lo < hi) {
+		size_t mid = lo + (hi - lo + 1) / 2;
+		void *p = sr->alloc_fn(sr->arg, mid);
+
+		if (p != NULL) {
+			sr->free_fn(sr->arg, p);
+			lo = mid;
+		} else {
+			hi = mid - 1;
+		}
+	}
+
+	return lo;
+}
+
 /* Very simple LCRNG (from https://nuclear.llnl.gov/CNP/rng/rngman/node4.html)
  *
  * Here to guarantee cross-platform test repeatability.
@@ -123,12 +197,15 @@ void sys_heap_stress(void *(*alloc_fn)(void *arg, size_t bytes),
 	};
 
 	*result = (struct z_heap_stress_result) {0};
+	memset(lat_hist, 0, sizeof(lat_hist));
 
 	for (uint32_t i = 0; i < op_count; i++) {
 		if (rand_alloc_choice(&sr)) {
 			size_t sz = rand_alloc_size(&sr);
+			uint32_t t0 = k_cycle_get_32();
 			void *p = sr.alloc_fn(sr.arg, sz);
 
+			lat_hist[lat_bin(k_cycle_get_32() - t0)]++;
 			result->total_allocs++;
 			if (p != NULL) {
 				result->successful_allocs++;
@@ -150,4 +227,19 @@ void sys_heap_stress(void *(*alloc_fn)(void *arg, size_t bytes),
 		}
 		result->accumulated_in_use_bytes += sr.bytes_alloced;
 	}
+
+	result->alloc_cycles_p50 = lat_percentile(result->total_allocs, 50);
+	result->alloc_cycles_p99 = lat_percentile(result->total_allocs, 99);
+
+	/* Fragmentation is the share of bytes not held by live blocks
+	 * that cannot be obtained as one contiguous allocation.  Heap
+	 * metadata counts as unusable, so this never quite reaches zero.
+	 */
+	size_t unalloced = sr.total_bytes - sr.bytes_alloced;
+
+	result->largest_free_bytes = probe_largest_free(&sr);
+	if (unalloced != 0U) {
+		result->fragmentation_percent = (uint32_t)
+			(100U - MIN(100U, (100ULL * result->largest_free_bytes) / unalloced));
+	}
 }
@@ -37,9 +37,15 @@ static bool valid_chunk(struct z_heap *h, chunkid_t c)
 	VALIDATE(left_chunk(h, right_chunk(h, c)) == c);
 	if (chunk_used(h, c)) {
 		VALIDATE(!solo_free_header(h, c));
+	} else if (chunk_parked(h, c)) {
+		/* Not merged with its neighbors, may end its class list */
+		VALIDATE((next_free_chunk(h, c) == 0) ||
+			 in_bounds(h, next_free_chunk(h, c)));
 	} else {
-		VALIDATE(chunk_used(h, left_chunk(h, c)));
-		VALIDATE(chunk_used(h, right_chunk(h, c)));
+		VALIDATE(chunk_used(h, left_chunk(h, c)) ||
+			 chunk_parked(h, left_chunk(h, c)));
+		VALIDATE(chunk_used(h, right_chunk(h, c)) ||
+			 chunk_parked(h, right_chunk(h, c)));
 		if (!solo_free_header(h, c)) {
 			VALIDATE(in_bounds(h, prev_free_chunk(h, c)));
 			VALIDATE(in_bounds(h, next_free_chunk(h, c)));
@@ -103,6 +109,29 @@ bool sys_heap_validate(struct sys_heap *heap)
 	}
 #endif
 
+#ifdef CONFIG_SYS_HEAP_SIZE_CLASSES
+	/* Size-class lists hold parked chunks of exactly the class size,
+	 * and the list length must match the recorded depth.  Mark those
+	 * chunks USED, temporarily, like the free list entries below.
+	 */
+	for (int i = 0; i < Z_HEAP_NUM_CLASSES; i++) {
+		uint32_t n = 0;
+
+		for (c = h->class_next[i]; c != 0; c = next_free_chunk(h, c)) {
+			if (!valid_chunk(h, c) || !chunk_parked(h, c) ||
+			    (chunk_size(h, c) != (chunksz_t)(i + 1)) ||
+			    (++n > h->class_depth[i])) {
+				return false;
+			}
+			set_chunk_used(h, c, true);
+		}
+
+		if (n != h->class_depth[i]) {
+			return false;
+		}
+	}
+#endif
+
 	/* Check the free lists: entry count should match, empty bit
 	 * should be correct, and all chunk entries should point into
 	 * valid unused chunks.  Mark those chunks USED, temporarily.
@@ -156,9 +185,9 @@ bool sys_heap_validate(struct sys_heap *heap)
 		return false;  /* Should have exactly consumed the buffer */
 	}
 
-	/* Go through the free lists again checking that the linear
-	 * pass caught all the blocks and that they now show UNUSED.
-	 * Mark them USED.
+	/* Go through the free and size-class lists again checking that
+	 * the linear pass caught all the blocks and that they now show
+	 * UNUSED.  Mark them USED.
 	 */
 	for (int b = 0; b <= bucket_idx(h, h->end_chunk); b++) {
 		chunkid_t c0 = h->buckets[b].next;
@@ -176,6 +205,17 @@ bool sys_heap_validate(struct sys_heap *heap)
 		}
 	}
 
+#ifdef CONFIG_SYS_HEAP_SIZE_CLASSES
+	for (int i = 0; i < Z_HEAP_NUM_CLASSES; i++) {
+		for (c = h->class_next[i]; c != 0; c = next_free_chunk(h, c)) {
+			if (chunk_used(h, c)) {
+				return false;
+			}
+			set_chunk_used(h, c, true);
+		}
+	}
+#endif
+
 	/* Now we are valid, but have managed to invert all the in-use
 	 * fields.  One more linear pass to fix them up
 	 */
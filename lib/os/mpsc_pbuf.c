@@ -4,6 +4,7 @@
  * SPDX-License-Identifier: Apache-2.0
  */
 #include <zephyr/sys/mpsc_pbuf.h>
+#include <zephyr/sys/barrier.h>
 
 #define MPSC_PBUF_DEBUG 0
 
@@ -16,11 +17,53 @@
 	} \
 } while (false)
 
+#ifdef CONFIG_MPSC_PBUF_LOCKLESS
+/* Reservation word layout: free running write position (modulo 2^31, which
+ * is a multiple of any power of 2 buffer size) and a bit set by the producer
+ * holding the spinlock. Fast path compare-and-swap fails while the bit is set
+ * and, because every locked section moves the position forward by at least
+ * one lap, also fails if a locked section ran since the word was read.
+ */
+#define RESERVE_LOCKED BIT(31)
+#define RESERVE_POS_MASK BIT_MASK(31)
+#endif
+
+static inline bool is_lockless(struct mpsc_pbuf_buffer *buffer)
+{
+	return IS_ENABLED(CONFIG_MPSC_PBUF_LOCKLESS) &&
+	       (buffer->flags & MPSC_PBUF_MODE_LOCKLESS);
+}
+
+static inline uint32_t wr_idx_get(struct mpsc_pbuf_buffer *buffer)
+{
+#ifdef CONFIG_MPSC_PBUF_LOCKLESS
+	if (is_lockless(buffer)) {
+		return (uint32_t)atomic_get(&buffer->committed) & (buffer->size - 1);
+	}
+#endif
+	return buffer->wr_idx;
+}
+
+static inline uint32_t tmp_wr_idx_get(struct mpsc_pbuf_buffer *buffer)
+{
+#ifdef CONFIG_MPSC_PBUF_LOCKLESS
+	if (is_lockless(buffer)) {
+		atomic_val_t r = atomic_get(&buffer->reserve);
+
+		/* When locked, tmp_wr_idx is owned by the lock holder. */
+		if (!(r & RESERVE_LOCKED)) {
+			return (uint32_t)r & (buffer->size - 1);
+		}
+	}
+#endif
+	return buffer->tmp_wr_idx;
+}
+
 static inline void mpsc_state_print(struct mpsc_pbuf_buffer *buffer)
 {
 	if (MPSC_PBUF_DEBUG) {
 		printk(", wr:%d/%d, rd:%d/%d\n",
-			buffer->wr_idx, buffer->tmp_wr_idx,
+			wr_idx_get(buffer), tmp_wr_idx_get(buffer),
 			buffer->rd_idx, buffer->tmp_rd_idx);
 	}
 }
@@ -40,6 +83,14 @@ void mpsc_pbuf_init(struct mpsc_pbuf_buffer *buffer,
 		buffer->flags |= MPSC_PBUF_SIZE_POW2;
 	}
 
+	/* Lockless mode relies on free running indexes wrapping cleanly. */
+	if (!is_lockless(buffer) || !(buffer->flags & MPSC_PBUF_SIZE_POW2)) {
+		buffer->flags &= ~MPSC_PBUF_MODE_LOCKLESS;
+	} else {
+		/* Free space must never hold anything resembling a valid header. */
+		memset(buffer->buf, 0, buffer->size * sizeof(uint32_t));
+	}
+
 	if (IS_ENABLED(CONFIG_MULTITHREADING)) {
 		int err;
 
@@ -60,16 +111,18 @@ void mpsc_pbuf_init(struct mpsc_pbuf_buffer *buffer,
  */
 static inline bool free_space(struct mpsc_pbuf_buffer *buffer, uint32_t *res)
 {
+	uint32_t tmp_wr_idx = tmp_wr_idx_get(buffer);
+
 	if (buffer->flags & MPSC_PBUF_FULL) {
 		*res = 0;
 		return false;
 	}
 
-	if (buffer->rd_idx > buffer->tmp_wr_idx) {
-		*res =  buffer->rd_idx - buffer->tmp_wr_idx;
+	if (buffer->rd_idx > tmp_wr_idx) {
+		*res =  buffer->rd_idx - tmp_wr_idx;
 		return false;
 	}
-	*res = buffer->size - buffer->tmp_wr_idx;
+	*res = buffer->size - tmp_wr_idx;
 
 	return true;
 }
@@ -85,12 +138,14 @@ static inline bool free_space(struct mpsc_pbuf_buffer *buffer, uint32_t *res)
  */
 static inline bool available(struct mpsc_pbuf_buffer *buffer, uint32_t *res)
 {
-	if (buffer->flags & MPSC_PBUF_FULL || buffer->tmp_rd_idx > buffer->wr_idx) {
+	uint32_t wr_idx = wr_idx_get(buffer);
+
+	if (buffer->flags & MPSC_PBUF_FULL || buffer->tmp_rd_idx > wr_idx) {
 		*res = buffer->size - buffer->tmp_rd_idx;
 		return true;
 	}
 
-	*res = (buffer->wr_idx - buffer->tmp_rd_idx);
+	*res = (wr_idx - buffer->tmp_rd_idx);
 
 	return false;
 }
@@ -147,6 +202,17 @@ static inline uint32_t get_skip(union mpsc_pbuf_generic *item)
 }
 
 
+static ALWAYS_INLINE void wr_idx_inc(struct mpsc_pbuf_buffer *buffer, uint32_t wlen)
+{
+#ifdef CONFIG_MPSC_PBUF_LOCKLESS
+	if (is_lockless(buffer)) {
+		(void)atomic_add(&buffer->committed, (atomic_val_t)wlen);
+		return;
+	}
+#endif
+	buffer->wr_idx = idx_inc(buffer, buffer->wr_idx, wlen);
+}
+
 static ALWAYS_INLINE void tmp_wr_idx_inc(struct mpsc_pbuf_buffer *buffer, int32_t wlen)
 {
 	buffer->tmp_wr_idx = idx_inc(buffer, buffer->tmp_wr_idx, wlen);
@@ -161,6 +227,98 @@ static void rd_idx_inc(struct mpsc_pbuf_buffer *buffer, int32_t wlen)
 	buffer->flags &= ~MPSC_PBUF_FULL;
 }
 
+/* In lockless mode, clear space which is about to become free. Lockless
+ * producer reserves space before it writes packet header so consumer may
+ * already look at that location and it must not find stale data there.
+ */
+static void release_space(struct mpsc_pbuf_buffer *buffer, uint32_t idx, uint32_t wlen)
+{
+	if (!is_lockless(buffer)) {
+		return;
+	}
+
+	uint32_t len = MIN(wlen, buffer->size - idx);
+
+	memset(&buffer->buf[idx], 0, len * sizeof(uint32_t));
+	memset(buffer->buf, 0, (wlen - len) * sizeof(uint32_t));
+	barrier_dmem_fence_full();
+}
+
+/* Lock taken by producers. In lockless mode it also takes ownership of the
+ * reservation word so that tmp_wr_idx can be manipulated as in locked mode.
+ */
+static k_spinlock_key_t wr_lock(struct mpsc_pbuf_buffer *buffer)
+{
+	k_spinlock_key_t key = k_spin_lock(&buffer->lock);
+
+#ifdef CONFIG_MPSC_PBUF_LOCKLESS
+	if (is_lockless(buffer)) {
+		atomic_val_t r = atomic_or(&buffer->reserve, RESERVE_LOCKED);
+
+		buffer->tmp_wr_idx = (uint32_t)r & (buffer->size - 1);
+	}
+#endif
+
+	return key;
+}
+
+static void wr_unlock(struct mpsc_pbuf_buffer *buffer, k_spinlock_key_t key)
+{
+#ifdef CONFIG_MPSC_PBUF_LOCKLESS
+	if (is_lockless(buffer)) {
+		uint32_t pos = (uint32_t)atomic_get(&buffer->reserve) & RESERVE_POS_MASK;
+		uint32_t shift = (buffer->tmp_wr_idx - pos) & (buffer->size - 1);
+
+		atomic_set(&buffer->reserve,
+			   (atomic_val_t)((pos + buffer->size + shift) & RESERVE_POS_MASK));
+	}
+#endif
+
+	k_spin_unlock(&buffer->lock, key);
+}
+
+/* Attempt to reserve space without taking the lock. Succeeds only if packet
+ * fits before the end of the buffer and leaves at least one word free, other
+ * cases (wrapping, full buffer, dropping) are handled under the lock.
+ */
+static uint32_t *reserve_lockless(struct mpsc_pbuf_buffer *buffer, uint32_t wlen)
+{
+#ifdef CONFIG_MPSC_PBUF_LOCKLESS
+	atomic_val_t r;
+	uint32_t idx;
+
+	if (!is_lockless(buffer)) {
+		return NULL;
+	}
+
+	do {
+		uint32_t rd_idx;
+		uint32_t free_wlen;
+
+		r = atomic_get(&buffer->reserve);
+		if ((r & RESERVE_LOCKED) || (buffer->flags & MPSC_PBUF_FULL)) {
+			return NULL;
+		}
+
+		/* Stale read index only underestimates free space. */
+		rd_idx = *(volatile uint32_t *)&buffer->rd_idx;
+		idx = (uint32_t)r & (buffer->size - 1);
+		free_wlen = (rd_idx > idx) ? (rd_idx - idx) : (buffer->size - idx);
+
+		if (wlen >= free_wlen) {
+			return NULL;
+		}
+	} while (!atomic_cas(&buffer->reserve, r, (r + wlen) & RESERVE_POS_MASK));
+
+	return &buffer->buf[idx];
+#else
+	ARG_UNUSED(buffer);
+	ARG_UNUSED(wlen);
+
+	return NULL;
+#endif
+}
+
 static void add_skip_item(struct mpsc_pbuf_buffer *buffer, uint32_t wlen)
 {
 	union mpsc_pbuf_generic skip = {
@@ -169,7 +327,7 @@ static void add_skip_item(struct mpsc_pbuf_buffer *buffer, uint32_t wlen)
 
 	buffer->buf[buffer->tmp_wr_idx] = skip.raw;
 	tmp_wr_idx_inc(buffer, wlen);
-	buffer->wr_idx = idx_inc(buffer, buffer->wr_idx, wlen);
+	wr_idx_inc(buffer, wlen);
 }
 
 static bool drop_item_locked(struct mpsc_pbuf_buffer *buffer,
@@ -189,6 +347,7 @@ static bool drop_item_locked(struct mpsc_pbuf_buffer *buffer,
 		/* Skip packet found, can be dropped to free some space */
 		MPSC_PBUF_DBG(buffer, "no space: Found skip packet %d len", skip_wlen);
 
+		release_space(buffer, buffer->rd_idx, skip_wlen);
 		rd_idx_inc(buffer, skip_wlen);
 		buffer->tmp_rd_idx = buffer->rd_idx;
 		return true;
@@ -212,7 +371,7 @@ static bool drop_item_locked(struct mpsc_pbuf_buffer *buffer,
 			MPSC_PBUF_DBG(buffer, "no space: Added skip packet (len:%d)", free_wlen);
 		}
 		/* Move all indexes forward, after claimed packet. */
-		buffer->wr_idx = idx_inc(buffer, buffer->wr_idx, rd_wlen);
+		wr_idx_inc(buffer, rd_wlen);
 
 		/* If allocation wrapped around the buffer and found busy packet
 		 * that was already ommited, skip it again.
@@ -266,6 +425,7 @@ static void post_drop_action(struct mpsc_pbuf_buffer *buffer,
 
 	if (cmp_tmp_wr_idx == buffer->tmp_wr_idx) {
 		/* Operation not interrupted by another alloc. */
+		release_space(buffer, prev_tmp_wr_idx, tmp_wr_idx_shift);
 		buffer->tmp_wr_idx = prev_tmp_wr_idx;
 		buffer->flags &= ~MPSC_PBUF_FULL;
 		return;
@@ -281,9 +441,7 @@ static void post_drop_action(struct mpsc_pbuf_buffer *buffer,
 	};
 
 	buffer->buf[prev_tmp_wr_idx] = skip.raw;
-	buffer->wr_idx = idx_inc(buffer,
-				 buffer->wr_idx,
-				 tmp_wr_idx_shift);
+	wr_idx_inc(buffer, tmp_wr_idx_shift);
 	/* full flag? */
 }
 
@@ -296,9 +454,17 @@ void mpsc_pbuf_put_word(struct mpsc_pbuf_buffer *buffer,
 	union mpsc_pbuf_generic *dropped_item = NULL;
 	uint32_t tmp_wr_idx_shift = 0;
 	uint32_t tmp_wr_idx_val = 0;
+	uint32_t *dst = reserve_lockless(buffer, 1);
+
+	if (dst) {
+		*dst = item.raw;
+		wr_idx_inc(buffer, 1);
+		max_utilization_update(buffer);
+		return;
+	}
 
 	do {
-		key = k_spin_lock(&buffer->lock);
+		key = wr_lock(buffer);
 
 		if (tmp_wr_idx_shift) {
 			post_drop_action(buffer, tmp_wr_idx_val, tmp_wr_idx_shift);
@@ -313,7 +479,7 @@ void mpsc_pbuf_put_word(struct mpsc_pbuf_buffer *buffer,
 			buffer->buf[buffer->tmp_wr_idx] = item.raw;
 			tmp_wr_idx_inc(buffer, 1);
 			cont = false;
-			buffer->wr_idx = idx_inc(buffer, buffer->wr_idx, 1);
+			wr_idx_inc(buffer, 1);
 			max_utilization_update(buffer);
 		} else {
 			tmp_wr_idx_val = buffer->tmp_wr_idx;
@@ -321,7 +487,7 @@ void mpsc_pbuf_put_word(struct mpsc_pbuf_buffer *buffer,
 						&dropped_item, &tmp_wr_idx_shift);
 		}
 
-		k_spin_unlock(&buffer->lock, key);
+		wr_unlock(buffer, key);
 
 		if (dropped_item) {
 			/* Notify about item being dropped. */
@@ -350,11 +516,14 @@ union mpsc_pbuf_generic *mpsc_pbuf_alloc(struct mpsc_pbuf_buffer *buffer,
 		return NULL;
 	}
 
-	do {
+	item = (union mpsc_pbuf_generic *)reserve_lockless(buffer, wlen);
+	cont = (item == NULL);
+
+	while (cont) {
 		k_spinlock_key_t key;
 		bool wrap;
 
-		key = k_spin_lock(&buffer->lock);
+		key = wr_lock(buffer);
 		if (tmp_wr_idx_shift) {
 			post_drop_action(buffer, tmp_wr_idx_val, tmp_wr_idx_shift);
 			tmp_wr_idx_shift = 0;
@@ -376,16 +545,16 @@ union mpsc_pbuf_generic *mpsc_pbuf_alloc(struct mpsc_pbuf_buffer *buffer,
 			   !k_is_in_isr()) {
 			int err;
 
-			k_spin_unlock(&buffer->lock, key);
+			wr_unlock(buffer, key);
 			err = k_sem_take(&buffer->sem, timeout);
-			key = k_spin_lock(&buffer->lock);
+			key = wr_lock(buffer);
 			cont = (err == 0) ? true : false;
 		} else if (cont) {
 			tmp_wr_idx_val = buffer->tmp_wr_idx;
 			cont = drop_item_locked(buffer, free_wlen,
 						&dropped_item, &tmp_wr_idx_shift);
 		}
-		k_spin_unlock(&buffer->lock, key);
+		wr_unlock(buffer, key);
 
 		if (dropped_item) {
 			/* Notify about item being dropped. */
@@ -394,8 +563,7 @@ union mpsc_pbuf_generic *mpsc_pbuf_alloc(struct mpsc_pbuf_buffer *buffer,
 			}
 			dropped_item = NULL;
 		}
-	} while (cont);
-
+	}
 
 	MPSC_PBUF_DBG(buffer, "allocated %p", item);
 
@@ -412,10 +580,21 @@ void mpsc_pbuf_commit(struct mpsc_pbuf_buffer *buffer,
 {
 	uint32_t wlen = buffer->get_wlen(item);
 
+	if (is_lockless(buffer)) {
+		/* Packet content must be visible before it is marked valid. */
+		barrier_dmem_fence_full();
+		item->hdr.valid = 1;
+		wr_idx_inc(buffer, wlen);
+		/* Best effort, concurrent producers may lose an update. */
+		max_utilization_update(buffer);
+		MPSC_PBUF_DBG(buffer, "committed %p", item);
+		return;
+	}
+
 	k_spinlock_key_t key = k_spin_lock(&buffer->lock);
 
 	item->hdr.valid = 1;
-	buffer->wr_idx = idx_inc(buffer, buffer->wr_idx, wlen);
+	wr_idx_inc(buffer, wlen);
 	max_utilization_update(buffer);
 	k_spin_unlock(&buffer->lock, key);
 	MPSC_PBUF_DBG(buffer, "committed %p", item);
@@ -431,13 +610,26 @@ void mpsc_pbuf_put_word_ext(struct mpsc_pbuf_buffer *buffer,
 	bool cont;
 	uint32_t tmp_wr_idx_shift = 0;
 	uint32_t tmp_wr_idx_val = 0;
+	uint32_t *dst = reserve_lockless(buffer, l);
+
+	if (dst) {
+		void **p = (void **)&dst[1];
+
+		/* Header goes last so that packet is never seen incomplete. */
+		*p = (void *)data;
+		barrier_dmem_fence_full();
+		*dst = item.raw;
+		wr_idx_inc(buffer, l);
+		max_utilization_update(buffer);
+		return;
+	}
 
 	do {
 		k_spinlock_key_t key;
 		uint32_t free_wlen;
 		bool wrap;
 
-		key = k_spin_lock(&buffer->lock);
+		key = wr_lock(buffer);
 
 		if (tmp_wr_idx_shift) {
 			post_drop_action(buffer, tmp_wr_idx_val, tmp_wr_idx_shift);
@@ -453,7 +645,7 @@ void mpsc_pbuf_put_word_ext(struct mpsc_pbuf_buffer *buffer,
 
 			*p = (void *)data;
 			tmp_wr_idx_inc(buffer, l);
-			buffer->wr_idx = idx_inc(buffer, buffer->wr_idx, l);
+			wr_idx_inc(buffer, l);
 			cont = false;
 			max_utilization_update(buffer);
 		} else if (wrap) {
@@ -465,7 +657,7 @@ void mpsc_pbuf_put_word_ext(struct mpsc_pbuf_buffer *buffer,
 						 &dropped_item, &tmp_wr_idx_shift);
 		}
 
-		k_spin_unlock(&buffer->lock, key);
+		wr_unlock(buffer, key);
 
 		if (dropped_item) {
 			/* Notify about item being dropped. */
@@ -484,13 +676,24 @@ void mpsc_pbuf_put_data(struct mpsc_pbuf_buffer *buffer, const uint32_t *data,
 	union mpsc_pbuf_generic *dropped_item = NULL;
 	uint32_t tmp_wr_idx_shift = 0;
 	uint32_t tmp_wr_idx_val = 0;
+	uint32_t *dst = reserve_lockless(buffer, wlen);
+
+	if (dst) {
+		/* Header goes last so that packet is never seen incomplete. */
+		memcpy(&dst[1], &data[1], (wlen - 1) * sizeof(uint32_t));
+		barrier_dmem_fence_full();
+		dst[0] = data[0];
+		wr_idx_inc(buffer, wlen);
+		max_utilization_update(buffer);
+		return;
+	}
 
 	do {
 		uint32_t free_wlen;
 		k_spinlock_key_t key;
 		bool wrap;
 
-		key = k_spin_lock(&buffer->lock);
+		key = wr_lock(buffer);
 
 		if (tmp_wr_idx_shift) {
 			post_drop_action(buffer, tmp_wr_idx_val, tmp_wr_idx_shift);
@@ -502,7 +705,7 @@ void mpsc_pbuf_put_data(struct mpsc_pbuf_buffer *buffer, const uint32_t *data,
 		if (free_wlen >= wlen) {
 			memcpy(&buffer->buf[buffer->tmp_wr_idx], data,
 				wlen * sizeof(uint32_t));
-			buffer->wr_idx = idx_inc(buffer, buffer->wr_idx, wlen);
+			wr_idx_inc(buffer, wlen);
 			tmp_wr_idx_inc(buffer, wlen);
 			cont = false;
 			max_utilization_update(buffer);
@@ -515,7 +718,7 @@ void mpsc_pbuf_put_data(struct mpsc_pbuf_buffer *buffer, const uint32_t *data,
 						 &dropped_item, &tmp_wr_idx_shift);
 		}
 
-		k_spin_unlock(&buffer->lock, key);
+		wr_unlock(buffer, key);
 
 		if (dropped_item) {
 			/* Notify about item being dropped. */
@@ -553,11 +756,28 @@ const union mpsc_pbuf_generic *mpsc_pbuf_claim(struct mpsc_pbuf_buffer *buffer)
 				uint32_t inc =
 					skip ? skip : buffer->get_wlen(item);
 
+				/* No packet is claimed when claiming starts, so
+				 * rd_idx equals tmp_rd_idx: freeing a packet moves
+				 * rd_idx past it, and a packet freed after being
+				 * overwritten around was already passed by both
+				 * indexes and is left as a skip packet that gets
+				 * here in turn.  Space skipped here is therefore
+				 * always zeroed before a lockless producer can
+				 * reserve it again, and a header that is not
+				 * written yet never reads as a stale packet.
+				 */
+				if (buffer->rd_idx == buffer->tmp_rd_idx) {
+					release_space(buffer, buffer->rd_idx, inc);
+				}
 				buffer->tmp_rd_idx =
 				      idx_inc(buffer, buffer->tmp_rd_idx, inc);
 				rd_idx_inc(buffer, inc);
 				cont = true;
 			} else {
+				if (is_lockless(buffer)) {
+					/* Pairs with the barrier in commit. */
+					barrier_dmem_fence_full();
+				}
 				item->hdr.busy = 1;
 				buffer->tmp_rd_idx =
 					idx_inc(buffer, buffer->tmp_rd_idx,
@@ -595,6 +815,9 @@ void mpsc_pbuf_free(struct mpsc_pbuf_buffer *buffer,
 			 */
 			buffer->tmp_rd_idx = idx_inc(buffer, buffer->tmp_rd_idx, wlen);
 		}
+		if ((uint32_t *)item == &buffer->buf[buffer->rd_idx]) {
+			release_space(buffer, buffer->rd_idx, wlen);
+		}
 		rd_idx_inc(buffer, wlen);
 	} else {
 		MPSC_PBUF_DBG(buffer, "Allocation occurred during claim");
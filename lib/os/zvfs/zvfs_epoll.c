@@ -0,0 +1,484 @@
+/*
+ * Copyright (c) 2026 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/sys/bitarray.h>
+#include <zephyr/sys/fdtable.h>
+#include <zephyr/zvfs/epoll.h>
+
+#if defined(CONFIG_NET_SOCKETS_SOCKOPT_TLS)
+bool net_socket_is_tls(void *obj);
+#else
+#define net_socket_is_tls(obj) false
+#endif
+
+#define ZVFS_EPOLL_EVENTS_SET                                                                      \
+	(ZVFS_EPOLLIN | ZVFS_EPOLLPRI | ZVFS_EPOLLOUT | ZVFS_EPOLLERR | ZVFS_EPOLLHUP |             \
+	 ZVFS_EPOLLONESHOT)
+
+struct zvfs_epoll_entry {
+	/* -1 when the entry is free */
+	int fd;
+	uint32_t events;
+	union zvfs_epoll_data data;
+};
+
+struct zvfs_epoll {
+	struct zvfs_epoll_entry entries[CONFIG_ZVFS_EPOLL_MAX_FDS];
+	/* Raised on every change of the interest list to wake up waiters */
+	struct k_poll_signal ctl_sig;
+	/* Where the next wait starts looking, so that no entry is starved */
+	int next;
+};
+
+/* Per wait state of an interest list entry, next to its zvfs_pollfd */
+struct zvfs_epoll_slot {
+	uint16_t idx;
+	uint16_t pev_first;
+	uint8_t pev_count;
+	bool ready;
+};
+
+SYS_BITARRAY_DEFINE_STATIC(epolls_bitarray, CONFIG_ZVFS_EPOLL_MAX);
+static struct zvfs_epoll epolls[CONFIG_ZVFS_EPOLL_MAX];
+static const struct fd_op_vtable zvfs_epoll_fd_vtable;
+
+static struct zvfs_epoll *zvfs_epoll_get(int epfd, struct k_mutex **lock)
+{
+	const struct fd_op_vtable *vtable;
+	struct zvfs_epoll *ep;
+
+	ep = zvfs_get_fd_obj_and_vtable(epfd, &vtable, lock);
+	if (ep == NULL) {
+		return NULL;
+	}
+
+	if (vtable != &zvfs_epoll_fd_vtable) {
+		errno = EINVAL;
+		return NULL;
+	}
+
+	return ep;
+}
+
+static struct zvfs_epoll_entry *zvfs_epoll_find(struct zvfs_epoll *ep, int fd)
+{
+	ARRAY_FOR_EACH_PTR(ep->entries, entry) {
+		if (entry->fd == fd) {
+			return entry;
+		}
+	}
+
+	return NULL;
+}
+
+static int zvfs_epoll_close_op(void *obj)
+{
+	struct zvfs_epoll *ep = obj;
+	int err;
+
+	ARRAY_FOR_EACH_PTR(ep->entries, entry) {
+		entry->fd = -1;
+	}
+
+	/* Waiters notice that the instance is gone */
+	k_poll_signal_raise(&ep->ctl_sig, 0);
+
+	err = sys_bitarray_free(&epolls_bitarray, 1, ep - epolls);
+	__ASSERT(err == 0, "sys_bitarray_free() failed: %d", err);
+
+	return 0;
+}
+
+static int zvfs_epoll_ioctl_op(void *obj, unsigned int request, va_list args)
+{
+	ARG_UNUSED(obj);
+	ARG_UNUSED(request);
+	ARG_UNUSED(args);
+
+	/* Nesting epoll instances is not supported */
+	errno = EOPNOTSUPP;
+
+	return -1;
+}
+
+static const struct fd_op_vtable zvfs_epoll_fd_vtable = {
+	.close = zvfs_epoll_close_op,
+	.ioctl = zvfs_epoll_ioctl_op,
+};
+
+/* Copy the interest list, oldest unreported entry first */
+static int zvfs_epoll_snapshot(struct zvfs_epoll *ep, struct zvfs_pollfd *fds,
+			       struct zvfs_epoll_slot *slots)
+{
+	int count = 0;
+
+	k_poll_signal_reset(&ep->ctl_sig);
+
+	for (int i = 0; i < ARRAY_SIZE(ep->entries); i++) {
+		int idx = (ep->next + i) % ARRAY_SIZE(ep->entries);
+		struct zvfs_epoll_entry *entry = &ep->entries[idx];
+
+		if (entry->fd < 0 || (entry->events & ~ZVFS_EPOLLONESHOT) == 0) {
+			continue;
+		}
+
+		fds[count].fd = entry->fd;
+		fds[count].events = entry->events & ~ZVFS_EPOLLONESHOT;
+		fds[count].revents = 0;
+		slots[count].idx = idx;
+		slots[count].pev_count = 0;
+		slots[count].ready = false;
+		count++;
+	}
+
+	return count;
+}
+
+static bool zvfs_epoll_slot_fired(struct zvfs_epoll_slot *slot, struct k_poll_event *poll_events)
+{
+	for (int i = 0; i < slot->pev_count; i++) {
+		if (poll_events[slot->pev_first + i].state != K_POLL_STATE_NOT_READY) {
+			return true;
+		}
+	}
+
+	return false;
+}
+
+/* Fetch the events of an entry which may be ready. Only these are passed
+ * to the POLL_UPDATE ioctl. Every wait still runs POLL_PREPARE on all the
+ * entries, as the fd objects cannot tell an instance when they get ready,
+ * so a wait costs as much as a zvfs_poll() of the same file descriptors.
+ */
+static int zvfs_epoll_update(struct zvfs_pollfd *pfd, struct zvfs_epoll_slot *slot,
+			     struct k_poll_event *poll_events)
+{
+	const struct fd_op_vtable *vtable;
+	struct k_poll_event *pev;
+	struct k_mutex *lock;
+	void *ctx;
+	int ret;
+
+	ctx = zvfs_get_fd_obj_and_vtable(pfd->fd, &vtable, &lock);
+	if (ctx == NULL) {
+		pfd->revents = ZVFS_POLLNVAL;
+		return 0;
+	}
+
+	pev = &poll_events[slot->pev_first];
+
+	(void)k_mutex_lock(lock, K_FOREVER);
+	ret = zvfs_fdtable_call_ioctl(vtable, ctx, ZFD_IOCTL_POLL_UPDATE, pfd, &pev);
+	k_mutex_unlock(lock);
+
+	if (ret == -EAGAIN) {
+		/* Not ready after all */
+		pfd->revents = 0;
+		ret = 0;
+	}
+
+	return ret;
+}
+
+/* Hand out the ready entries, and disable the one-shot ones */
+static int zvfs_epoll_report(struct zvfs_epoll *ep, struct k_mutex *lock,
+			     struct zvfs_pollfd *fds, struct zvfs_epoll_slot *slots, int count,
+			     struct zvfs_epoll_event *events, int maxevents)
+{
+	int reported = 0;
+
+	(void)k_mutex_lock(lock, K_FOREVER);
+
+	for (int i = 0; i < count && reported < maxevents; i++) {
+		struct zvfs_epoll_entry *entry = &ep->entries[slots[i].idx];
+
+		/* Skip entries removed or replaced while waiting */
+		if (fds[i].revents == 0 || entry->fd != fds[i].fd) {
+			continue;
+		}
+
+		events[reported].events = (uint16_t)fds[i].revents;
+		events[reported].data = entry->data;
+		reported++;
+
+		if (entry->events & ZVFS_EPOLLONESHOT) {
+			entry->events = ZVFS_EPOLLONESHOT;
+		}
+
+		ep->next = (slots[i].idx + 1) % ARRAY_SIZE(ep->entries);
+	}
+
+	k_mutex_unlock(lock);
+
+	return reported;
+}
+
+int zvfs_epoll_create(int flags)
+{
+	struct zvfs_epoll *ep;
+	size_t offset;
+	int fd;
+
+	if (flags != 0) {
+		errno = EINVAL;
+		return -1;
+	}
+
+	if (sys_bitarray_alloc(&epolls_bitarray, 1, &offset) < 0) {
+		errno = ENOMEM;
+		return -1;
+	}
+
+	ep = &epolls[offset];
+
+	fd = zvfs_reserve_fd();
+	if (fd < 0) {
+		sys_bitarray_free(&epolls_bitarray, 1, offset);
+		return -1;
+	}
+
+	ARRAY_FOR_EACH_PTR(ep->entries, entry) {
+		entry->fd = -1;
+	}
+
+	ep->next = 0;
+	k_poll_signal_init(&ep->ctl_sig);
+
+	zvfs_finalize_fd(fd, ep, &zvfs_epoll_fd_vtable);
+
+	return fd;
+}
+
+int zvfs_epoll_ctl(int epfd, int op, int fd, struct zvfs_epoll_event *event)
+{
+	const struct fd_op_vtable *vtable;
+	struct zvfs_epoll_entry *entry;
+	struct zvfs_epoll *ep;
+	struct k_mutex *lock;
+	int ret = 0;
+
+	ep = zvfs_epoll_get(epfd, &lock);
+	if (ep == NULL) {
+		return -1;
+	}
+
+	if (fd < 0) {
+		errno = EBADF;
+		return -1;
+	}
+
+	if (fd == epfd) {
+		errno = EINVAL;
+		return -1;
+	}
+
+	if (op != ZVFS_EPOLL_CTL_DEL) {
+		if (event == NULL || (event->events & ~ZVFS_EPOLL_EVENTS_SET) != 0) {
+			errno = EINVAL;
+			return -1;
+		}
+
+		if (zvfs_get_fd_obj_and_vtable(fd, &vtable, NULL) == NULL) {
+			return -1;
+		}
+
+		if (vtable == &zvfs_epoll_fd_vtable) {
+			errno = EINVAL;
+			return -1;
+		}
+	}
+
+	(void)k_mutex_lock(lock, K_FOREVER);
+
+	entry = zvfs_epoll_find(ep, fd);
+
+	switch (op) {
+	case ZVFS_EPOLL_CTL_ADD:
+		if (entry != NULL) {
+			errno = EEXIST;
+			ret = -1;
+			break;
+		}
+
+		entry = zvfs_epoll_find(ep, -1);
+		if (entry == NULL) {
+			errno = ENOSPC;
+			ret = -1;
+			break;
+		}
+
+		entry->fd = fd;
+		__fallthrough;
+
+	case ZVFS_EPOLL_CTL_MOD:
+		if (entry == NULL) {
+			errno = ENOENT;
+			ret = -1;
+			break;
+		}
+
+		entry->events = event->events;
+		entry->data = event->data;
+		break;
+
+	case ZVFS_EPOLL_CTL_DEL:
+		if (entry == NULL) {
+			errno = ENOENT;
+			ret = -1;
+			break;
+		}
+
+		entry->fd = -1;
+		break;
+
+	default:
+		errno = EINVAL;
+		ret = -1;
+		break;
+	}
+
+	if (ret == 0) {
+		/* Have waiters pick up the new interest list */
+		k_poll_signal_raise(&ep->ctl_sig, 0);
+	}
+
+	k_mutex_unlock(lock);
+
+	return ret;
+}
+
+int zvfs_epoll_wait(int epfd, struct zvfs_epoll_event *events, int maxevents, int timeout)
+{
+	struct zvfs_pollfd fds[CONFIG_ZVFS_EPOLL_MAX_FDS];
+	struct zvfs_epoll_slot slots[CONFIG_ZVFS_EPOLL_MAX_FDS];
+	struct k_poll_event poll_events[CONFIG_ZVFS_POLL_MAX + 1];
+	struct k_poll_event *pev_end = poll_events + ARRAY_SIZE(poll_events);
+	struct zvfs_epoll *ep;
+	struct k_mutex *lock;
+	k_timepoint_t end;
+	int ret;
+
+	ep = zvfs_epoll_get(epfd, &lock);
+	if (ep == NULL) {
+		return -1;
+	}
+
+	if (events == NULL || maxevents <= 0) {
+		errno = EINVAL;
+		return -1;
+	}
+
+	end = sys_timepoint_calc(timeout < 0 ? K_FOREVER : K_MSEC(timeout));
+
+	while (true) {
+		const struct fd_op_vtable *offl_vtable = NULL;
+		void *offl_ctx = NULL;
+		struct k_poll_event *pev;
+		bool no_wait = false;
+		int count;
+
+		(void)k_mutex_lock(lock, K_FOREVER);
+		count = zvfs_epoll_snapshot(ep, fds, slots);
+		k_mutex_unlock(lock);
+
+		/* Changes to the interest list wake up the wait */
+		k_poll_event_init(&poll_events[0], K_POLL_TYPE_SIGNAL, K_POLL_MODE_NOTIFY_ONLY,
+				  &ep->ctl_sig);
+		pev = &poll_events[1];
+
+		for (int i = 0; i < count; i++) {
+			struct k_poll_event *pev_first = pev;
+			const struct fd_op_vtable *vtable;
+			struct k_mutex *fd_lock;
+			void *ctx;
+
+			ctx = zvfs_get_fd_obj_and_vtable(fds[i].fd, &vtable, &fd_lock);
+			if (ctx == NULL) {
+				/* Closed without being removed from the list */
+				fds[i].revents = ZVFS_POLLNVAL;
+				no_wait = true;
+				continue;
+			}
+
+			(void)k_mutex_lock(fd_lock, K_FOREVER);
+			ret = zvfs_fdtable_call_ioctl(vtable, ctx, ZFD_IOCTL_POLL_PREPARE, &fds[i],
+						      &pev, pev_end);
+			k_mutex_unlock(fd_lock);
+
+			slots[i].pev_first = pev_first - poll_events;
+			slots[i].pev_count = pev - pev_first;
+
+			if (ret == -EALREADY) {
+				slots[i].ready = true;
+				no_wait = true;
+			} else if (ret == -EXDEV) {
+				/* See zvfs_poll_internal() */
+				if (offl_vtable == NULL || net_socket_is_tls(ctx)) {
+					offl_vtable = vtable;
+					offl_ctx = ctx;
+				}
+			} else if (ret < 0) {
+				errno = -ret;
+				return -1;
+			}
+		}
+
+		if (offl_vtable != NULL) {
+			int poll_timeout;
+
+			if (timeout < 0) {
+				poll_timeout = SYS_FOREVER_MS;
+			} else {
+				poll_timeout = k_ticks_to_ms_floor32(sys_timepoint_timeout(end).ticks);
+			}
+
+			ret = zvfs_fdtable_call_ioctl(offl_vtable, offl_ctx, ZFD_IOCTL_POLL_OFFLOAD,
+						      fds, count, poll_timeout);
+			if (ret < 0) {
+				return -1;
+			}
+
+			return zvfs_epoll_report(ep, lock, fds, slots, count, events, maxevents);
+		}
+
+		ret = k_poll(poll_events, pev - poll_events,
+			     no_wait ? K_NO_WAIT : sys_timepoint_timeout(end));
+		/* EAGAIN when timeout expired, EINTR when cancelled */
+		if (ret != 0 && ret != -EAGAIN && ret != -EINTR) {
+			errno = -ret;
+			return -1;
+		}
+
+		for (int i = 0; i < count; i++) {
+			if (fds[i].revents != 0 ||
+			    (!slots[i].ready && !zvfs_epoll_slot_fired(&slots[i], poll_events))) {
+				continue;
+			}
+
+			ret = zvfs_epoll_update(&fds[i], &slots[i], poll_events);
+			if (ret < 0) {
+				errno = -ret;
+				return -1;
+			}
+		}
+
+		ret = zvfs_epoll_report(ep, lock, fds, slots, count, events, maxevents);
+		if (ret > 0) {
+			return ret;
+		}
+
+		if (zvfs_epoll_get(epfd, &lock) != ep) {
+			/* Closed while waiting */
+			errno = EBADF;
+			return -1;
+		}
+
+		if (sys_timepoint_expired(end)) {
+			return 0;
+		}
+	}
+}
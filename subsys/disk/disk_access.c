@@ -18,6 +18,8 @@
 #include <zephyr/logging/log.h>
 LOG_MODULE_REGISTER(disk);
 
+#include "disk_cache.h"
+
 /* list of mounted file systems */
 static sys_dlist_t disk_access_list = SYS_DLIST_STATIC_INIT(&disk_access_list);
 
@@ -98,7 +100,11 @@ int disk_access_read(const char *pdrv, uint8_t *data_buf,
 
 	if ((disk != NULL) && (disk->ops != NULL) &&
 				(disk->ops->read != NULL)) {
-		rc = disk->ops->read(disk, data_buf, start_sector, num_sector);
+		if (IS_ENABLED(CONFIG_DISK_ACCESS_CACHE)) {
+			rc = disk_cache_read(disk, data_buf, start_sector, num_sector);
+		} else {
+			rc = disk->ops->read(disk, data_buf, start_sector, num_sector);
+		}
 	}
 
 	return rc;
@@ -112,7 +118,11 @@ int disk_access_write(const char *pdrv, const uint8_t *data_buf,
 
 	if ((disk != NULL) && (disk->ops != NULL) &&
 				(disk->ops->write != NULL)) {
-		rc = disk->ops->write(disk, data_buf, start_sector, num_sector);
+		if (IS_ENABLED(CONFIG_DISK_ACCESS_CACHE)) {
+			rc = disk_cache_write(disk, data_buf, start_sector, num_sector);
+		} else {
+			rc = disk->ops->write(disk, data_buf, start_sector, num_sector);
+		}
 	}
 
 	return rc;
@@ -142,10 +152,16 @@ int disk_access_ioctl(const char *pdrv, uint8_t cmd, void *buf)
 		case DISK_IOCTL_CTRL_DEINIT:
 			if ((buf != NULL) && (*((bool *)buf))) {
 				/* Force deinit disk */
+				if (IS_ENABLED(CONFIG_DISK_ACCESS_CACHE)) {
+					disk_cache_release(disk);
+				}
 				disk->refcnt = 0U;
 				disk->ops->ioctl(disk, cmd, buf);
 				rc = 0;
 			} else if (disk->refcnt == 1U) {
+				if (IS_ENABLED(CONFIG_DISK_ACCESS_CACHE)) {
+					disk_cache_release(disk);
+				}
 				rc = disk->ops->ioctl(disk, cmd, buf);
 				if (rc == 0) {
 					disk->refcnt--;
@@ -157,6 +173,17 @@ int disk_access_ioctl(const char *pdrv, uint8_t cmd, void *buf)
 				LOG_WRN("Disk is already deinitialized");
 			}
 			break;
+		case DISK_IOCTL_CTRL_SYNC:
+			/* Write back the cached sectors before the driver syncs */
+			if (IS_ENABLED(CONFIG_DISK_ACCESS_CACHE)) {
+				rc = disk_cache_sync(disk);
+				if (rc != 0) {
+					break;
+				}
+			}
+
+			rc = disk->ops->ioctl(disk, cmd, buf);
+			break;
 		default:
 			rc = disk->ops->ioctl(disk, cmd, buf);
 		}
@@ -182,6 +209,11 @@ int disk_access_register(struct disk_info *disk)
 	/* Initialize reference count to zero */
 	disk->refcnt = 0U;
 
+#if defined(CONFIG_DISK_ACCESS_CACHE)
+	disk->cache_sector_size = 0U;
+	memset(&disk->cache_stats, 0, sizeof(disk->cache_stats));
+#endif
+
 	spinlock_key = k_spin_lock(&lock);
 	/*  append to the disk list */
 	sys_dlist_append(&disk_access_list, &disk->node);
@@ -204,6 +236,10 @@ int disk_access_unregister(struct disk_info *disk)
 		return -EINVAL;
 	}
 
+	if (IS_ENABLED(CONFIG_DISK_ACCESS_CACHE)) {
+		disk_cache_release(disk);
+	}
+
 	spinlock_key = k_spin_lock(&lock);
 	/* remove disk node from the list */
 	sys_dlist_remove(&disk->node);
@@ -0,0 +1,417 @@
+/*
+ * Copyright (c) 2026 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <string.h>
+#include <errno.h>
+#include <zephyr/kernel.h>
+#include <zephyr/sys/dlist.h>
+#include <zephyr/sys/util.h>
+#include <zephyr/storage/disk_access.h>
+
+#include <zephyr/logging/log.h>
+LOG_MODULE_DECLARE(disk, CONFIG_DISK_LOG_LEVEL);
+
+#include "disk_cache.h"
+
+#define CACHE_SECTOR_SIZE CONFIG_DISK_ACCESS_CACHE_SECTOR_SIZE
+#define CACHE_BURST CONFIG_DISK_ACCESS_CACHE_BURST
+
+struct cache_slot {
+	/* Node in the LRU list, most recently used first */
+	sys_dnode_t node;
+	/* Disk the sector belongs to, NULL for a free slot */
+	struct disk_info *disk;
+	uint32_t sector;
+	bool dirty;
+	uint8_t *data;
+};
+
+static struct cache_slot slots[CONFIG_DISK_ACCESS_CACHE_SECTORS];
+static uint8_t slot_data[CONFIG_DISK_ACCESS_CACHE_SECTORS][CACHE_SECTOR_SIZE] __aligned(4);
+
+/* Sectors read ahead or written back at once */
+static uint8_t burst_buf[CACHE_BURST * CACHE_SECTOR_SIZE] __aligned(4);
+
+static sys_dlist_t lru = SYS_DLIST_STATIC_INIT(&lru);
+
+/* Protects the cache, held during the disk reads and writes */
+static K_MUTEX_DEFINE(cache_mutex);
+
+/* Lock the cache, setting it up on first use */
+static void cache_lock(void)
+{
+	k_mutex_lock(&cache_mutex, K_FOREVER);
+
+	if (sys_dlist_is_empty(&lru)) {
+		for (int i = 0; i < ARRAY_SIZE(slots); i++) {
+			slots[i].data = slot_data[i];
+			sys_dlist_append(&lru, &slots[i].node);
+		}
+	}
+}
+
+/* Read the sector size and count of a disk once. A disk is only cached if its
+ * sectors fit in the cache buffers.
+ */
+static bool cache_disk_usable(struct disk_info *disk)
+{
+	uint32_t size, count;
+
+	if (disk->cache_sector_size != 0U) {
+		return disk->cache_sector_size <= CACHE_SECTOR_SIZE;
+	}
+
+	if ((disk->ops->ioctl == NULL) ||
+	    (disk->ops->ioctl(disk, DISK_IOCTL_GET_SECTOR_SIZE, &size) != 0) ||
+	    (disk->ops->ioctl(disk, DISK_IOCTL_GET_SECTOR_COUNT, &count) != 0) ||
+	    (size == 0U)) {
+		return false;
+	}
+
+	if (size > CACHE_SECTOR_SIZE) {
+		LOG_WRN("disk %s sectors of %u bytes are not cached", disk->name, size);
+	}
+
+	disk->cache_sector_size = size;
+	disk->cache_sector_count = count;
+
+	return size <= CACHE_SECTOR_SIZE;
+}
+
+static struct cache_slot *cache_find(struct disk_info *disk, uint32_t sector)
+{
+	struct cache_slot *slot;
+
+	SYS_DLIST_FOR_EACH_CONTAINER(&lru, slot, node) {
+		if ((slot->disk == disk) && (slot->sector == sector)) {
+			return slot;
+		}
+	}
+
+	return NULL;
+}
+
+static void cache_touch(struct cache_slot *slot)
+{
+	sys_dlist_remove(&slot->node);
+	sys_dlist_prepend(&lru, &slot->node);
+}
+
+/* Write back the dirty sectors of a disk, lowest sector first, with up to
+ * CACHE_BURST consecutive sectors in each disk write.
+ */
+static int cache_flush(struct disk_info *disk)
+{
+	struct cache_slot *run[CACHE_BURST];
+	uint32_t size = disk->cache_sector_size;
+	struct cache_slot *slot;
+	uint32_t count;
+	int rc;
+
+	while (true) {
+		run[0] = NULL;
+
+		SYS_DLIST_FOR_EACH_CONTAINER(&lru, slot, node) {
+			if ((slot->disk == disk) && slot->dirty &&
+			    ((run[0] == NULL) || (slot->sector < run[0]->sector))) {
+				run[0] = slot;
+			}
+		}
+
+		if (run[0] == NULL) {
+			return 0;
+		}
+
+		memcpy(burst_buf, run[0]->data, size);
+
+		for (count = 1U; count < CACHE_BURST; count++) {
+			slot = cache_find(disk, run[0]->sector + count);
+			if ((slot == NULL) || !slot->dirty) {
+				break;
+			}
+
+			memcpy(&burst_buf[count * size], slot->data, size);
+			run[count] = slot;
+		}
+
+		rc = disk->ops->write(disk, burst_buf, run[0]->sector, count);
+		if (rc != 0) {
+			LOG_ERR("disk %s write back of sector %u failed (%d)",
+				disk->name, run[0]->sector, rc);
+			return rc;
+		}
+
+		for (uint32_t i = 0U; i < count; i++) {
+			run[i]->dirty = false;
+		}
+
+		disk->cache_stats.write_backs += count;
+		disk->cache_stats.write_calls++;
+	}
+}
+
+/* Take the least recently used clean slot for a sector, if any */
+static struct cache_slot *cache_alloc_clean(struct disk_info *disk, uint32_t sector)
+{
+	sys_dnode_t *node;
+	struct cache_slot *slot;
+
+	for (node = sys_dlist_peek_tail(&lru); node != NULL;
+	     node = sys_dlist_peek_prev(&lru, node)) {
+		slot = CONTAINER_OF(node, struct cache_slot, node);
+		if (!slot->dirty) {
+			slot->disk = disk;
+			slot->sector = sector;
+			cache_touch(slot);
+			return slot;
+		}
+	}
+
+	return NULL;
+}
+
+/* Take the least recently used slot for a sector, writing back the dirty
+ * sectors of its disk first if it is dirty.
+ */
+static struct cache_slot *cache_alloc(struct disk_info *disk, uint32_t sector)
+{
+	struct cache_slot *slot;
+
+	slot = CONTAINER_OF(sys_dlist_peek_tail(&lru), struct cache_slot, node);
+	if (slot->dirty && (cache_flush(slot->disk) != 0)) {
+		return NULL;
+	}
+
+	return cache_alloc_clean(disk, sector);
+}
+
+static void cache_drop(struct cache_slot *slot)
+{
+	slot->disk = NULL;
+	slot->dirty = false;
+	sys_dlist_remove(&slot->node);
+	sys_dlist_append(&lru, &slot->node);
+}
+
+static bool cache_in_range(struct disk_info *disk, uint32_t start_sector,
+			   uint32_t num_sector)
+{
+	return (start_sector < disk->cache_sector_count) &&
+	       (num_sector <= disk->cache_sector_count - start_sector);
+}
+
+/* Read sectors missing from the cache with the following ones, up to
+ * CACHE_BURST of them, and keep them in clean slots. Returns the number of
+ * requested sectors copied to data_buf, or an error code.
+ */
+static int cache_read_burst(struct disk_info *disk, uint8_t *data_buf,
+			    uint32_t sector, uint32_t num_sector)
+{
+	uint32_t size = disk->cache_sector_size;
+	uint32_t count = MIN(CACHE_BURST, disk->cache_sector_count - sector);
+	uint32_t wanted = MIN(count, num_sector);
+	struct cache_slot *slot;
+	int rc;
+
+	rc = disk->ops->read(disk, burst_buf, sector, count);
+	if (rc != 0) {
+		return rc;
+	}
+
+	for (uint32_t i = 0U; i < count; i++) {
+		/* A cached sector may be newer than the one read */
+		slot = cache_find(disk, sector + i);
+		if (slot == NULL) {
+			slot = cache_alloc_clean(disk, sector + i);
+			if (slot != NULL) {
+				memcpy(slot->data, &burst_buf[i * size], size);
+			}
+		}
+
+		if (i < wanted) {
+			memcpy(&data_buf[i * size],
+			       (slot != NULL) ? slot->data : &burst_buf[i * size], size);
+		}
+	}
+
+	disk->cache_stats.misses += wanted;
+	disk->cache_stats.read_ahead += count - wanted;
+
+	return wanted;
+}
+
+int disk_cache_read(struct disk_info *disk, uint8_t *data_buf,
+		    uint32_t start_sector, uint32_t num_sector)
+{
+	struct cache_slot *slot;
+	uint32_t size;
+	uint32_t i;
+	int rc = 0;
+
+	cache_lock();
+
+	if (!cache_disk_usable(disk)) {
+		rc = disk->ops->read(disk, data_buf, start_sector, num_sector);
+		goto unlock;
+	}
+
+	if (!cache_in_range(disk, start_sector, num_sector)) {
+		rc = -EINVAL;
+		goto unlock;
+	}
+
+	size = disk->cache_sector_size;
+
+	if (num_sector > CACHE_BURST) {
+		rc = disk->ops->read(disk, data_buf, start_sector, num_sector);
+
+		/* Dirty sectors are newer than the ones on the disk */
+		SYS_DLIST_FOR_EACH_CONTAINER(&lru, slot, node) {
+			if ((rc == 0) && (slot->disk == disk) && slot->dirty &&
+			    (slot->sector - start_sector < num_sector)) {
+				memcpy(&data_buf[(slot->sector - start_sector) * size],
+				       slot->data, size);
+			}
+		}
+
+		goto unlock;
+	}
+
+	for (i = 0U; i < num_sector; ) {
+		slot = cache_find(disk, start_sector + i);
+		if (slot != NULL) {
+			memcpy(&data_buf[i * size], slot->data, size);
+			cache_touch(slot);
+			disk->cache_stats.hits++;
+			i++;
+			continue;
+		}
+
+		rc = cache_read_burst(disk, &data_buf[i * size], start_sector + i,
+				      num_sector - i);
+		if (rc < 0) {
+			goto unlock;
+		}
+
+		i += rc;
+		rc = 0;
+	}
+
+unlock:
+	k_mutex_unlock(&cache_mutex);
+
+	return rc;
+}
+
+int disk_cache_write(struct disk_info *disk, const uint8_t *data_buf,
+		     uint32_t start_sector, uint32_t num_sector)
+{
+	struct cache_slot *slot;
+	uint32_t size;
+	int rc = 0;
+
+	cache_lock();
+
+	if (!cache_disk_usable(disk)) {
+		rc = disk->ops->write(disk, data_buf, start_sector, num_sector);
+		goto unlock;
+	}
+
+	if (!cache_in_range(disk, start_sector, num_sector)) {
+		rc = -EINVAL;
+		goto unlock;
+	}
+
+	size = disk->cache_sector_size;
+
+	if (num_sector > CACHE_BURST) {
+		rc = disk->ops->write(disk, data_buf, start_sector, num_sector);
+
+		/* Cached copies of the written sectors are now up to date */
+		SYS_DLIST_FOR_EACH_CONTAINER(&lru, slot, node) {
+			if ((rc == 0) && (slot->disk == disk) &&
+			    (slot->sector - start_sector < num_sector)) {
+				memcpy(slot->data,
+				       &data_buf[(slot->sector - start_sector) * size], size);
+				slot->dirty = false;
+			}
+		}
+
+		goto unlock;
+	}
+
+	for (uint32_t i = 0U; i < num_sector; i++) {
+		slot = cache_find(disk, start_sector + i);
+		if (slot == NULL) {
+			slot = cache_alloc(disk, start_sector + i);
+			if (slot == NULL) {
+				rc = -EIO;
+				break;
+			}
+		}
+
+		memcpy(slot->data, &data_buf[i * size], size);
+		slot->dirty = true;
+		cache_touch(slot);
+	}
+
+unlock:
+	k_mutex_unlock(&cache_mutex);
+
+	return rc;
+}
+
+int disk_cache_sync(struct disk_info *disk)
+{
+	int rc = 0;
+
+	cache_lock();
+
+	if (cache_disk_usable(disk)) {
+		rc = cache_flush(disk);
+	}
+
+	k_mutex_unlock(&cache_mutex);
+
+	return rc;
+}
+
+void disk_cache_release(struct disk_info *disk)
+{
+	struct cache_slot *slot, *next;
+
+	cache_lock();
+
+	if ((disk->cache_sector_size != 0U) && (cache_flush(disk) != 0)) {
+		LOG_WRN("disk %s dirty sectors are lost", disk->name);
+	}
+
+	SYS_DLIST_FOR_EACH_CONTAINER_SAFE(&lru, slot, next, node) {
+		if (slot->disk == disk) {
+			cache_drop(slot);
+		}
+	}
+
+	/* The media may be changed before the disk is used again */
+	disk->cache_sector_size = 0U;
+
+	k_mutex_unlock(&cache_mutex);
+}
+
+int disk_access_cache_stats(const char *pdrv, struct disk_cache_stats *stats)
+{
+	struct disk_info *disk = disk_access_get_di(pdrv);
+
+	if (disk == NULL) {
+		return -EINVAL;
+	}
+
+	cache_lock();
+	*stats = disk->cache_stats;
+	k_mutex_unlock(&cache_mutex);
+
+	return 0;
+}
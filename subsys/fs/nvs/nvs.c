@@ -10,6 +10,7 @@
 #include <errno.h>
 #include <inttypes.h>
 #include <zephyr/fs/nvs.h>
+#include <zephyr/init.h>
 #include <zephyr/sys/crc.h>
 #include "nvs_priv.h"
 
@@ -36,14 +37,139 @@ static inline size_t nvs_lookup_cache_pos(uint16_t id)
 	return hash % CONFIG_NVS_LOOKUP_CACHE_SIZE;
 }
 
+#ifdef CONFIG_NVS_LOOKUP_INDEX
+
+/* find the lookup index entry of an id, or the free entry where to add it.
+ * Returns CONFIG_NVS_LOOKUP_CACHE_SIZE when the id is not in a full index.
+ */
+static size_t nvs_lookup_index_find(struct nvs_fs *fs, uint16_t id)
+{
+	size_t pos = nvs_lookup_cache_pos(id);
+
+	for (size_t i = 0; i < CONFIG_NVS_LOOKUP_CACHE_SIZE; i++) {
+		if ((fs->lookup_ids[pos] == id) ||
+		    (fs->lookup_ids[pos] == NVS_LOOKUP_INDEX_NO_ID)) {
+			return pos;
+		}
+		pos = (pos + 1) % CONFIG_NVS_LOOKUP_CACHE_SIZE;
+	}
+
+	return CONFIG_NVS_LOOKUP_CACHE_SIZE;
+}
+
+/* free a lookup index entry, moving back the later entries of its probe
+ * sequence so that no lookup stops at the free entry before reaching them.
+ */
+static void nvs_lookup_index_remove(struct nvs_fs *fs, size_t pos)
+{
+	size_t next = pos;
+	size_t home;
+
+	for (size_t i = 1; i < CONFIG_NVS_LOOKUP_CACHE_SIZE; i++) {
+		next = (next + 1) % CONFIG_NVS_LOOKUP_CACHE_SIZE;
+		if (fs->lookup_ids[next] == NVS_LOOKUP_INDEX_NO_ID) {
+			break;
+		}
+
+		/* the entry can move to the free entry unless its probe
+		 * sequence starts after the free entry
+		 */
+		home = nvs_lookup_cache_pos(fs->lookup_ids[next]);
+		if (((next + CONFIG_NVS_LOOKUP_CACHE_SIZE - home) % CONFIG_NVS_LOOKUP_CACHE_SIZE) >=
+		    ((next + CONFIG_NVS_LOOKUP_CACHE_SIZE - pos) % CONFIG_NVS_LOOKUP_CACHE_SIZE)) {
+			fs->lookup_ids[pos] = fs->lookup_ids[next];
+			fs->lookup_cache[pos] = fs->lookup_cache[next];
+			pos = next;
+		}
+	}
+
+	fs->lookup_ids[pos] = NVS_LOOKUP_INDEX_NO_ID;
+	fs->lookup_cache[pos] = NVS_LOOKUP_CACHE_NO_ADDR;
+}
+
+#endif /* CONFIG_NVS_LOOKUP_INDEX */
+
+/* address where the walk looking for the latest ate of an id starts,
+ * NVS_LOOKUP_CACHE_NO_ADDR if the id is not stored.
+ */
+static uint32_t nvs_lookup_cache_get(struct nvs_fs *fs, uint16_t id)
+{
+#ifdef CONFIG_NVS_LOOKUP_INDEX
+	size_t pos = nvs_lookup_index_find(fs, id);
+
+	if ((pos == CONFIG_NVS_LOOKUP_CACHE_SIZE) || (fs->lookup_ids[pos] != id)) {
+		/* the ids left out of a full index are not known */
+		return fs->lookup_index_overflow ? fs->ate_wra : NVS_LOOKUP_CACHE_NO_ADDR;
+	}
+
+	return fs->lookup_cache[pos];
+#else
+	return fs->lookup_cache[nvs_lookup_cache_pos(id)];
+#endif
+}
+
+static void nvs_lookup_cache_set(struct nvs_fs *fs, uint16_t id, uint32_t ate_addr)
+{
+#ifdef CONFIG_NVS_LOOKUP_INDEX
+	size_t pos = nvs_lookup_index_find(fs, id);
+
+	if (ate_addr == NVS_LOOKUP_CACHE_NO_ADDR) {
+		/* the id is deleted, it is not stored in the index */
+		if ((pos != CONFIG_NVS_LOOKUP_CACHE_SIZE) && (fs->lookup_ids[pos] == id)) {
+			nvs_lookup_index_remove(fs, pos);
+		}
+		return;
+	}
+
+	if (pos == CONFIG_NVS_LOOKUP_CACHE_SIZE) {
+		fs->lookup_index_overflow = true;
+		return;
+	}
+
+	fs->lookup_ids[pos] = id;
+	fs->lookup_cache[pos] = ate_addr;
+#else
+	fs->lookup_cache[nvs_lookup_cache_pos(id)] = ate_addr;
+#endif
+}
+
+static void nvs_lookup_cache_invalidate(struct nvs_fs *fs, uint32_t sector)
+{
+#ifdef CONFIG_NVS_LOOKUP_INDEX
+	size_t pos = 0;
+
+	/* freeing an entry can move a later one to its position, check it too */
+	while (pos < CONFIG_NVS_LOOKUP_CACHE_SIZE) {
+		if ((fs->lookup_ids[pos] != NVS_LOOKUP_INDEX_NO_ID) &&
+		    ((fs->lookup_cache[pos] >> ADDR_SECT_SHIFT) == sector)) {
+			nvs_lookup_index_remove(fs, pos);
+		} else {
+			pos++;
+		}
+	}
+#else
+	uint32_t *cache_entry = fs->lookup_cache;
+	uint32_t *const cache_end = &fs->lookup_cache[CONFIG_NVS_LOOKUP_CACHE_SIZE];
+
+	for (; cache_entry < cache_end; ++cache_entry) {
+		if ((*cache_entry >> ADDR_SECT_SHIFT) == sector) {
+			*cache_entry = NVS_LOOKUP_CACHE_NO_ADDR;
+		}
+	}
+#endif
+}
+
 static int nvs_lookup_cache_rebuild(struct nvs_fs *fs)
 {
 	int rc;
 	uint32_t addr, ate_addr;
-	uint32_t *cache_entry;
 	struct nvs_ate ate;
 
 	memset(fs->lookup_cache, 0xff, sizeof(fs->lookup_cache));
+#ifdef CONFIG_NVS_LOOKUP_INDEX
+	memset(fs->lookup_ids, 0xff, sizeof(fs->lookup_ids));
+	fs->lookup_index_overflow = false;
+#endif
 	addr = fs->ate_wra;
 
 	while (true) {
@@ -55,11 +181,19 @@ static int nvs_lookup_cache_rebuild(struct nvs_fs *fs)
 			return rc;
 		}
 
-		cache_entry = &fs->lookup_cache[nvs_lookup_cache_pos(ate.id)];
-
-		if (ate.id != 0xFFFF && *cache_entry == NVS_LOOKUP_CACHE_NO_ADDR &&
+		/* the first ate found is the latest one */
+		if (ate.id != 0xFFFF &&
+		    nvs_lookup_cache_get(fs, ate.id) == NVS_LOOKUP_CACHE_NO_ADDR &&
 		    nvs_ate_valid(fs, &ate)) {
-			*cache_entry = ate_addr;
+#ifdef CONFIG_NVS_LOOKUP_INDEX
+			/* keep the deleted ids until the end of the walk, so
+			 * that their older ates are skipped
+			 */
+			if (ate.len == 0U) {
+				ate_addr = NVS_LOOKUP_INDEX_DELETED;
+			}
+#endif
+			nvs_lookup_cache_set(fs, ate.id, ate_addr);
 		}
 
 		if (addr == fs->ate_wra) {
@@ -67,19 +201,12 @@ static int nvs_lookup_cache_rebuild(struct nvs_fs *fs)
 		}
 	}
 
-	return 0;
-}
-
-static void nvs_lookup_cache_invalidate(struct nvs_fs *fs, uint32_t sector)
-{
-	uint32_t *cache_entry = fs->lookup_cache;
-	uint32_t *const cache_end = &fs->lookup_cache[CONFIG_NVS_LOOKUP_CACHE_SIZE];
+#ifdef CONFIG_NVS_LOOKUP_INDEX
+	/* the deleted ids are not stored, free their entries */
+	nvs_lookup_cache_invalidate(fs, NVS_LOOKUP_INDEX_DELETED >> ADDR_SECT_SHIFT);
+#endif
 
-	for (; cache_entry < cache_end; ++cache_entry) {
-		if ((*cache_entry >> ADDR_SECT_SHIFT) == sector) {
-			*cache_entry = NVS_LOOKUP_CACHE_NO_ADDR;
-		}
-	}
+	return 0;
 }
 
 #endif /* CONFIG_NVS_LOOKUP_CACHE */
@@ -166,7 +293,13 @@ static int nvs_flash_ate_wrt(struct nvs_fs *fs, const struct nvs_ate *entry)
 #ifdef CONFIG_NVS_LOOKUP_CACHE
 	/* 0xFFFF is a special-purpose identifier. Exclude it from the cache */
 	if (entry->id != 0xFFFF) {
-		fs->lookup_cache[nvs_lookup_cache_pos(entry->id)] = fs->ate_wra;
+#ifdef CONFIG_NVS_LOOKUP_INDEX
+		/* a deleted id is removed from the index */
+		nvs_lookup_cache_set(fs, entry->id,
+				     entry->len ? fs->ate_wra : NVS_LOOKUP_CACHE_NO_ADDR);
+#else
+		nvs_lookup_cache_set(fs, entry->id, fs->ate_wra);
+#endif
 	}
 #endif
 	fs->ate_wra -= nvs_al_size(fs, sizeof(struct nvs_ate));
@@ -539,6 +672,18 @@ static int nvs_prev_ate(struct nvs_fs *fs, uint32_t *addr, struct nvs_ate *ate)
 		*addr -= (1 << ADDR_SECT_SHIFT);
 	}
 
+#ifdef CONFIG_NVS_BACKGROUND_GC
+	/* the sector after the write sector is garbage collected but not yet
+	 * erased, it is at the end of filesystem
+	 */
+	if (fs->gc_erase_pending &&
+	    (((*addr) >> ADDR_SECT_SHIFT) ==
+	     (((fs->ate_wra >> ADDR_SECT_SHIFT) + 1) % fs->sector_count))) {
+		*addr = fs->ate_wra;
+		return 0;
+	}
+#endif
+
 	rc = nvs_flash_ate_rd(fs, *addr, &close_ate);
 	if (rc) {
 		return rc;
@@ -577,6 +722,48 @@ static void nvs_sector_advance(struct nvs_fs *fs, uint32_t *addr)
 	}
 }
 
+#ifdef CONFIG_NVS_BACKGROUND_GC
+
+static K_THREAD_STACK_DEFINE(nvs_gc_stack, CONFIG_NVS_BACKGROUND_GC_STACK_SIZE);
+static struct k_work_q nvs_gc_wq;
+
+/* erase the sector after the write sector when its erase was left to the
+ * background gc
+ */
+static int nvs_gc_erase_pending(struct nvs_fs *fs)
+{
+	int rc;
+	uint32_t addr;
+
+	if (!fs->gc_erase_pending) {
+		return 0;
+	}
+
+	addr = fs->ate_wra & ADDR_SECT_MASK;
+	nvs_sector_advance(fs, &addr);
+
+	rc = nvs_flash_erase_sector(fs, addr);
+	if (rc) {
+		return rc;
+	}
+
+	fs->gc_erase_pending = false;
+
+	return 0;
+}
+
+/* check if the write sector is filled enough to be garbage collected ahead
+ * of time
+ */
+static bool nvs_gc_threshold_reached(struct nvs_fs *fs)
+{
+	uint32_t used = fs->sector_size - (fs->ate_wra - fs->data_wra);
+
+	return (used * 100U) >= (CONFIG_NVS_BACKGROUND_GC_THRESHOLD * fs->sector_size);
+}
+
+#endif /* CONFIG_NVS_BACKGROUND_GC */
+
 /* allocation entry close (this closes the current sector) by writing offset
  * of last ate to the sector end.
  */
@@ -585,6 +772,16 @@ static int nvs_sector_close(struct nvs_fs *fs)
 	struct nvs_ate close_ate;
 	size_t ate_size;
 
+#ifdef CONFIG_NVS_BACKGROUND_GC
+	int rc;
+
+	/* the next sector must be erased before it is used */
+	rc = nvs_gc_erase_pending(fs);
+	if (rc) {
+		return rc;
+	}
+#endif
+
 	ate_size = nvs_al_size(fs, sizeof(struct nvs_ate));
 
 	close_ate.id = 0xFFFF;
@@ -674,7 +871,7 @@ static int nvs_gc(struct nvs_fs *fs)
 		}
 
 #ifdef CONFIG_NVS_LOOKUP_CACHE
-		wlk_addr = fs->lookup_cache[nvs_lookup_cache_pos(gc_ate.id)];
+		wlk_addr = nvs_lookup_cache_get(fs, gc_ate.id);
 
 		if (wlk_addr == NVS_LOOKUP_CACHE_NO_ADDR) {
 			wlk_addr = fs->ate_wra;
@@ -737,6 +934,20 @@ gc_done:
 		if (rc) {
 			return rc;
 		}
+
+#ifdef CONFIG_NVS_BACKGROUND_GC
+		/* The gc done ate allows to finish the erase at startup after
+		 * a power loss, so it can be left to the background gc.
+		 */
+		if (fs->background_gc) {
+#ifdef CONFIG_NVS_LOOKUP_CACHE
+			nvs_lookup_cache_invalidate(fs, sec_addr >> ADDR_SECT_SHIFT);
+#endif
+			fs->gc_erase_pending = true;
+			(void)k_work_submit_to_queue(&nvs_gc_wq, &fs->gc_work);
+			return 0;
+		}
+#endif
 	}
 
 	/* Erase the gc'ed sector */
@@ -745,6 +956,77 @@ gc_done:
 	return rc;
 }
 
+#ifdef CONFIG_NVS_BACKGROUND_GC
+
+/* background gc, each step is done with the file system locked: the erase of
+ * the sector left by the last gc, then the gc of the write sector if it was
+ * requested by nvs_write().
+ */
+static void nvs_gc_work_handler(struct k_work *work)
+{
+	struct nvs_fs *fs = CONTAINER_OF(work, struct nvs_fs, gc_work);
+	int rc = 0;
+
+	k_mutex_lock(&fs->nvs_lock, K_FOREVER);
+
+	if (!fs->ready) {
+		goto end;
+	}
+
+	if (fs->gc_erase_pending) {
+		rc = nvs_gc_erase_pending(fs);
+		if (rc) {
+			goto end;
+		}
+#ifdef CONFIG_NVS_GC_STATS
+		fs->gc_stats.background_erases++;
+#endif
+		/* let the writes waiting for the lock run before the gc */
+		if (fs->gc_requested) {
+			(void)k_work_submit_to_queue(&nvs_gc_wq, &fs->gc_work);
+		}
+	} else if (fs->gc_requested) {
+		fs->gc_requested = false;
+
+		rc = nvs_sector_close(fs);
+		if (rc) {
+			goto end;
+		}
+
+		rc = nvs_gc(fs);
+		if (rc) {
+			goto end;
+		}
+#ifdef CONFIG_NVS_GC_STATS
+		fs->gc_stats.background++;
+#endif
+	}
+
+end:
+	k_mutex_unlock(&fs->nvs_lock);
+
+	if (rc) {
+		LOG_ERR("Background gc failed: %d", rc);
+	}
+}
+
+static int nvs_gc_wq_init(void)
+{
+	const struct k_work_queue_config cfg = {.name = "nvs_gc"};
+
+	k_work_queue_init(&nvs_gc_wq);
+
+	k_work_queue_start(&nvs_gc_wq, nvs_gc_stack,
+			   K_THREAD_STACK_SIZEOF(nvs_gc_stack),
+			   K_LOWEST_APPLICATION_THREAD_PRIO, &cfg);
+
+	return 0;
+}
+
+SYS_INIT(nvs_gc_wq_init, POST_KERNEL, CONFIG_KERNEL_INIT_PRIORITY_DEFAULT);
+
+#endif /* CONFIG_NVS_BACKGROUND_GC */
+
 static int nvs_startup(struct nvs_fs *fs)
 {
 	int rc;
@@ -894,28 +1176,39 @@ static int nvs_startup(struct nvs_fs *fs)
 			addr = fs->ate_wra & ADDR_SECT_MASK;
 			nvs_sector_advance(fs, &addr);
 			rc = nvs_flash_erase_sector(fs, addr);
-			goto end;
-		}
-		LOG_INF("No GC Done marker found: restarting gc");
-		rc = nvs_flash_erase_sector(fs, fs->ate_wra);
-		if (rc) {
-			goto end;
-		}
-		fs->ate_wra &= ADDR_SECT_MASK;
-		fs->ate_wra += (fs->sector_size - 2 * ate_size);
-		fs->data_wra = (fs->ate_wra & ADDR_SECT_MASK);
+			if (rc) {
+				goto end;
+			}
+			/* With background gc, data may have been written after
+			 * the gc, and torn by a power loss before that erase:
+			 * recover the data write address below.
+			 */
+		} else {
+			LOG_INF("No GC Done marker found: restarting gc");
+			rc = nvs_flash_erase_sector(fs, fs->ate_wra);
+			if (rc) {
+				goto end;
+			}
+			fs->ate_wra &= ADDR_SECT_MASK;
+			fs->ate_wra += (fs->sector_size - 2 * ate_size);
+			fs->data_wra = (fs->ate_wra & ADDR_SECT_MASK);
 #ifdef CONFIG_NVS_LOOKUP_CACHE
-		/**
-		 * At this point, the lookup cache wasn't built but the gc function need to use it.
-		 * So, temporarily, we set the lookup cache to the end of the fs.
-		 * The cache will be rebuilt afterwards
-		 **/
-		for (i = 0; i < CONFIG_NVS_LOOKUP_CACHE_SIZE; i++) {
-			fs->lookup_cache[i] = fs->ate_wra;
-		}
+			/**
+			 * At this point, the lookup cache wasn't built but the gc function
+			 * need to use it. So, temporarily, we set the lookup cache to the
+			 * end of the fs. The cache will be rebuilt afterwards
+			 **/
+			for (i = 0; i < CONFIG_NVS_LOOKUP_CACHE_SIZE; i++) {
+				fs->lookup_cache[i] = fs->ate_wra;
+			}
+#ifdef CONFIG_NVS_LOOKUP_INDEX
+			memset(fs->lookup_ids, 0xff, sizeof(fs->lookup_ids));
+			fs->lookup_index_overflow = true;
 #endif
-		rc = nvs_gc(fs);
-		goto end;
+#endif
+			rc = nvs_gc(fs);
+			goto end;
+		}
 	}
 
 	/* possible data write after last ate write, update data_wra */
@@ -970,12 +1263,21 @@ int nvs_clear(struct nvs_fs *fs)
 {
 	int rc;
 	uint32_t addr;
+#ifdef CONFIG_NVS_BACKGROUND_GC
+	struct k_work_sync sync;
+#endif
 
 	if (!fs->ready) {
 		LOG_ERR("NVS not initialized");
 		return -EACCES;
 	}
 
+#ifdef CONFIG_NVS_BACKGROUND_GC
+	(void)k_work_cancel_sync(&fs->gc_work, &sync);
+	fs->gc_erase_pending = false;
+	fs->gc_requested = false;
+#endif
+
 	for (uint16_t i = 0; i < fs->sector_count; i++) {
 		addr = i << ADDR_SECT_SHIFT;
 		rc = nvs_flash_erase_sector(fs, addr);
@@ -996,6 +1298,22 @@ int nvs_mount(struct nvs_fs *fs)
 	struct flash_pages_info info;
 	size_t write_block_size;
 
+#ifdef CONFIG_NVS_BACKGROUND_GC
+	struct k_work_sync sync;
+
+	/* a mounted file system may still have background gc work queued */
+	if (fs->ready) {
+		(void)k_work_cancel_sync(&fs->gc_work, &sync);
+	}
+
+	k_work_init(&fs->gc_work, nvs_gc_work_handler);
+	fs->gc_erase_pending = false;
+	fs->gc_requested = false;
+#endif
+#ifdef CONFIG_NVS_GC_STATS
+	memset(&fs->gc_stats, 0, sizeof(fs->gc_stats));
+#endif
+
 	k_mutex_init(&fs->nvs_lock);
 
 	fs->flash_parameters = flash_get_parameters(fs->flash_device);
@@ -1037,6 +1355,13 @@ int nvs_mount(struct nvs_fs *fs)
 	/* nvs is ready for use */
 	fs->ready = true;
 
+#ifdef CONFIG_NVS_BACKGROUND_GC
+	/* finish the gc done at startup in the background */
+	if (fs->gc_erase_pending) {
+		(void)k_work_submit_to_queue(&nvs_gc_wq, &fs->gc_work);
+	}
+#endif
+
 	LOG_INF("%d Sectors of %d bytes", fs->sector_count, fs->sector_size);
 	LOG_INF("alloc wra: %d, %x",
 		(fs->ate_wra >> ADDR_SECT_SHIFT),
@@ -1048,7 +1373,7 @@ int nvs_mount(struct nvs_fs *fs)
 	return 0;
 }
 
-ssize_t nvs_write(struct nvs_fs *fs, uint16_t id, const void *data, size_t len)
+static ssize_t nvs_write_entry(struct nvs_fs *fs, uint16_t id, const void *data, size_t len)
 {
 	int rc, gc_count;
 	size_t ate_size, data_size;
@@ -1056,6 +1381,9 @@ ssize_t nvs_write(struct nvs_fs *fs, uint16_t id, const void *data, size_t len)
 	uint32_t wlk_addr, rd_addr;
 	uint16_t required_space = 0U; /* no space, appropriate for delete ate */
 	bool prev_found = false;
+#ifdef CONFIG_NVS_BACKGROUND_GC
+	bool gc_threshold_reached;
+#endif
 
 	if (!fs->ready) {
 		LOG_ERR("NVS not initialized");
@@ -1078,7 +1406,7 @@ ssize_t nvs_write(struct nvs_fs *fs, uint16_t id, const void *data, size_t len)
 
 	/* find latest entry with same id */
 #ifdef CONFIG_NVS_LOOKUP_CACHE
-	wlk_addr = fs->lookup_cache[nvs_lookup_cache_pos(id)];
+	wlk_addr = nvs_lookup_cache_get(fs, id);
 
 	if (wlk_addr == NVS_LOOKUP_CACHE_NO_ADDR) {
 		goto no_cached_entry;
@@ -1143,6 +1471,10 @@ no_cached_entry:
 
 	k_mutex_lock(&fs->nvs_lock, K_FOREVER);
 
+#ifdef CONFIG_NVS_BACKGROUND_GC
+	gc_threshold_reached = nvs_gc_threshold_reached(fs);
+#endif
+
 	gc_count = 0;
 	while (1) {
 		if (gc_count == fs->sector_count) {
@@ -1174,17 +1506,106 @@ no_cached_entry:
 		}
 		gc_count++;
 	}
+
+#ifdef CONFIG_NVS_BACKGROUND_GC
+	if (gc_count) {
+		/* the write sector just got garbage collected */
+		fs->gc_requested = false;
+	} else if (fs->background_gc && !gc_threshold_reached &&
+		   nvs_gc_threshold_reached(fs)) {
+		/* this write filled the sector above the threshold */
+		fs->gc_requested = true;
+		(void)k_work_submit_to_queue(&nvs_gc_wq, &fs->gc_work);
+	}
+#endif
+
 	rc = len;
 end:
+#ifdef CONFIG_NVS_GC_STATS
+	fs->gc_stats.foreground += gc_count;
+#endif
 	k_mutex_unlock(&fs->nvs_lock);
 	return rc;
 }
 
+ssize_t nvs_write(struct nvs_fs *fs, uint16_t id, const void *data, size_t len)
+{
+#ifdef CONFIG_NVS_GC_STATS
+	uint32_t start = k_cycle_get_32();
+	ssize_t rc;
+	uint32_t us;
+
+	rc = nvs_write_entry(fs, id, data, len);
+
+	if (!fs->ready) {
+		return rc;
+	}
+
+	us = k_cyc_to_us_ceil32(k_cycle_get_32() - start);
+
+	/* The other statistics are updated with the lock held too */
+	k_mutex_lock(&fs->nvs_lock, K_FOREVER);
+	if (us > fs->gc_stats.write_max_us) {
+		fs->gc_stats.write_max_us = us;
+	}
+	k_mutex_unlock(&fs->nvs_lock);
+
+	return rc;
+#else
+	return nvs_write_entry(fs, id, data, len);
+#endif
+}
+
 int nvs_delete(struct nvs_fs *fs, uint16_t id)
 {
 	return nvs_write(fs, id, NULL, 0);
 }
 
+/* Read the data of the valid ate found at ate_addr, and check its CRC when
+ * all of it is read. Returns the data length, or an error code.
+ */
+static ssize_t nvs_ate_data_rd(struct nvs_fs *fs, uint32_t ate_addr,
+			       const struct nvs_ate *ate, void *data, size_t len)
+{
+	int rc;
+	uint32_t rd_addr;
+#ifdef CONFIG_NVS_DATA_CRC
+	uint32_t read_data_crc, computed_data_crc;
+
+	/* When data CRC is enabled, there should be at least the CRC stored in the data field */
+	if (ate->len < NVS_DATA_CRC_SIZE) {
+		return -ENOENT;
+	}
+#endif
+
+	rd_addr = ate_addr & ADDR_SECT_MASK;
+	rd_addr += ate->offset;
+	rc = nvs_flash_rd(fs, rd_addr, data, MIN(len, ate->len - NVS_DATA_CRC_SIZE));
+	if (rc) {
+		return rc;
+	}
+
+	/* Check data CRC (only if the whole element data has been read) */
+#ifdef CONFIG_NVS_DATA_CRC
+	if (len >= (ate->len - NVS_DATA_CRC_SIZE)) {
+		rd_addr += ate->len - NVS_DATA_CRC_SIZE;
+		rc = nvs_flash_rd(fs, rd_addr, &read_data_crc, sizeof(read_data_crc));
+		if (rc) {
+			return rc;
+		}
+
+		computed_data_crc = crc32_ieee(data, ate->len - NVS_DATA_CRC_SIZE);
+		if (read_data_crc != computed_data_crc) {
+			LOG_ERR("Invalid data CRC: read_data_crc=0x%08X, computed_data_crc=0x%08X",
+				read_data_crc, computed_data_crc);
+			return -EIO;
+		}
+	}
+#endif
+
+	return ate->len - NVS_DATA_CRC_SIZE;
+}
+
 ssize_t nvs_read_hist(struct nvs_fs *fs, uint16_t id, void *data, size_t len,
 		      uint16_t cnt)
 {
@@ -1193,9 +1614,6 @@ ssize_t nvs_read_hist(struct nvs_fs *fs, uint16_t id, void *data, size_t len,
 	uint16_t cnt_his;
 	struct nvs_ate wlk_ate;
 	size_t ate_size;
-#ifdef CONFIG_NVS_DATA_CRC
-	uint32_t read_data_crc, computed_data_crc;
-#endif
 
 	if (!fs->ready) {
 		LOG_ERR("NVS not initialized");
@@ -1211,7 +1629,7 @@ ssize_t nvs_read_hist(struct nvs_fs *fs, uint16_t id, void *data, size_t len,
 	cnt_his = 0U;
 
 #ifdef CONFIG_NVS_LOOKUP_CACHE
-	wlk_addr = fs->lookup_cache[nvs_lookup_cache_pos(id)];
+	wlk_addr = nvs_lookup_cache_get(fs, id);
 
 	if (wlk_addr == NVS_LOOKUP_CACHE_NO_ADDR) {
 		rc = -ENOENT;
@@ -1222,6 +1640,26 @@ ssize_t nvs_read_hist(struct nvs_fs *fs, uint16_t id, void *data, size_t len,
 #endif
 	rd_addr = wlk_addr;
 
+#ifdef CONFIG_NVS_LOOKUP_INDEX
+	/* the index holds the address of the latest ate of the id, unless it
+	 * did not fit in the index
+	 */
+	if ((cnt == 0U) && (wlk_addr != fs->ate_wra)) {
+		rc = nvs_flash_ate_rd(fs, wlk_addr, &wlk_ate);
+		if (rc) {
+			goto err;
+		}
+
+		if ((wlk_ate.id == id) && nvs_ate_valid(fs, &wlk_ate)) {
+			if (wlk_ate.len == 0U) {
+				return -ENOENT;
+			}
+
+			return nvs_ate_data_rd(fs, wlk_addr, &wlk_ate, data, len);
+		}
+	}
+#endif
+
 	while (cnt_his <= cnt) {
 		rd_addr = wlk_addr;
 		rc = nvs_prev_ate(fs, &wlk_addr, &wlk_ate);
@@ -1241,51 +1679,92 @@ ssize_t nvs_read_hist(struct nvs_fs *fs, uint16_t id, void *data, size_t len,
 		return -ENOENT;
 	}
 
-#ifdef CONFIG_NVS_DATA_CRC
-	/* When data CRC is enabled, there should be at least the CRC stored in the data field */
-	if (wlk_ate.len < NVS_DATA_CRC_SIZE) {
-		return -ENOENT;
-	}
-#endif
+	return nvs_ate_data_rd(fs, rd_addr, &wlk_ate, data, len);
 
-	rd_addr &= ADDR_SECT_MASK;
-	rd_addr += wlk_ate.offset;
-	rc = nvs_flash_rd(fs, rd_addr, data, MIN(len, wlk_ate.len - NVS_DATA_CRC_SIZE));
-	if (rc) {
-		goto err;
+err:
+	return rc;
+}
+
+ssize_t nvs_read(struct nvs_fs *fs, uint16_t id, void *data, size_t len)
+{
+	int rc;
+
+	rc = nvs_read_hist(fs, id, data, len, 0);
+	return rc;
+}
+
+int nvs_foreach(struct nvs_fs *fs, nvs_entry_cb_t cb, void *arg)
+{
+	int rc;
+	uint32_t wlk_addr;
+	struct nvs_ate wlk_ate;
+	struct nvs_entry entry;
+
+	if (!fs->ready) {
+		LOG_ERR("NVS not initialized");
+		return -EACCES;
 	}
 
-	/* Check data CRC (only if the whole element data has been read) */
-#ifdef CONFIG_NVS_DATA_CRC
-	if (len >= (wlk_ate.len - NVS_DATA_CRC_SIZE)) {
-		rd_addr += wlk_ate.len - NVS_DATA_CRC_SIZE;
-		rc = nvs_flash_rd(fs, rd_addr, &read_data_crc, sizeof(read_data_crc));
+	wlk_addr = fs->ate_wra;
+
+	do {
+		entry.ate_addr = wlk_addr;
+		rc = nvs_prev_ate(fs, &wlk_addr, &wlk_ate);
 		if (rc) {
-			goto err;
+			return rc;
 		}
 
-		computed_data_crc = crc32_ieee(data, wlk_ate.len - NVS_DATA_CRC_SIZE);
-		if (read_data_crc != computed_data_crc) {
-			LOG_ERR("Invalid data CRC: read_data_crc=0x%08X, computed_data_crc=0x%08X",
-				read_data_crc, computed_data_crc);
-			rc = -EIO;
-			goto err;
+		/* Skip the sector close and gc done ate's, and the corrupted ones */
+		if (!nvs_ate_valid(fs, &wlk_ate) ||
+		    ((wlk_ate.id == 0xFFFF) && (wlk_ate.len == 0U))) {
+			continue;
 		}
-	}
-#endif
 
-	return wlk_ate.len - NVS_DATA_CRC_SIZE;
+		entry.id = wlk_ate.id;
+		entry.len = wlk_ate.len;
 
-err:
-	return rc;
+		/* A deleted entry has no CRC, a shorter one is reported as deleted */
+		if (IS_ENABLED(CONFIG_NVS_DATA_CRC) && (entry.len > 0U)) {
+			entry.len = (entry.len < NVS_DATA_CRC_SIZE) ?
+				    0U : entry.len - NVS_DATA_CRC_SIZE;
+		}
+
+		rc = cb(fs, &entry, arg);
+		if (rc) {
+			return rc;
+		}
+	} while (wlk_addr != fs->ate_wra);
+
+	return 0;
 }
 
-ssize_t nvs_read(struct nvs_fs *fs, uint16_t id, void *data, size_t len)
+ssize_t nvs_entry_read(struct nvs_fs *fs, const struct nvs_entry *entry,
+		       void *data, size_t len)
 {
 	int rc;
+	struct nvs_ate ate;
 
-	rc = nvs_read_hist(fs, id, data, len, 0);
-	return rc;
+	if (!fs->ready) {
+		LOG_ERR("NVS not initialized");
+		return -EACCES;
+	}
+
+	if (entry->len == 0U) {
+		return -ENOENT;
+	}
+
+	/* The ate is gone when its sector was garbage collected in between */
+	rc = nvs_flash_ate_rd(fs, entry->ate_addr, &ate);
+	if (rc) {
+		return rc;
+	}
+
+	if ((ate.id != entry->id) || !nvs_ate_valid(fs, &ate) ||
+	    (ate.len != entry->len + NVS_DATA_CRC_SIZE)) {
+		return -ENOENT;
+	}
+
+	return nvs_ate_data_rd(fs, entry->ate_addr, &ate, data, len);
 }
 
 ssize_t nvs_calc_free_space(struct nvs_fs *fs)
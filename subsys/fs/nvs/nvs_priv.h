@@ -29,6 +29,8 @@ extern "C" {
 #define NVS_BLOCK_SIZE 32
 
 #define NVS_LOOKUP_CACHE_NO_ADDR 0xFFFFFFFF
+#define NVS_LOOKUP_INDEX_NO_ID 0xFFFF
+#define NVS_LOOKUP_INDEX_DELETED 0xFFFFFFFE
 
 /*
  * Allow to use the NVS_DATA_CRC_SIZE macro in computations whether data CRC is enabled or not
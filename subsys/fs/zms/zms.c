@@ -9,6 +9,7 @@
 #include <errno.h>
 #include <inttypes.h>
 #include <zephyr/fs/zms.h>
+#include <zephyr/init.h>
 #include <zephyr/sys/crc.h>
 #include "zms_priv.h"
 
@@ -22,6 +23,7 @@ static int zms_get_sector_header(struct zms_fs *fs, uint64_t addr, struct zms_at
 				 struct zms_ate *close_ate);
 static int zms_ate_valid_different_sector(struct zms_fs *fs, const struct zms_ate *entry,
 					  uint8_t cycle_cnt);
+static int zms_add_empty_ate(struct zms_fs *fs, uint64_t addr);
 
 #ifdef CONFIG_ZMS_LOOKUP_CACHE
 
@@ -606,6 +608,17 @@ static int zms_compute_prev_addr(struct zms_fs *fs, uint64_t *addr)
 		*addr -= (1ULL << ADDR_SECT_SHIFT);
 	}
 
+#ifdef CONFIG_ZMS_BACKGROUND_GC
+	/* The sector after the write sector is garbage collected but not yet
+	 * erased, it is at the end of filesystem
+	 */
+	if (fs->gc_erase_pending &&
+	    (SECTOR_NUM(*addr) == ((SECTOR_NUM(fs->ate_wra) + 1) % fs->sector_count))) {
+		*addr = fs->ate_wra;
+		return 0;
+	}
+#endif
+
 	/* verify if the sector is closed */
 	sec_closed = zms_validate_closed_sector(fs, *addr, &empty_ate, &close_ate);
 	if (sec_closed < 0) {
@@ -649,6 +662,53 @@ static void zms_sector_advance(struct zms_fs *fs, uint64_t *addr)
 	}
 }
 
+#ifdef CONFIG_ZMS_BACKGROUND_GC
+
+static K_THREAD_STACK_DEFINE(zms_gc_stack, CONFIG_ZMS_BACKGROUND_GC_STACK_SIZE);
+static struct k_work_q zms_gc_wq;
+
+/* Erase the sector after the write sector, and add its empty ATE, when this
+ * was left to the background GC
+ */
+static int zms_gc_erase_pending(struct zms_fs *fs)
+{
+	int rc;
+	uint64_t addr;
+
+	if (!fs->gc_erase_pending) {
+		return 0;
+	}
+
+	addr = fs->ate_wra & ADDR_SECT_MASK;
+	zms_sector_advance(fs, &addr);
+
+	rc = zms_flash_erase_sector(fs, addr);
+	if (rc) {
+		return rc;
+	}
+
+	rc = zms_add_empty_ate(fs, addr);
+	if (rc) {
+		return rc;
+	}
+
+	fs->gc_erase_pending = false;
+
+	return 0;
+}
+
+/* Check if the write sector is filled enough to be garbage collected ahead
+ * of time
+ */
+static bool zms_gc_threshold_reached(struct zms_fs *fs)
+{
+	uint64_t used = fs->sector_size - (fs->ate_wra - fs->data_wra);
+
+	return (used * 100U) >= ((uint64_t)CONFIG_ZMS_BACKGROUND_GC_THRESHOLD * fs->sector_size);
+}
+
+#endif /* CONFIG_ZMS_BACKGROUND_GC */
+
 /* allocation entry close (this closes the current sector) by writing offset
  * of last ate to the sector end.
  */
@@ -658,6 +718,14 @@ static int zms_sector_close(struct zms_fs *fs)
 	struct zms_ate close_ate;
 	struct zms_ate garbage_ate;
 
+#ifdef CONFIG_ZMS_BACKGROUND_GC
+	/* The next sector must be erased before it is used */
+	rc = zms_gc_erase_pending(fs);
+	if (rc) {
+		return rc;
+	}
+#endif
+
 	close_ate.id = ZMS_HEAD_ID;
 	close_ate.len = 0U;
 	close_ate.offset = (uint32_t)SECTOR_OFFSET(fs->ate_wra + fs->ate_size);
@@ -1014,6 +1082,20 @@ gc_done:
 		return rc;
 	}
 
+#ifdef CONFIG_ZMS_BACKGROUND_GC
+	/* The GC done ATE allows to finish the erase at init after a power
+	 * loss, so it can be left to the background GC.
+	 */
+	if (fs->background_gc) {
+#ifdef CONFIG_ZMS_LOOKUP_CACHE
+		zms_lookup_cache_invalidate(fs, sec_addr >> ADDR_SECT_SHIFT);
+#endif
+		fs->gc_erase_pending = true;
+		(void)k_work_submit_to_queue(&zms_gc_wq, &fs->gc_work);
+		return 0;
+	}
+#endif
+
 	/* Erase the GC'ed sector when needed */
 	rc = zms_flash_erase_sector(fs, sec_addr);
 	if (rc) {
@@ -1028,16 +1110,95 @@ gc_done:
 	return rc;
 }
 
+#ifdef CONFIG_ZMS_BACKGROUND_GC
+
+/* Background GC, each step is done with the file system locked: the erase of
+ * the sector left by the last GC, then the GC of the write sector if it was
+ * requested by zms_write().
+ */
+static void zms_gc_work_handler(struct k_work *work)
+{
+	struct zms_fs *fs = CONTAINER_OF(work, struct zms_fs, gc_work);
+	int rc = 0;
+
+	k_mutex_lock(&fs->zms_lock, K_FOREVER);
+
+	if (!fs->ready) {
+		goto end;
+	}
+
+	if (fs->gc_erase_pending) {
+		rc = zms_gc_erase_pending(fs);
+		if (rc) {
+			goto end;
+		}
+#ifdef CONFIG_ZMS_GC_STATS
+		fs->gc_stats.background_erases++;
+#endif
+		/* Let the writes waiting for the lock run before the GC */
+		if (fs->gc_requested) {
+			(void)k_work_submit_to_queue(&zms_gc_wq, &fs->gc_work);
+		}
+	} else if (fs->gc_requested) {
+		fs->gc_requested = false;
+
+		rc = zms_sector_close(fs);
+		if (rc) {
+			goto end;
+		}
+
+		rc = zms_gc(fs);
+		if (rc) {
+			goto end;
+		}
+#ifdef CONFIG_ZMS_GC_STATS
+		fs->gc_stats.background++;
+#endif
+	}
+
+end:
+	k_mutex_unlock(&fs->zms_lock);
+
+	if (rc) {
+		LOG_ERR("Background garbage collection failed, returned = %d", rc);
+	}
+}
+
+static int zms_gc_wq_init(void)
+{
+	const struct k_work_queue_config cfg = {.name = "zms_gc"};
+
+	k_work_queue_init(&zms_gc_wq);
+
+	k_work_queue_start(&zms_gc_wq, zms_gc_stack, K_THREAD_STACK_SIZEOF(zms_gc_stack),
+			   K_LOWEST_APPLICATION_THREAD_PRIO, &cfg);
+
+	return 0;
+}
+
+SYS_INIT(zms_gc_wq_init, POST_KERNEL, CONFIG_KERNEL_INIT_PRIORITY_DEFAULT);
+
+#endif /* CONFIG_ZMS_BACKGROUND_GC */
+
 int zms_clear(struct zms_fs *fs)
 {
 	int rc;
 	uint64_t addr;
+#ifdef CONFIG_ZMS_BACKGROUND_GC
+	struct k_work_sync sync;
+#endif
 
 	if (!fs->ready) {
 		LOG_ERR("zms not initialized");
 		return -EACCES;
 	}
 
+#ifdef CONFIG_ZMS_BACKGROUND_GC
+	(void)k_work_cancel_sync(&fs->gc_work, &sync);
+	fs->gc_erase_pending = false;
+	fs->gc_requested = false;
+#endif
+
 	k_mutex_lock(&fs->zms_lock, K_FOREVER);
 	for (uint32_t i = 0; i < fs->sector_count; i++) {
 		addr = (uint64_t)i << ADDR_SECT_SHIFT;
@@ -1258,6 +1419,7 @@ static int zms_init(struct zms_fs *fs)
 			}
 
 			if (zms_gc_done_ate_valid(fs, &gc_done_ate)) {
+				gc_done_marker = true;
 				break;
 			}
 			addr += fs->ate_size;
@@ -1325,6 +1487,21 @@ int zms_mount(struct zms_fs *fs)
 	int rc;
 	struct flash_pages_info info;
 	size_t write_block_size;
+#ifdef CONFIG_ZMS_BACKGROUND_GC
+	struct k_work_sync sync;
+
+	/* A mounted file system may still have background GC work queued */
+	if (fs->ready) {
+		(void)k_work_cancel_sync(&fs->gc_work, &sync);
+	}
+
+	k_work_init(&fs->gc_work, zms_gc_work_handler);
+	fs->gc_erase_pending = false;
+	fs->gc_requested = false;
+#endif
+#ifdef CONFIG_ZMS_GC_STATS
+	memset(&fs->gc_stats, 0, sizeof(fs->gc_stats));
+#endif
 
 	k_mutex_init(&fs->zms_lock);
 
@@ -1381,6 +1558,13 @@ int zms_mount(struct zms_fs *fs)
 	/* zms is ready for use */
 	fs->ready = true;
 
+#ifdef CONFIG_ZMS_BACKGROUND_GC
+	/* Finish the GC done at init in the background */
+	if (fs->gc_erase_pending) {
+		(void)k_work_submit_to_queue(&zms_gc_wq, &fs->gc_work);
+	}
+#endif
+
 	LOG_INF("%u Sectors of %u bytes", fs->sector_count, fs->sector_size);
 	LOG_INF("alloc wra: %llu, %llx", SECTOR_NUM(fs->ate_wra), SECTOR_OFFSET(fs->ate_wra));
 	LOG_INF("data wra: %llu, %llx", SECTOR_NUM(fs->data_wra), SECTOR_OFFSET(fs->data_wra));
@@ -1388,7 +1572,7 @@ int zms_mount(struct zms_fs *fs)
 	return 0;
 }
 
-ssize_t zms_write(struct zms_fs *fs, uint32_t id, const void *data, size_t len)
+static ssize_t zms_write_entry(struct zms_fs *fs, uint32_t id, const void *data, size_t len)
 {
 	int rc;
 	size_t data_size;
@@ -1398,6 +1582,9 @@ ssize_t zms_write(struct zms_fs *fs, uint32_t id, const void *data, size_t len)
 	uint32_t gc_count;
 	uint32_t required_space = 0U; /* no space, appropriate for delete ate */
 	int prev_found = 0;
+#ifdef CONFIG_ZMS_BACKGROUND_GC
+	bool gc_threshold_reached;
+#endif
 
 	if (!fs->ready) {
 		LOG_ERR("zms not initialized");
@@ -1486,6 +1673,10 @@ no_cached_entry:
 
 	k_mutex_lock(&fs->zms_lock, K_FOREVER);
 
+#ifdef CONFIG_ZMS_BACKGROUND_GC
+	gc_threshold_reached = zms_gc_threshold_reached(fs);
+#endif
+
 	gc_count = 0;
 	while (1) {
 		if (gc_count == fs->sector_count) {
@@ -1523,10 +1714,53 @@ no_cached_entry:
 		}
 		gc_count++;
 	}
+
+#ifdef CONFIG_ZMS_BACKGROUND_GC
+	if (gc_count) {
+		/* The write sector just got garbage collected */
+		fs->gc_requested = false;
+	} else if (fs->background_gc && !gc_threshold_reached && zms_gc_threshold_reached(fs)) {
+		/* This write filled the sector above the threshold */
+		fs->gc_requested = true;
+		(void)k_work_submit_to_queue(&zms_gc_wq, &fs->gc_work);
+	}
+#endif
+
 	rc = len;
 end:
+#ifdef CONFIG_ZMS_GC_STATS
+	fs->gc_stats.foreground += gc_count;
+#endif
+	k_mutex_unlock(&fs->zms_lock);
+	return rc;
+}
+
+ssize_t zms_write(struct zms_fs *fs, uint32_t id, const void *data, size_t len)
+{
+#ifdef CONFIG_ZMS_GC_STATS
+	uint32_t start = k_cycle_get_32();
+	ssize_t rc;
+	uint32_t us;
+
+	rc = zms_write_entry(fs, id, data, len);
+
+	if (!fs->ready) {
+		return rc;
+	}
+
+	us = k_cyc_to_us_ceil32(k_cycle_get_32() - start);
+
+	/* The other statistics are updated with the lock held too */
+	k_mutex_lock(&fs->zms_lock, K_FOREVER);
+	if (us > fs->gc_stats.write_max_us) {
+		fs->gc_stats.write_max_us = us;
+	}
 	k_mutex_unlock(&fs->zms_lock);
+
 	return rc;
+#else
+	return zms_write_entry(fs, id, data, len);
+#endif
 }
 
 int zms_delete(struct zms_fs *fs, uint32_t id)
@@ -135,7 +135,9 @@ static const struct mpsc_pbuf_buffer_config mpsc_config = {
 	.flags = (IS_ENABLED(CONFIG_LOG_MODE_OVERFLOW) ?
 		  MPSC_PBUF_MODE_OVERWRITE : 0) |
 		 (IS_ENABLED(CONFIG_LOG_MEM_UTILIZATION) ?
-		  MPSC_PBUF_MAX_UTILIZATION : 0)
+		  MPSC_PBUF_MAX_UTILIZATION : 0) |
+		 (IS_ENABLED(CONFIG_MPSC_PBUF_LOCKLESS) ?
+		  MPSC_PBUF_MODE_LOCKLESS : 0)
 };
 #endif
 
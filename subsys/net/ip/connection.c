@@ -59,11 +59,280 @@ LOG_MODULE_REGISTER(net_conn, CONFIG_NET_CONN_LOG_LEVEL);
 
 #define NET_CONN_RANK(_flags)		(_flags & 0x78)
 
+/** Connection is kept in the hash table instead of conn_used */
+#define NET_CONN_HASHED			BIT(7)
+
 static struct net_conn conns[CONFIG_NET_MAX_CONN];
 
 static sys_slist_t conn_unused;
 static sys_slist_t conn_used;
 
+#if defined(CONFIG_NET_CONN_HASH)
+#include <zephyr/sys/hash_function.h>
+
+/* Fully specified TCP/UDP connections live in these buckets, everything
+ * else (listeners, wildcard bindings, raw and CAN sockets) in conn_used.
+ */
+static sys_slist_t conn_hash[CONFIG_NET_CONN_HASH_BUCKETS];
+static size_t conn_hash_count;
+
+#define CONN_LIST_COUNT (1 + CONFIG_NET_CONN_HASH_BUCKETS)
+
+static sys_slist_t *conn_list_get(int idx)
+{
+	return idx == 0 ? &conn_used : &conn_hash[idx - 1];
+}
+
+static uint32_t conn_hash_bucket(uint16_t proto, const void *remote_addr,
+				 size_t addr_len, uint16_t remote_port,
+				 uint16_t local_port)
+{
+	struct {
+		uint8_t addr[sizeof(struct in6_addr)];
+		uint16_t remote_port;
+		uint16_t local_port;
+		uint16_t proto;
+	} key;
+
+	/* Zero the padding and the unused part of an IPv4 address */
+	(void)memset(&key, 0, sizeof(key));
+
+	memcpy(key.addr, remote_addr, addr_len);
+	key.remote_port = remote_port;
+	key.local_port = local_port;
+	key.proto = proto;
+
+	return sys_hash32_murmur3(&key, sizeof(key)) %
+		CONFIG_NET_CONN_HASH_BUCKETS;
+}
+
+static bool conn_hash_eligible(struct net_conn *conn)
+{
+	if (NET_CONN_RANK(conn->flags) != NET_CONN_RANK(0xff)) {
+		return false;
+	}
+
+	if (conn->proto != IPPROTO_TCP && conn->proto != IPPROTO_UDP) {
+		return false;
+	}
+
+	if (conn->local_addr.sa_family != conn->family ||
+	    conn->remote_addr.sa_family != conn->family) {
+		return false;
+	}
+
+	/* A connection bound to a multicast address must see every
+	 * multicast packet, which is only done by walking conn_used.
+	 */
+	if (IS_ENABLED(CONFIG_NET_IPV6) && conn->family == AF_INET6) {
+		return !net_ipv6_is_addr_mcast(&net_sin6(&conn->local_addr)->sin6_addr);
+	}
+
+	if (IS_ENABLED(CONFIG_NET_IPV4) && conn->family == AF_INET) {
+		return !net_ipv4_is_addr_mcast(&net_sin(&conn->local_addr)->sin_addr);
+	}
+
+	return false;
+}
+
+static sys_slist_t *conn_hash_list(struct net_conn *conn)
+{
+	uint32_t bucket;
+
+	if (IS_ENABLED(CONFIG_NET_IPV6) && conn->family == AF_INET6) {
+		bucket = conn_hash_bucket(conn->proto,
+					  &net_sin6(&conn->remote_addr)->sin6_addr,
+					  sizeof(struct in6_addr),
+					  net_sin6(&conn->remote_addr)->sin6_port,
+					  net_sin6(&conn->local_addr)->sin6_port);
+	} else {
+		bucket = conn_hash_bucket(conn->proto,
+					  &net_sin(&conn->remote_addr)->sin_addr,
+					  sizeof(struct in_addr),
+					  net_sin(&conn->remote_addr)->sin_port,
+					  net_sin(&conn->local_addr)->sin_port);
+	}
+
+	return &conn_hash[bucket];
+}
+
+/* Bucket that would hold a fully specified connection with these end points,
+ * the ports are in host byte order.
+ */
+static sys_slist_t *conn_hash_find_list(uint16_t proto,
+					const struct sockaddr *remote_addr,
+					uint16_t remote_port,
+					uint16_t local_port)
+{
+	uint32_t bucket;
+
+	if (IS_ENABLED(CONFIG_NET_IPV6) && remote_addr->sa_family == AF_INET6) {
+		bucket = conn_hash_bucket(proto, &net_sin6(remote_addr)->sin6_addr,
+					  sizeof(struct in6_addr),
+					  htons(remote_port), htons(local_port));
+	} else if (IS_ENABLED(CONFIG_NET_IPV4) && remote_addr->sa_family == AF_INET) {
+		bucket = conn_hash_bucket(proto, &net_sin(remote_addr)->sin_addr,
+					  sizeof(struct in_addr),
+					  htons(remote_port), htons(local_port));
+	} else {
+		return NULL;
+	}
+
+	return &conn_hash[bucket];
+}
+
+/* Move a connection from conn_used to its bucket if it is fully specified.
+ * Must be called with conn_lock held.
+ */
+static void conn_hash_add(struct net_conn *conn)
+{
+	if (!conn_hash_eligible(conn)) {
+		return;
+	}
+
+	sys_slist_find_and_remove(&conn_used, &conn->node);
+	sys_slist_prepend(conn_hash_list(conn), &conn->node);
+
+	conn->flags |= NET_CONN_HASHED;
+	conn_hash_count++;
+}
+
+/* Move a hashed connection back to conn_used, for example before its remote
+ * end point is changed. Must be called with conn_lock held.
+ */
+static void conn_hash_del(struct net_conn *conn)
+{
+	if (!(conn->flags & NET_CONN_HASHED)) {
+		return;
+	}
+
+	sys_slist_find_and_remove(conn_hash_list(conn), &conn->node);
+	sys_slist_prepend(&conn_used, &conn->node);
+
+	conn->flags &= ~NET_CONN_HASHED;
+	conn_hash_count--;
+}
+
+static bool conn_addr_cmp(struct net_pkt *pkt,
+			  union net_ip_header *ip_hdr,
+			  struct sockaddr *addr,
+			  bool is_remote);
+
+/* Look up a fully specified connection for an unicast TCP/UDP packet. As such
+ * a connection has the highest possible rank, a hit is always the best match.
+ * Must be called with conn_lock held.
+ */
+static struct net_conn *conn_hash_lookup(struct net_pkt *pkt,
+					 union net_ip_header *ip_hdr,
+					 uint8_t proto,
+					 uint16_t src_port,
+					 uint16_t dst_port)
+{
+	uint8_t pkt_family = net_pkt_family(pkt);
+	struct net_conn *conn;
+	uint32_t bucket;
+
+	if (conn_hash_count == 0) {
+		return NULL;
+	}
+
+	if (IS_ENABLED(CONFIG_NET_IPV6) && pkt_family == AF_INET6) {
+		bucket = conn_hash_bucket(proto, ip_hdr->ipv6->src,
+					  sizeof(struct in6_addr),
+					  src_port, dst_port);
+	} else if (IS_ENABLED(CONFIG_NET_IPV4) && pkt_family == AF_INET) {
+		bucket = conn_hash_bucket(proto, ip_hdr->ipv4->src,
+					  sizeof(struct in_addr),
+					  src_port, dst_port);
+	} else {
+		return NULL;
+	}
+
+	SYS_SLIST_FOR_EACH_CONTAINER(&conn_hash[bucket], conn, node) {
+		if (conn->family != pkt_family || conn->proto != proto) {
+			continue;
+		}
+
+		if (net_sin(&conn->remote_addr)->sin_port != src_port ||
+		    net_sin(&conn->local_addr)->sin_port != dst_port) {
+			continue;
+		}
+
+		if (!conn_addr_cmp(pkt, ip_hdr, &conn->remote_addr, true) ||
+		    !conn_addr_cmp(pkt, ip_hdr, &conn->local_addr, false)) {
+			continue;
+		}
+
+		if (conn->context != NULL &&
+		    net_context_is_bound_to_iface(conn->context) &&
+		    net_pkt_iface(pkt) != net_context_get_iface(conn->context)) {
+			continue;
+		}
+
+		return conn;
+	}
+
+	return NULL;
+}
+
+static inline bool conn_hash_is_empty(void)
+{
+	return conn_hash_count == 0;
+}
+#else
+#define CONN_LIST_COUNT 1
+
+static sys_slist_t *conn_list_get(int idx)
+{
+	ARG_UNUSED(idx);
+
+	return &conn_used;
+}
+
+static sys_slist_t *conn_hash_find_list(uint16_t proto,
+					const struct sockaddr *remote_addr,
+					uint16_t remote_port,
+					uint16_t local_port)
+{
+	ARG_UNUSED(proto);
+	ARG_UNUSED(remote_addr);
+	ARG_UNUSED(remote_port);
+	ARG_UNUSED(local_port);
+
+	return NULL;
+}
+
+static void conn_hash_add(struct net_conn *conn)
+{
+	ARG_UNUSED(conn);
+}
+
+static void conn_hash_del(struct net_conn *conn)
+{
+	ARG_UNUSED(conn);
+}
+
+static inline struct net_conn *conn_hash_lookup(struct net_pkt *pkt,
+						union net_ip_header *ip_hdr,
+						uint8_t proto,
+						uint16_t src_port,
+						uint16_t dst_port)
+{
+	ARG_UNUSED(pkt);
+	ARG_UNUSED(ip_hdr);
+	ARG_UNUSED(proto);
+	ARG_UNUSED(src_port);
+	ARG_UNUSED(dst_port);
+
+	return NULL;
+}
+
+static inline bool conn_hash_is_empty(void)
+{
+	return true;
+}
+#endif /* CONFIG_NET_CONN_HASH */
+
 #if (CONFIG_NET_CONN_LOG_LEVEL >= LOG_LEVEL_DBG)
 static inline
 void conn_register_debug(struct net_conn *conn,
@@ -141,6 +410,7 @@ static void conn_set_used(struct net_conn *conn)
 
 	k_mutex_lock(&conn_lock, K_FOREVER);
 	sys_slist_prepend(&conn_used, &conn->node);
+	conn_hash_add(conn);
 	k_mutex_unlock(&conn_lock);
 }
 
@@ -162,12 +432,14 @@ static struct net_conn *conn_find_handler(struct net_if *iface,
 					  uint16_t local_port,
 					  bool reuseport_set)
 {
+	sys_slist_t *list = &conn_used;
 	struct net_conn *conn;
 	struct net_conn *tmp;
 
 	k_mutex_lock(&conn_lock, K_FOREVER);
 
-	SYS_SLIST_FOR_EACH_CONTAINER_SAFE(&conn_used, conn, tmp, node) {
+again:
+	SYS_SLIST_FOR_EACH_CONTAINER_SAFE(list, conn, tmp, node) {
 		if (conn->proto != proto) {
 			continue;
 		}
@@ -264,6 +536,15 @@ static struct net_conn *conn_find_handler(struct net_if *iface,
 		return conn;
 	}
 
+	/* A fully specified connection can only be in its hash bucket */
+	if (list == &conn_used && local_addr != NULL && remote_addr != NULL) {
+		list = conn_hash_find_list(proto, remote_addr, remote_port,
+					   local_port);
+		if (list != NULL) {
+			goto again;
+		}
+	}
+
 	k_mutex_unlock(&conn_lock);
 	return NULL;
 }
@@ -451,6 +732,7 @@ int net_conn_unregister(struct net_conn_handle *handle)
 	NET_DBG("Connection handler %p removed", conn);
 
 	k_mutex_lock(&conn_lock, K_FOREVER);
+	conn_hash_del(conn);
 	sys_slist_find_and_remove(&conn_used, &conn->node);
 	k_mutex_unlock(&conn_lock);
 
@@ -476,10 +758,21 @@ int net_conn_update(struct net_conn_handle *handle,
 		return -ENOENT;
 	}
 
+	k_mutex_lock(&conn_lock, K_FOREVER);
+
 	net_conn_change_callback(conn, cb, user_data);
 
+	/* The bucket depends on the remote end point, and a connection
+	 * without one does not belong in the hash table at all.
+	 */
+	conn_hash_del(conn);
+
 	ret = net_conn_change_remote(conn, remote_addr, remote_port);
 
+	conn_hash_add(conn);
+
+	k_mutex_unlock(&conn_lock);
+
 	return ret;
 }
 
@@ -710,6 +1003,24 @@ enum net_verdict net_conn_input(struct net_pkt *pkt,
 
 	k_mutex_lock(&conn_lock, K_FOREVER);
 
+	if (IS_ENABLED(CONFIG_NET_IP) && !is_mcast_pkt &&
+	    (proto == IPPROTO_TCP || proto == IPPROTO_UDP) &&
+	    (pkt_family == AF_INET || pkt_family == AF_INET6)) {
+		/* Nothing in conn_used can outrank a fully specified match */
+		best_match = conn_hash_lookup(pkt, ip_hdr, proto, src_port, dst_port);
+		if (best_match) {
+			goto found;
+		}
+	}
+
+	if (IS_ENABLED(CONFIG_NET_SOCKETS_PACKET) && pkt_family == AF_PACKET &&
+	    !conn_hash_is_empty()) {
+		/* Hashed connections are TCP/UDP ones, and the loop below
+		 * would ask for the packet to be passed to them.
+		 */
+		raw_pkt_continue = true;
+	}
+
 	SYS_SLIST_FOR_EACH_CONTAINER(&conn_used, conn, node) {
 		/* Is the candidate connection matching the packet's interface? */
 		if (conn->context != NULL &&
@@ -878,6 +1189,7 @@ enum net_verdict net_conn_input(struct net_pkt *pkt,
 		}
 	} /* loop end */
 
+found:
 	if (best_match) {
 		cb = best_match->cb;
 		user_data = best_match->user_data;
@@ -951,8 +1263,10 @@ void net_conn_foreach(net_conn_foreach_cb_t cb, void *user_data)
 
 	k_mutex_lock(&conn_lock, K_FOREVER);
 
-	SYS_SLIST_FOR_EACH_CONTAINER(&conn_used, conn, node) {
-		cb(conn, user_data);
+	for (int i = 0; i < CONN_LIST_COUNT; i++) {
+		SYS_SLIST_FOR_EACH_CONTAINER(conn_list_get(i), conn, node) {
+			cb(conn, user_data);
+		}
 	}
 
 	k_mutex_unlock(&conn_lock);
@@ -99,6 +99,20 @@ NET_NBR_TABLE_INIT(NET_NBR_GLOBAL,
 
 static K_MUTEX_DEFINE(nbr_lock);
 
+#define NBR_LOOKUP_END UINT8_MAX
+
+#if defined(CONFIG_NET_IPV6_NBR_HASH)
+#include <zephyr/sys/hash_function.h>
+
+/* Neighbors chained by the hash of their address, protected by nbr_lock.
+ * The links are indexes into net_neighbor_pool.
+ */
+static uint8_t nbr_hash_head[CONFIG_NET_IPV6_NBR_HASH_BUCKETS] = {
+	[0 ... (CONFIG_NET_IPV6_NBR_HASH_BUCKETS - 1)] = NBR_LOOKUP_END,
+};
+static uint8_t nbr_hash_next[CONFIG_NET_IPV6_MAX_NEIGHBORS];
+#endif /* CONFIG_NET_IPV6_NBR_HASH */
+
 void net_ipv6_nbr_lock(void)
 {
 	(void)k_mutex_lock(&nbr_lock, K_FOREVER);
@@ -266,13 +280,77 @@ void nbr_print(void)
 #define nbr_print(...)
 #endif
 
+#if defined(CONFIG_NET_IPV6_NBR_HASH)
+static uint8_t *nbr_hash_bucket(const struct in6_addr *addr)
+{
+	return &nbr_hash_head[sys_hash32_murmur3(addr, sizeof(*addr)) %
+			      CONFIG_NET_IPV6_NBR_HASH_BUCKETS];
+}
+
+static uint8_t nbr_index(struct net_nbr *nbr)
+{
+	return CONTAINER_OF(nbr, __typeof__(net_neighbor_pool[0]), nbr) -
+		net_neighbor_pool;
+}
+
+static void nbr_hash_add(struct net_nbr *nbr)
+{
+	uint8_t *head = nbr_hash_bucket(&net_ipv6_nbr_data(nbr)->addr);
+	uint8_t idx = nbr_index(nbr);
+
+	nbr_hash_next[idx] = *head;
+	*head = idx;
+}
+
+static void nbr_hash_del(struct net_nbr *nbr)
+{
+	uint8_t *link = nbr_hash_bucket(&net_ipv6_nbr_data(nbr)->addr);
+	uint8_t idx = nbr_index(nbr);
+
+	while (*link != NBR_LOOKUP_END) {
+		if (*link == idx) {
+			*link = nbr_hash_next[idx];
+			break;
+		}
+
+		link = &nbr_hash_next[*link];
+	}
+}
+
+/* Only the neighbors whose address has the same hash are visited */
+static inline int nbr_lookup_first(const struct in6_addr *addr)
+{
+	return *nbr_hash_bucket(addr);
+}
+
+static inline int nbr_lookup_next(int i)
+{
+	return nbr_hash_next[i];
+}
+#else
+#define nbr_hash_add(...)
+#define nbr_hash_del(...)
+
+static inline int nbr_lookup_first(const struct in6_addr *addr)
+{
+	ARG_UNUSED(addr);
+
+	return 0;
+}
+
+static inline int nbr_lookup_next(int i)
+{
+	return i + 1 < CONFIG_NET_IPV6_MAX_NEIGHBORS ? i + 1 : NBR_LOOKUP_END;
+}
+#endif /* CONFIG_NET_IPV6_NBR_HASH */
+
 static struct net_nbr *nbr_lookup(struct net_nbr_table *table,
 				  struct net_if *iface,
 				  const struct in6_addr *addr)
 {
 	int i;
 
-	for (i = 0; i < CONFIG_NET_IPV6_MAX_NEIGHBORS; i++) {
+	for (i = nbr_lookup_first(addr); i != NBR_LOOKUP_END; i = nbr_lookup_next(i)) {
 		struct net_nbr *nbr = get_nbr(i);
 
 		if (!nbr->ref) {
@@ -426,6 +504,7 @@ static void nbr_init(struct net_nbr *nbr, struct net_if *iface,
 	nbr->iface = iface;
 
 	net_ipaddr_copy(&net_ipv6_nbr_data(nbr)->addr, addr);
+	nbr_hash_add(nbr);
 	ipv6_nbr_set_state(nbr, state);
 	net_ipv6_nbr_data(nbr)->is_router = is_router;
 	net_ipv6_nbr_data(nbr)->pending = NULL;
@@ -669,7 +748,7 @@ void net_neighbor_remove(struct net_nbr *nbr)
 {
 	NET_DBG("Neighbor %p removed", nbr);
 
-	return;
+	nbr_hash_del(nbr);
 }
 
 void net_neighbor_table_clear(struct net_nbr_table *table)
@@ -807,9 +886,10 @@ enum net_verdict net_ipv6_prepare_for_send(struct net_pkt *pkt)
 
 #if defined(CONFIG_NET_IPV6_FRAGMENT)
 	/* If we have already fragmented the packet, the fragment id will
-	 * contain a proper value and we can skip other checks.
+	 * contain a proper value and we can skip other checks. TCP GSO
+	 * packets are cut into segments by the device.
 	 */
-	if (net_pkt_ipv6_fragment_id(pkt) == 0U) {
+	if (net_pkt_ipv6_fragment_id(pkt) == 0U && net_pkt_gso_size(pkt) == 0U) {
 		size_t pkt_len = net_pkt_get_len(pkt);
 		uint16_t mtu;
 
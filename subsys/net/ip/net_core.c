@@ -133,6 +133,14 @@ static inline enum net_verdict process_data(struct net_pkt *pkt,
 			return ret;
 		}
 
+		/* Coalesce TCP segments of a bulk transfer before IP input */
+		if (IS_ENABLED(CONFIG_NET_TCP_GRO) && !is_loopback && !locally_routed) {
+			ret = net_tcp_gro_receive(pkt);
+			if (ret != NET_CONTINUE) {
+				return ret;
+			}
+		}
+
 		/* IP version and header length. */
 		uint8_t vtc_vhl = NET_IPV6_HDR(pkt)->vtc & 0xf0;
 
@@ -363,6 +371,23 @@ drop:
 	return ret;
 }
 
+#if defined(CONFIG_NET_TCP_GSO)
+/* Send the segments of a TCP GSO packet, which is released if they all
+ * could be sent, as it then has been sent as a whole.
+ */
+static int send_segments(struct net_pkt *pkt, int (*send)(struct net_pkt *pkt))
+{
+	int ret;
+
+	ret = net_tcp_gso_segment(pkt, send);
+	if (ret == 0) {
+		net_pkt_unref(pkt);
+	}
+
+	return ret;
+}
+#endif /* CONFIG_NET_TCP_GSO */
+
 /* Called when data needs to be sent to network */
 int net_send_data(struct net_pkt *pkt)
 {
@@ -384,6 +409,15 @@ int net_send_data(struct net_pkt *pkt)
 	net_pkt_trim_buffer(pkt);
 	net_pkt_cursor_init(pkt);
 
+#if defined(CONFIG_NET_TCP_GSO)
+	/* TCP GSO packets are segmented here unless the device does it */
+	if (net_pkt_gso_size(pkt) > 0U &&
+	    net_if_need_tx_segmentation(net_pkt_iface(pkt))) {
+		ret = send_segments(pkt, net_send_data);
+		goto err;
+	}
+#endif
+
 	status = check_ip(pkt);
 	if (status < 0) {
 		/* Special handling for ENOMSG which is returned if packet
@@ -402,6 +436,7 @@ int net_send_data(struct net_pkt *pkt)
 		 * to RX processing.
 		 */
 		NET_DBG("Loopback pkt %p back to us", pkt);
+
 		processing_data(pkt, true);
 		ret = 0;
 		goto err;
@@ -101,6 +101,248 @@ static struct {
 } ipv4_addresses[CONFIG_NET_IF_MAX_IPV4_COUNT];
 #endif /* CONFIG_NET_NATIVE_IPV4 */
 
+#if defined(CONFIG_NET_IF_ADDR_HASH)
+#include <zephyr/sys/barrier.h>
+#include <zephyr/sys/hash_function.h>
+
+#if defined(CONFIG_NET_IPV6)
+#define ADDR_HASH_IPV6_COUNT (CONFIG_NET_IF_MAX_IPV6_COUNT * NET_IF_MAX_IPV6_ADDR)
+#else
+#define ADDR_HASH_IPV6_COUNT 0
+#endif
+
+#if defined(CONFIG_NET_IPV4)
+#define ADDR_HASH_IPV4_COUNT (CONFIG_NET_IF_MAX_IPV4_COUNT * NET_IF_MAX_IPV4_ADDR)
+#else
+#define ADDR_HASH_IPV4_COUNT 0
+#endif
+
+/* At most half full, so that probe sequences stay short */
+#define ADDR_HASH_SIZE (2 * (ADDR_HASH_IPV6_COUNT + ADDR_HASH_IPV4_COUNT) + 1)
+
+struct addr_hash_entry {
+	/* NULL when the slot is free */
+	struct net_if *iface;
+	struct net_if_addr *ifaddr;
+	uint32_t hash;
+};
+
+/* Unicast addresses of all the interfaces, in an open addressing table
+ * keyed by the address. It is only changed with addr_hash_lock held, and
+ * addr_hash_seq is odd while it is. Lookups take no lock: they retry if
+ * the sequence count shows that the table changed under them.
+ */
+static struct addr_hash_entry addr_hash[ADDR_HASH_SIZE];
+static struct k_spinlock addr_hash_lock;
+static atomic_t addr_hash_seq;
+
+static const void *addr_hash_key(struct net_if_addr *ifaddr, size_t *len)
+{
+	if (ifaddr->address.family == AF_INET6) {
+		*len = sizeof(struct in6_addr);
+		return &ifaddr->address.in6_addr;
+	}
+
+	*len = sizeof(struct in_addr);
+	return &ifaddr->address.in_addr;
+}
+
+static uint32_t addr_hash_calc(sa_family_t family, const void *addr)
+{
+	return sys_hash32_murmur3(addr, family == AF_INET6 ?
+				  sizeof(struct in6_addr) : sizeof(struct in_addr));
+}
+
+static k_spinlock_key_t addr_hash_write_begin(void)
+{
+	k_spinlock_key_t key = k_spin_lock(&addr_hash_lock);
+
+	atomic_inc(&addr_hash_seq);
+
+	return key;
+}
+
+static void addr_hash_write_end(k_spinlock_key_t key)
+{
+	atomic_inc(&addr_hash_seq);
+
+	k_spin_unlock(&addr_hash_lock, key);
+}
+
+static void addr_hash_add(struct net_if *iface, struct net_if_addr *ifaddr)
+{
+	k_spinlock_key_t key;
+	const void *addr;
+	uint32_t hash;
+	size_t len;
+	size_t i;
+
+	addr = addr_hash_key(ifaddr, &len);
+	hash = addr_hash_calc(ifaddr->address.family, addr);
+
+	key = addr_hash_write_begin();
+
+	/* The table is larger than the number of addresses, so there is
+	 * always a free slot.
+	 */
+	for (i = hash % ADDR_HASH_SIZE; addr_hash[i].iface != NULL;
+	     i = (i + 1) % ADDR_HASH_SIZE) {
+		if (addr_hash[i].ifaddr == ifaddr) {
+			goto out;
+		}
+	}
+
+	addr_hash[i].ifaddr = ifaddr;
+	addr_hash[i].hash = hash;
+	addr_hash[i].iface = iface;
+
+out:
+	addr_hash_write_end(key);
+}
+
+/* Free a slot, and move back the entries that follow it in the probe
+ * sequence so that no tombstones are needed.
+ */
+static void addr_hash_del_slot(size_t i)
+{
+	size_t j = i;
+	size_t home;
+
+	while (true) {
+		j = (j + 1) % ADDR_HASH_SIZE;
+
+		if (addr_hash[j].iface == NULL) {
+			break;
+		}
+
+		home = addr_hash[j].hash % ADDR_HASH_SIZE;
+
+		/* Leave the entry alone if its home slot is in (i, j] */
+		if ((i <= j) ? (i < home && home <= j) : (i < home || home <= j)) {
+			continue;
+		}
+
+		addr_hash[i] = addr_hash[j];
+		i = j;
+	}
+
+	addr_hash[i].iface = NULL;
+	addr_hash[i].ifaddr = NULL;
+}
+
+static void addr_hash_del(struct net_if_addr *ifaddr)
+{
+	k_spinlock_key_t key;
+	const void *addr;
+	uint32_t hash;
+	size_t len;
+
+	addr = addr_hash_key(ifaddr, &len);
+	hash = addr_hash_calc(ifaddr->address.family, addr);
+
+	key = addr_hash_write_begin();
+
+	for (size_t i = hash % ADDR_HASH_SIZE; addr_hash[i].iface != NULL;
+	     i = (i + 1) % ADDR_HASH_SIZE) {
+		if (addr_hash[i].ifaddr == ifaddr) {
+			addr_hash_del_slot(i);
+			break;
+		}
+	}
+
+	addr_hash_write_end(key);
+}
+
+static void addr_hash_del_iface(struct net_if *iface, sa_family_t family)
+{
+	k_spinlock_key_t key;
+	size_t i = 0;
+
+	key = addr_hash_write_begin();
+
+	while (i < ADDR_HASH_SIZE) {
+		if (addr_hash[i].iface == iface &&
+		    addr_hash[i].ifaddr->address.family == family) {
+			/* Check again the entry moved in its place */
+			addr_hash_del_slot(i);
+			continue;
+		}
+
+		i++;
+	}
+
+	addr_hash_write_end(key);
+}
+
+static struct net_if_addr *addr_hash_lookup(sa_family_t family, const void *addr,
+					    struct net_if **ret)
+{
+	uint32_t hash = addr_hash_calc(family, addr);
+	struct net_if_addr *ifaddr;
+	struct net_if *iface;
+	atomic_val_t seq;
+
+	do {
+		seq = atomic_get(&addr_hash_seq);
+		ifaddr = NULL;
+		iface = NULL;
+
+		for (size_t n = 0, i = hash % ADDR_HASH_SIZE; n < ADDR_HASH_SIZE;
+		     n++, i = (i + 1) % ADDR_HASH_SIZE) {
+			struct net_if *entry_iface = addr_hash[i].iface;
+			struct net_if_addr *entry_ifaddr = addr_hash[i].ifaddr;
+			const void *key;
+			size_t len;
+
+			if (entry_iface == NULL) {
+				break;
+			}
+
+			/* A torn read is caught by the sequence check below */
+			if (entry_ifaddr == NULL || addr_hash[i].hash != hash ||
+			    entry_ifaddr->address.family != family ||
+			    !entry_ifaddr->is_used) {
+				continue;
+			}
+
+			/* The same address can be on several interfaces. Return
+			 * the one with the lowest index, as the interface scan
+			 * does, whatever order the entries were added in.
+			 */
+			key = addr_hash_key(entry_ifaddr, &len);
+			if (memcmp(key, addr, len) == 0 &&
+			    (iface == NULL ||
+			     net_if_get_by_iface(entry_iface) < net_if_get_by_iface(iface))) {
+				ifaddr = entry_ifaddr;
+				iface = entry_iface;
+			}
+		}
+
+		barrier_dmem_fence_full();
+	} while ((seq & 1) || atomic_get(&addr_hash_seq) != seq);
+
+	if (ifaddr && ret) {
+		*ret = iface;
+	}
+
+	return ifaddr;
+}
+#else
+#define addr_hash_add(...)
+#define addr_hash_del(...)
+#define addr_hash_del_iface(...)
+
+static inline struct net_if_addr *addr_hash_lookup(sa_family_t family, const void *addr,
+						   struct net_if **ret)
+{
+	ARG_UNUSED(family);
+	ARG_UNUSED(addr);
+	ARG_UNUSED(ret);
+
+	return NULL;
+}
+#endif /* CONFIG_NET_IF_ADDR_HASH */
+
 /* We keep track of the link callbacks in this list.
  */
 static sys_slist_t link_callbacks;
@@ -1112,6 +1354,8 @@ int net_if_config_ipv6_put(struct net_if *iface)
 		iface->config.ip.ipv6 = NULL;
 		ipv6_addresses[i].iface = NULL;
 
+		addr_hash_del_iface(iface, AF_INET6);
+
 		k_mutex_unlock(&lock);
 		goto out;
 	}
@@ -1783,6 +2027,10 @@ struct net_if_addr *net_if_ipv6_addr_lookup(const struct in6_addr *addr,
 {
 	struct net_if_addr *ifaddr = NULL;
 
+	if (IS_ENABLED(CONFIG_NET_IF_ADDR_HASH)) {
+		return addr_hash_lookup(AF_INET6, addr, ret);
+	}
+
 	STRUCT_SECTION_FOREACH(net_if, iface) {
 		struct net_if_ipv6 *ipv6;
 
@@ -1972,6 +2220,7 @@ struct net_if_addr *net_if_ipv6_addr_add(struct net_if *iface,
 
 		net_if_addr_init(&ipv6->unicast[i], addr, addr_type,
 				 vlifetime);
+		addr_hash_add(iface, &ipv6->unicast[i]);
 
 		NET_DBG("[%zu] interface %d (%p) address %s type %s added", i,
 			net_if_get_by_iface(iface), iface,
@@ -3430,6 +3679,8 @@ int net_if_config_ipv4_put(struct net_if *iface)
 		iface->config.ip.ipv4 = NULL;
 		ipv4_addresses[i].iface = NULL;
 
+		addr_hash_del_iface(iface, AF_INET);
+
 		k_mutex_unlock(&lock);
 		goto out;
 	}
@@ -3779,6 +4030,10 @@ struct net_if_addr *net_if_ipv4_addr_lookup(const struct in_addr *addr,
 {
 	struct net_if_addr *ifaddr = NULL;
 
+	if (IS_ENABLED(CONFIG_NET_IF_ADDR_HASH)) {
+		return addr_hash_lookup(AF_INET, addr, ret);
+	}
+
 	STRUCT_SECTION_FOREACH(net_if, iface) {
 		struct net_if_ipv4 *ipv4;
 
@@ -4323,6 +4578,11 @@ struct net_if_addr *net_if_ipv4_addr_add(struct net_if *iface,
 	}
 
 	if (ifaddr) {
+		if (ifaddr->is_used) {
+			/* Overridable address replaced by a DHCP one */
+			addr_hash_del(ifaddr);
+		}
+
 		ifaddr->is_used = true;
 		ifaddr->address.family = AF_INET;
 		ifaddr->address.in_addr.s4_addr32[0] =
@@ -4330,6 +4590,8 @@ struct net_if_addr *net_if_ipv4_addr_add(struct net_if *iface,
 		ifaddr->addr_type = addr_type;
 		ifaddr->atomic_ref = ATOMIC_INIT(1);
 
+		addr_hash_add(iface, ifaddr);
+
 		/* Caller has to take care of timers and their expiry */
 		if (vlifetime) {
 			ifaddr->is_infinite = false;
@@ -5186,6 +5448,8 @@ int net_if_addr_unref(struct net_if *iface,
 
 	ifaddr->is_used = false;
 
+	addr_hash_del(ifaddr);
+
 	if (IS_ENABLED(CONFIG_NET_IPV6) && family == AF_INET6 && addr != NULL) {
 		remove_ipv6_ifaddr(iface, ifaddr, maddr_count);
 	}
@@ -5306,6 +5570,28 @@ bool net_if_need_calc_rx_checksum(struct net_if *iface, enum net_if_checksum_typ
 	return need_calc_checksum(iface, ETHERNET_HW_RX_CHKSUM_OFFLOAD, chksum_type);
 }
 
+bool net_if_need_tx_segmentation(struct net_if *iface)
+{
+#if defined(CONFIG_NET_L2_ETHERNET)
+	if (net_if_l2(iface) != &NET_L2_GET_NAME(ETHERNET)) {
+		if (IS_ENABLED(CONFIG_NET_VLAN) && net_eth_is_vlan_interface(iface)) {
+			iface = net_eth_get_vlan_main(iface);
+			if (iface == NULL) {
+				return true;
+			}
+		} else {
+			return true;
+		}
+	}
+
+	return !(net_eth_get_hw_capabilities(iface) & ETHERNET_HW_TSO);
+#else
+	ARG_UNUSED(iface);
+
+	return true;
+#endif
+}
+
 int net_if_get_by_iface(struct net_if *iface)
 {
 	if (!(iface >= _net_if_list_start && iface < _net_if_list_end)) {
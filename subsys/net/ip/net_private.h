@@ -186,6 +186,15 @@ static inline void net_tc_rx_init(void) { }
 #endif
 extern bool net_tc_submit_to_tx_queue(uint8_t tc, struct net_pkt *pkt);
 extern void net_tc_submit_to_rx_queue(uint8_t tc, struct net_pkt *pkt);
+extern int net_tc_rx_current(void);
+
+/* Number of RX queues, each traffic class has several with flow steering */
+#if defined(CONFIG_NET_TC_RX_STEERING)
+#define NET_TC_RX_QUEUE_COUNT (NET_TC_RX_COUNT * CONFIG_NET_TC_RX_STEERING_QUEUES)
+#else
+#define NET_TC_RX_QUEUE_COUNT NET_TC_RX_COUNT
+#endif
+
 extern enum net_verdict net_promisc_mode_input(struct net_pkt *pkt);
 
 char *net_sprint_addr(sa_family_t af, const void *addr);
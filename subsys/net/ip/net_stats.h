@@ -412,6 +412,22 @@ static inline void net_stats_update_dns_drop(struct net_if *iface)
 #define net_stats_update_dns_drop(iface)
 #endif /* CONFIG_NET_STATISTICS_DNS */
 
+#if defined(CONFIG_NET_STATISTICS_RX_STEERING)
+static inline void net_stats_update_rx_steering_queued(struct net_if *iface,
+						       uint8_t queue)
+{
+	UPDATE_STAT(iface, stats.rx_steering.queued[queue]++);
+}
+
+static inline void net_stats_update_rx_steering_unhashed(struct net_if *iface)
+{
+	UPDATE_STAT(iface, stats.rx_steering.unhashed++);
+}
+#else
+#define net_stats_update_rx_steering_queued(iface, queue)
+#define net_stats_update_rx_steering_unhashed(iface)
+#endif /* CONFIG_NET_STATISTICS_RX_STEERING */
+
 #if defined(CONFIG_NET_PKT_TXTIME_STATS) && defined(CONFIG_NET_STATISTICS)
 static inline void net_stats_update_tx_time(struct net_if *iface,
 					    uint32_t start_time,
@@ -14,22 +14,30 @@ LOG_MODULE_REGISTER(net_tc, CONFIG_NET_TC_LOG_LEVEL);
 #include <zephyr/net/net_pkt.h>
 #include <zephyr/net/net_stats.h>
 
+#if defined(CONFIG_NET_TC_RX_STEERING)
+#include <zephyr/sys/byteorder.h>
+#include <zephyr/sys/hash_function.h>
+#include <zephyr/net/ethernet.h>
+#endif
+
 #include "net_private.h"
 #include "net_stats.h"
 #include "net_tc_mapping.h"
+#include "tcp_internal.h"
 
 /* Template for thread name. The "xx" is either "TX" denoting transmit thread,
  * or "RX" denoting receive thread. The "q[y]" denotes the traffic class queue
- * where y indicates the traffic class id. The value of y can be from 0 to 7.
+ * where y indicates the traffic class id. The value of y can be from 0 to 7,
+ * or up to 63 for RX queues with flow steering.
  */
-#define MAX_NAME_LEN sizeof("xx_q[y]")
+#define MAX_NAME_LEN sizeof("xx_q[yy]")
 
 /* Stacks for TX work queue */
 K_KERNEL_STACK_ARRAY_DEFINE(tx_stack, NET_TC_TX_COUNT,
 			    CONFIG_NET_TX_STACK_SIZE);
 
 /* Stacks for RX work queue */
-K_KERNEL_STACK_ARRAY_DEFINE(rx_stack, NET_TC_RX_COUNT,
+K_KERNEL_STACK_ARRAY_DEFINE(rx_stack, NET_TC_RX_QUEUE_COUNT,
 			    CONFIG_NET_RX_STACK_SIZE);
 
 #if NET_TC_TX_COUNT > 0
@@ -37,7 +45,7 @@ static struct net_traffic_class tx_classes[NET_TC_TX_COUNT];
 #endif
 
 #if NET_TC_RX_COUNT > 0
-static struct net_traffic_class rx_classes[NET_TC_RX_COUNT];
+static struct net_traffic_class rx_classes[NET_TC_RX_QUEUE_COUNT];
 #endif
 
 #if NET_TC_RX_COUNT > 0 || NET_TC_TX_COUNT > 0
@@ -60,12 +68,152 @@ bool net_tc_submit_to_tx_queue(uint8_t tc, struct net_pkt *pkt)
 	return true;
 }
 
+#if defined(CONFIG_NET_TC_RX_STEERING)
+struct rx_flow_key {
+	uint8_t src[sizeof(struct in6_addr)];
+	uint8_t dst[sizeof(struct in6_addr)];
+	uint16_t src_port;
+	uint16_t dst_port;
+	uint8_t proto;
+};
+
+/* Offset of the IP header in a received frame, which still holds its link
+ * layer header. Only the link layers with a fixed header are known here.
+ */
+static int rx_flow_ip_offset(struct net_pkt *pkt)
+{
+	struct net_if *iface = net_pkt_iface(pkt);
+	struct net_buf *buf = pkt->buffer;
+
+#if defined(CONFIG_NET_L2_ETHERNET)
+	if (net_if_l2(iface) == &NET_L2_GET_NAME(ETHERNET)) {
+		struct net_eth_hdr *hdr = (struct net_eth_hdr *)buf->data;
+		uint16_t type;
+
+		if (buf->len < sizeof(struct net_eth_vlan_hdr)) {
+			return -EINVAL;
+		}
+
+		type = ntohs(hdr->type);
+		if (type == NET_ETH_PTYPE_VLAN) {
+			type = ntohs(((struct net_eth_vlan_hdr *)hdr)->type);
+			if (type != NET_ETH_PTYPE_IP && type != NET_ETH_PTYPE_IPV6) {
+				return -ENOTSUP;
+			}
+
+			return sizeof(struct net_eth_vlan_hdr);
+		}
+
+		if (type != NET_ETH_PTYPE_IP && type != NET_ETH_PTYPE_IPV6) {
+			return -ENOTSUP;
+		}
+
+		return sizeof(struct net_eth_hdr);
+	}
+#endif
+
+#if defined(CONFIG_NET_L2_DUMMY)
+	if (net_if_l2(iface) == &NET_L2_GET_NAME(DUMMY)) {
+		return 0;
+	}
+#endif
+
+	ARG_UNUSED(iface);
+	ARG_UNUSED(buf);
+
+	return -ENOTSUP;
+}
+
+/* Hash the addresses, the transport protocol and the ports of a received
+ * packet. Only the first fragment of the packet is looked at.
+ */
+static int rx_flow_hash(struct net_pkt *pkt, uint32_t *hash)
+{
+	struct net_buf *buf = pkt->buffer;
+	struct rx_flow_key key;
+	size_t l4_offset = 0;
+	uint8_t *ip;
+	size_t len;
+	int offset;
+
+	if (buf == NULL) {
+		return -EINVAL;
+	}
+
+	offset = rx_flow_ip_offset(pkt);
+	if (offset < 0) {
+		return offset;
+	}
+
+	ip = buf->data + offset;
+	len = buf->len - offset;
+
+	(void)memset(&key, 0, sizeof(key));
+
+	if (IS_ENABLED(CONFIG_NET_IPV4) && len >= sizeof(struct net_ipv4_hdr) &&
+	    (ip[0] & 0xf0) == 0x40) {
+		struct net_ipv4_hdr *hdr = (struct net_ipv4_hdr *)ip;
+
+		memcpy(key.src, hdr->src, sizeof(struct in_addr));
+		memcpy(key.dst, hdr->dst, sizeof(struct in_addr));
+		key.proto = hdr->proto;
+
+		/* Only the first fragment has the ports */
+		if ((sys_get_be16(hdr->offset) &
+		     (NET_IPV4_MORE_FRAG_MASK | NET_IPV4_FRAGH_OFFSET_MASK)) == 0) {
+			l4_offset = (hdr->vhl & 0x0f) * 4U;
+		}
+	} else if (IS_ENABLED(CONFIG_NET_IPV6) && len >= sizeof(struct net_ipv6_hdr) &&
+		   (ip[0] & 0xf0) == 0x60) {
+		struct net_ipv6_hdr *hdr = (struct net_ipv6_hdr *)ip;
+
+		memcpy(key.src, hdr->src, sizeof(struct in6_addr));
+		memcpy(key.dst, hdr->dst, sizeof(struct in6_addr));
+		key.proto = hdr->nexthdr;
+
+		/* Packets with extension headers are hashed without ports */
+		l4_offset = sizeof(struct net_ipv6_hdr);
+	} else {
+		return -ENOTSUP;
+	}
+
+	if ((key.proto == IPPROTO_TCP || key.proto == IPPROTO_UDP) &&
+	    l4_offset != 0 && len >= l4_offset + 2 * sizeof(uint16_t)) {
+		key.src_port = sys_get_be16(ip + l4_offset);
+		key.dst_port = sys_get_be16(ip + l4_offset + sizeof(uint16_t));
+	}
+
+	*hash = sys_hash32_murmur3(&key, sizeof(key));
+
+	return 0;
+}
+
+/* Pick the RX queue of a packet among the ones of its traffic class */
+static uint8_t rx_queue_select(uint8_t tc, struct net_pkt *pkt)
+{
+	uint8_t queue = 0;
+	uint32_t hash;
+
+	if (rx_flow_hash(pkt, &hash) == 0) {
+		queue = hash % CONFIG_NET_TC_RX_STEERING_QUEUES;
+	} else {
+		net_stats_update_rx_steering_unhashed(net_pkt_iface(pkt));
+	}
+
+	net_stats_update_rx_steering_queued(net_pkt_iface(pkt), queue);
+
+	return tc * CONFIG_NET_TC_RX_STEERING_QUEUES + queue;
+}
+#else
+#define rx_queue_select(tc, pkt) (tc)
+#endif /* CONFIG_NET_TC_RX_STEERING */
+
 void net_tc_submit_to_rx_queue(uint8_t tc, struct net_pkt *pkt)
 {
 #if NET_TC_RX_COUNT > 0
 	net_pkt_set_rx_stats_tick(pkt, k_cycle_get_32());
 
-	submit_to_queue(&rx_classes[tc].fifo, pkt);
+	submit_to_queue(&rx_classes[rx_queue_select(tc, pkt)].fifo, pkt);
 #else
 	ARG_UNUSED(tc);
 	ARG_UNUSED(pkt);
@@ -255,10 +403,33 @@ static void tc_rx_handler(void *p1, void *p2, void *p3)
 		}
 
 		net_process_rx_packet(pkt);
+
+		/* Coalesced TCP segments are only held back while more
+		 * packets are waiting behind them.
+		 */
+		if (IS_ENABLED(CONFIG_NET_TCP_GRO) && k_fifo_is_empty(fifo)) {
+			net_tcp_gro_flush();
+		}
 	}
 }
 #endif
 
+/* Index of the RX queue served by the calling thread, or -1 */
+int net_tc_rx_current(void)
+{
+#if NET_TC_RX_COUNT > 0
+	k_tid_t tid = k_current_get();
+
+	for (int i = 0; i < NET_TC_RX_QUEUE_COUNT; i++) {
+		if (tid == &rx_classes[i].handler) {
+			return i;
+		}
+	}
+#endif
+
+	return -1;
+}
+
 #if NET_TC_TX_COUNT > 0
 static void tc_tx_handler(void *p1, void *p2, void *p3)
 {
@@ -354,12 +525,13 @@ void net_tc_rx_init(void)
 	net_if_foreach(net_tc_rx_stats_priority_setup, NULL);
 #endif
 
-	for (i = 0; i < NET_TC_RX_COUNT; i++) {
+	for (i = 0; i < NET_TC_RX_QUEUE_COUNT; i++) {
 		uint8_t thread_priority;
 		int priority;
 		k_tid_t tid;
 
-		thread_priority = rx_tc2thread(i);
+		/* The queues of a traffic class share its priority */
+		thread_priority = rx_tc2thread(i * NET_TC_RX_COUNT / NET_TC_RX_QUEUE_COUNT);
 
 		priority = IS_ENABLED(CONFIG_NET_TC_THREAD_COOPERATIVE) ?
 			K_PRIO_COOP(thread_priority) :
@@ -393,6 +565,14 @@ void net_tc_rx_init(void)
 			k_thread_name_set(tid, name);
 		}
 
+#if defined(CONFIG_NET_TC_RX_STEERING) && defined(CONFIG_SCHED_CPU_MASK)
+		/* Spread the queues of each traffic class over the CPUs */
+		if (k_thread_cpu_pin(tid, (i % CONFIG_NET_TC_RX_STEERING_QUEUES) %
+				     arch_num_cpus()) < 0) {
+			NET_DBG("Cannot pin RX handler thread %d", i);
+		}
+#endif
+
 		k_thread_start(tid);
 	}
 #endif
@@ -69,6 +69,13 @@ static int tcp_tx_window =
 #define TCP_CONGESTION_INITIAL_WIN 1
 #define TCP_CONGESTION_INITIAL_SSTHRESH 3
 
+#ifdef CONFIG_NET_TCP_GSO
+/* Largest payload of a GSO packet, leaving room for the IP and TCP headers
+ * with options within the 16 bit IP length field.
+ */
+#define TCP_GSO_MAX_LEN (UINT16_MAX - 128)
+#endif
+
 static sys_slist_t tcp_conns = SYS_SLIST_STATIC_INIT(&tcp_conns);
 
 static K_MUTEX_DEFINE(tcp_lock);
@@ -445,9 +452,23 @@ static void tcp_derive_rto(struct tcp *conn)
 
 /* Implementation according to RFC6582 */
 
+/* The congestion window never needs to exceed the largest window the
+ * peer can advertise.
+ */
+static uint32_t tcp_max_cwnd(struct tcp *conn)
+{
+#ifdef CONFIG_NET_TCP_WINDOW_SCALE
+	return (uint32_t)UINT16_MAX << conn->send_wscale;
+#else
+	ARG_UNUSED(conn);
+
+	return UINT16_MAX;
+#endif /* CONFIG_NET_TCP_WINDOW_SCALE */
+}
+
 static void tcp_new_reno_log(struct tcp *conn, char *step)
 {
-	NET_DBG("conn: %p, ca %s, cwnd=%d, ssthres=%d, fast_pend=%i",
+	NET_DBG("conn: %p, ca %s, cwnd=%u, ssthres=%u, fast_pend=%u",
 		conn, step, conn->ca.cwnd, conn->ca.ssthresh,
 		conn->ca.pending_fast_retransmit_bytes);
 }
@@ -481,17 +502,17 @@ static void tcp_new_reno_timeout(struct tcp *conn)
 /* For every duplicate ack increment the cwnd by mss */
 static void tcp_new_reno_dup_ack(struct tcp *conn)
 {
-	int32_t new_win = conn->ca.cwnd;
+	uint32_t new_win = conn->ca.cwnd;
 
 	new_win += conn_mss(conn);
-	conn->ca.cwnd = MIN(new_win, UINT16_MAX);
+	conn->ca.cwnd = MIN(new_win, tcp_max_cwnd(conn));
 	tcp_new_reno_log(conn, "dup_ack");
 }
 
 static void tcp_new_reno_pkts_acked(struct tcp *conn, uint32_t acked_len)
 {
-	int32_t new_win = conn->ca.cwnd;
-	int32_t win_inc = MIN(acked_len, conn_mss(conn));
+	uint32_t new_win = conn->ca.cwnd;
+	uint32_t win_inc = MIN(acked_len, conn_mss(conn));
 
 	if (conn->ca.pending_fast_retransmit_bytes == 0) {
 		if (conn->ca.cwnd < conn->ca.ssthresh) {
@@ -500,7 +521,7 @@ static void tcp_new_reno_pkts_acked(struct tcp *conn, uint32_t acked_len)
 			/* Implement a div_ceil	to avoid rounding to 0 */
 			new_win += ((win_inc * win_inc) + conn->ca.cwnd - 1) / conn->ca.cwnd;
 		}
-		conn->ca.cwnd = MIN(new_win, UINT16_MAX);
+		conn->ca.cwnd = MIN(new_win, tcp_max_cwnd(conn));
 	} else {
 		/* Check if it is still in fast recovery mode */
 		if (conn->ca.pending_fast_retransmit_bytes <= acked_len) {
@@ -1086,8 +1107,12 @@ static uint8_t *tcp_options_get(struct net_pkt *pkt, int tcp_options_len,
 	return buf;
 }
 
+/* MSS, window scale and SACK permitted are only valid on SYN segments
+ * (RFC 793, RFC 7323 and RFC 2018), they are ignored on the others so that
+ * the values negotiated stay. SACK blocks are parsed on every segment.
+ */
 static bool tcp_options_check(struct tcp_options *recv_options,
-			      struct net_pkt *pkt, ssize_t len)
+			      struct net_pkt *pkt, ssize_t len, bool syn)
 {
 	uint8_t options_buf[40]; /* TCP header max options size is 40 */
 	bool result = len > 0 && ((len % 4) == 0) ? true : false;
@@ -1097,8 +1122,14 @@ static bool tcp_options_check(struct tcp_options *recv_options,
 
 	NET_DBG("len=%zd", len);
 
-	recv_options->mss_found = false;
-	recv_options->wnd_found = false;
+	if (syn) {
+		recv_options->mss_found = false;
+		recv_options->wnd_found = false;
+		recv_options->sack_perm_found = false;
+	}
+#ifdef CONFIG_NET_TCP_SACK
+	recv_options->sack_cnt = 0U;
+#endif /* CONFIG_NET_TCP_SACK */
 
 	for ( ; options && len >= 1; options += opt_len, len -= opt_len) {
 		opt = options[0];
@@ -1133,6 +1164,10 @@ static bool tcp_options_check(struct tcp_options *recv_options,
 				goto end;
 			}
 
+			if (!syn) {
+				break;
+			}
+
 			recv_options->mss =
 				ntohs(UNALIGNED_GET((uint16_t *)(options + 2)));
 			recv_options->mss_found = true;
@@ -1144,9 +1179,48 @@ static bool tcp_options_check(struct tcp_options *recv_options,
 				goto end;
 			}
 
-			recv_options->window = opt;
+			if (!syn) {
+				break;
+			}
+
+			recv_options->window = options[2];
+			if (recv_options->window > NET_TCP_MAX_WINDOW_SCALE) {
+				/* RFC 7323, 2.3: log and use the maximum */
+				NET_DBG("Window scale %hu above %d",
+					recv_options->window,
+					NET_TCP_MAX_WINDOW_SCALE);
+				recv_options->window = NET_TCP_MAX_WINDOW_SCALE;
+			}
 			recv_options->wnd_found = true;
 			break;
+		case NET_TCP_SACK_PERM_OPT:
+			if (opt_len != NET_TCP_SACK_PERM_SIZE) {
+				result = false;
+				goto end;
+			}
+
+			if (syn) {
+				recv_options->sack_perm_found = true;
+			}
+			break;
+#ifdef CONFIG_NET_TCP_SACK
+		case NET_TCP_SACK_OPT:
+			if (((opt_len - 2) % NET_TCP_SACK_BLOCK_SIZE) != 0) {
+				result = false;
+				goto end;
+			}
+
+			for (int i = 2; i < opt_len &&
+			     recv_options->sack_cnt < NET_TCP_SACK_MAX_BLOCKS;
+			     i += NET_TCP_SACK_BLOCK_SIZE) {
+				struct tcp_sack_block *blk =
+					&recv_options->sack[recv_options->sack_cnt++];
+
+				blk->start = ntohl(UNALIGNED_GET((uint32_t *)(options + i)));
+				blk->end = ntohl(UNALIGNED_GET((uint32_t *)(options + i + 4)));
+			}
+			break;
+#endif /* CONFIG_NET_TCP_SACK */
 		default:
 			continue;
 		}
@@ -1196,10 +1270,10 @@ static int tcp_update_recv_wnd(struct tcp *conn, int32_t delta)
 	bool short_win_before;
 	bool short_win_after;
 
-	new_win = conn->recv_win + delta;
+	new_win = (int32_t)conn->recv_win + delta;
 	if (new_win < 0) {
 		new_win = 0;
-	} else if (new_win > conn->recv_win_max) {
+	} else if (new_win > (int32_t)conn->recv_win_max) {
 		new_win = conn->recv_win_max;
 	}
 
@@ -1337,6 +1411,117 @@ static int tcp_finalize_pkt(struct net_pkt *pkt)
 	return -EINVAL;
 }
 
+#ifdef CONFIG_NET_TCP_SACK
+/* Called with the peer's SYN or SYN-ACK. SACK is used only if both sides
+ * sent the SACK-permitted option.
+ */
+static void tcp_sack_negotiate(struct tcp *conn, bool peer_sack)
+{
+	conn->sack_permitted = peer_sack;
+	conn->sack_board_cnt = 0U;
+	conn->sack_recovery = false;
+}
+
+/* Describe the out-of-order data we hold in the SACK blocks of the next
+ * ACK. The queue holds contiguous data, so this usually yields a single
+ * block, which then also is the one holding the most recent segment as
+ * RFC 2018 asks for.
+ */
+static void tcp_sack_blocks_fill(struct tcp *conn, uint8_t flags)
+{
+	struct tcp_sack_block *blocks = conn->send_options.sack;
+	uint8_t cnt = 0U;
+	struct net_buf *buf;
+
+	conn->send_options.sack_cnt = 0U;
+
+	if (!conn->sack_permitted || !(flags & ACK) || (flags & (SYN | RST)) ||
+	    !CONFIG_NET_TCP_RECV_QUEUE_TIMEOUT ||
+	    net_pkt_is_empty(conn->queue_recv_data)) {
+		return;
+	}
+
+	for (buf = conn->queue_recv_data->buffer; buf != NULL; buf = buf->frags) {
+		uint32_t seq = tcp_get_seq(buf);
+
+		if (buf->len == 0U ||
+		    !net_tcp_seq_greater(seq + buf->len, conn->ack)) {
+			continue;
+		}
+
+		if (cnt > 0U && blocks[cnt - 1].end == seq) {
+			blocks[cnt - 1].end += buf->len;
+			continue;
+		}
+
+		if (cnt == NET_TCP_SACK_MAX_BLOCKS) {
+			break;
+		}
+
+		blocks[cnt].start = net_tcp_seq_greater(seq, conn->ack) ? seq : conn->ack;
+		blocks[cnt].end = seq + buf->len;
+		cnt++;
+	}
+
+	conn->send_options.sack_cnt = cnt;
+}
+
+static size_t tcp_sack_opt_len(struct tcp *conn)
+{
+	if (conn->send_options.sack_cnt == 0U) {
+		return 0;
+	}
+
+	/* Two NOPs for alignment, then kind, length and the blocks */
+	return 4 + conn->send_options.sack_cnt * NET_TCP_SACK_BLOCK_SIZE;
+}
+
+/* The MSS counts the TCP options too (RFC 6691), so a data segment only
+ * carries the SACK blocks that fit next to its data. The segments of a GSO
+ * packet are all full-sized and carry none.
+ */
+static void tcp_sack_blocks_fit(struct tcp *conn, struct net_pkt *data)
+{
+	size_t len = net_pkt_get_len(data);
+
+	if (net_pkt_gso_size(data) != 0U) {
+		conn->send_options.sack_cnt = 0U;
+		return;
+	}
+
+	while (conn->send_options.sack_cnt > 0U &&
+	       len + tcp_sack_opt_len(conn) > conn_mss(conn)) {
+		conn->send_options.sack_cnt--;
+	}
+}
+#else
+static void tcp_sack_negotiate(struct tcp *conn, bool peer_sack) { }
+
+static void tcp_sack_blocks_fill(struct tcp *conn, uint8_t flags) { }
+
+static size_t tcp_sack_opt_len(struct tcp *conn) { return 0; }
+
+static void tcp_sack_blocks_fit(struct tcp *conn, struct net_pkt *data) { }
+#endif /* CONFIG_NET_TCP_SACK */
+
+/* Window field of an outgoing segment. RFC 7323: the window in a SYN
+ * segment is never scaled.
+ */
+static uint16_t tcp_adv_window(struct tcp *conn, uint8_t flags)
+{
+	uint32_t win = conn->recv_win;
+
+#ifdef CONFIG_NET_TCP_WINDOW_SCALE
+	if (!(flags & SYN)) {
+		win >>= conn->recv_wscale;
+	}
+#else
+	ARG_UNUSED(flags);
+#endif /* CONFIG_NET_TCP_WINDOW_SCALE */
+
+	return (uint16_t)MIN(win, UINT16_MAX);
+}
+
 static int tcp_header_add(struct tcp *conn, struct net_pkt *pkt, uint8_t flags,
 			  uint32_t seq)
 {
@@ -1358,8 +1543,18 @@ static int tcp_header_add(struct tcp *conn, struct net_pkt *pkt, uint8_t flags,
 		th->th_off++;
 	}
 
+	if (conn->send_options.wnd_found) {
+		th->th_off++;
+	}
+
+	if (conn->send_options.sack_perm_found) {
+		th->th_off++;
+	}
+
+	th->th_off += tcp_sack_opt_len(conn) / 4;
+
 	UNALIGNED_PUT(flags, &th->th_flags);
-	UNALIGNED_PUT(htons(conn->recv_win), &th->th_win);
+	UNALIGNED_PUT(htons(tcp_adv_window(conn, flags)), &th->th_win);
 	UNALIGNED_PUT(htonl(seq), &th->th_seq);
 
 	if (ACK & flags) {
@@ -1436,6 +1631,107 @@ static int net_tcp_set_mss_opt(struct tcp *conn, struct net_pkt *pkt)
 	return net_pkt_set_data(pkt, &mss_opt_access);
 }
 
+#ifdef CONFIG_NET_TCP_WINDOW_SCALE
+static int net_tcp_set_wscale_opt(struct tcp *conn, struct net_pkt *pkt)
+{
+	NET_PKT_DATA_ACCESS_DEFINE(wscale_opt_access, uint32_t);
+	uint32_t *opt;
+	uint32_t wscale;
+
+	opt = net_pkt_get_data(pkt, &wscale_opt_access);
+	if (!opt) {
+		return -ENOBUFS;
+	}
+
+	/* NOP padding keeps the header 32-bit aligned */
+	wscale = (NET_TCP_NOP_OPT << 24) | (NET_TCP_WINDOW_SCALE_OPT << 16) |
+		 (NET_TCP_WINDOW_SCALE_SIZE << 8) | conn->recv_wscale;
+
+	UNALIGNED_PUT(htonl(wscale), opt);
+
+	return net_pkt_set_data(pkt, &wscale_opt_access);
+}
+
+/* Smallest shift that lets the advertised window cover the receive window */
+static uint8_t tcp_wscale_get(uint32_t win)
+{
+	uint8_t shift = 0U;
+
+	while (shift < NET_TCP_MAX_WINDOW_SCALE && (win >> shift) > UINT16_MAX) {
+		shift++;
+	}
+
+	return shift;
+}
+#endif /* CONFIG_NET_TCP_WINDOW_SCALE */
+
+#ifdef CONFIG_NET_TCP_SACK
+static int net_tcp_set_sack_perm_opt(struct tcp *conn, struct net_pkt *pkt)
+{
+	NET_PKT_DATA_ACCESS_DEFINE(sack_perm_opt_access, uint32_t);
+	uint32_t *opt;
+	uint32_t sack_perm;
+
+	opt = net_pkt_get_data(pkt, &sack_perm_opt_access);
+	if (!opt) {
+		return -ENOBUFS;
+	}
+
+	sack_perm = (NET_TCP_NOP_OPT << 24) | (NET_TCP_NOP_OPT << 16) |
+		    (NET_TCP_SACK_PERM_OPT << 8) | NET_TCP_SACK_PERM_SIZE;
+
+	UNALIGNED_PUT(htonl(sack_perm), opt);
+
+	return net_pkt_set_data(pkt, &sack_perm_opt_access);
+}
+
+static int net_tcp_set_sack_opt(struct tcp *conn, struct net_pkt *pkt)
+{
+	uint8_t opt[4 + NET_TCP_SACK_MAX_BLOCKS * NET_TCP_SACK_BLOCK_SIZE];
+	size_t len = tcp_sack_opt_len(conn);
+
+	opt[0] = NET_TCP_NOP_OPT;
+	opt[1] = NET_TCP_NOP_OPT;
+	opt[2] = NET_TCP_SACK_OPT;
+	opt[3] = len - 2;
+
+	for (int i = 0; i < conn->send_options.sack_cnt; i++) {
+		uint8_t *blk = &opt[4 + i * NET_TCP_SACK_BLOCK_SIZE];
+
+		UNALIGNED_PUT(htonl(conn->send_options.sack[i].start), (uint32_t *)blk);
+		UNALIGNED_PUT(htonl(conn->send_options.sack[i].end), (uint32_t *)(blk + 4));
+	}
+
+	return net_pkt_write(pkt, opt, len);
+}
+#endif /* CONFIG_NET_TCP_SACK */
+
+/* Called with the peer's SYN or SYN-ACK, once conn->recv_wscale holds
+ * the shift we announce. Window scaling is used only if both sides sent
+ * the option, otherwise both windows stay within 64 KiB.
+ */
+static void tcp_wscale_negotiate(struct tcp *conn, bool peer_wscale)
+{
+#ifdef CONFIG_NET_TCP_WINDOW_SCALE
+	if (peer_wscale) {
+		conn->send_wscale = conn->recv_options.window;
+		NET_DBG("conn: %p window scale send %u recv %u", conn,
+			conn->send_wscale, conn->recv_wscale);
+		return;
+	}
+
+	conn->send_wscale = 0U;
+	conn->recv_wscale = 0U;
+#else
+	ARG_UNUSED(peer_wscale);
+#endif /* CONFIG_NET_TCP_WINDOW_SCALE */
+
+	if (conn->recv_win_max > UINT16_MAX) {
+		conn->recv_win_max = UINT16_MAX;
+		conn->recv_win = MIN(conn->recv_win, UINT16_MAX);
+	}
+}
+
 static bool is_destination_local(struct net_pkt *pkt)
 {
 	if (IS_ENABLED(CONFIG_NET_IPV4) && net_pkt_family(pkt) == AF_INET) {
@@ -1548,6 +1844,21 @@ static int tcp_out_ext(struct tcp *conn, uint8_t flags, struct net_pkt *data,
 		alloc_len += sizeof(uint32_t);
 	}
 
+	if (conn->send_options.wnd_found) {
+		alloc_len += sizeof(uint32_t);
+	}
+
+	if (conn->send_options.sack_perm_found) {
+		alloc_len += sizeof(uint32_t);
+	}
+
+	tcp_sack_blocks_fill(conn, flags);
+	if (data) {
+		tcp_sack_blocks_fit(conn, data);
+	}
+
+	alloc_len += tcp_sack_opt_len(conn);
+
 	pkt = tcp_pkt_alloc(conn, alloc_len);
 	if (!pkt) {
 		ret = -ENOBUFS;
@@ -1558,6 +1869,7 @@ static int tcp_out_ext(struct tcp *conn, uint8_t flags, struct net_pkt *data,
 		/* Append the data buffer to the pkt */
 		net_pkt_append_buffer(pkt, data->buffer);
 		data->buffer = NULL;
+		net_pkt_set_gso_size(pkt, net_pkt_gso_size(data));
 	}
 
 	ret = ip_header_add(conn, pkt);
@@ -1580,6 +1892,34 @@ static int tcp_out_ext(struct tcp *conn, uint8_t flags, struct net_pkt *data,
 		}
 	}
 
+#ifdef CONFIG_NET_TCP_WINDOW_SCALE
+	if (conn->send_options.wnd_found) {
+		ret = net_tcp_set_wscale_opt(conn, pkt);
+		if (ret < 0) {
+			tcp_pkt_unref(pkt);
+			goto out;
+		}
+	}
+#endif /* CONFIG_NET_TCP_WINDOW_SCALE */
+
+#ifdef CONFIG_NET_TCP_SACK
+	if (conn->send_options.sack_perm_found) {
+		ret = net_tcp_set_sack_perm_opt(conn, pkt);
+		if (ret < 0) {
+			tcp_pkt_unref(pkt);
+			goto out;
+		}
+	}
+
+	if (conn->send_options.sack_cnt > 0U) {
+		ret = net_tcp_set_sack_opt(conn, pkt);
+		if (ret < 0) {
+			tcp_pkt_unref(pkt);
+			goto out;
+		}
+	}
+#endif /* CONFIG_NET_TCP_SACK */
+
 	ret = tcp_finalize_pkt(pkt);
 	if (ret < 0) {
 		tcp_pkt_unref(pkt);
@@ -1721,13 +2061,13 @@ static int tcp_unsent_len(struct tcp *conn)
 	if (conn->unacked_len >= conn->send_win) {
 		unsent_len = 0;
 	} else {
-		unsent_len = MIN(unsent_len, conn->send_win - conn->unacked_len);
+		unsent_len = MIN(unsent_len, (int)(conn->send_win - conn->unacked_len));
 
 #ifdef CONFIG_NET_TCP_CONGESTION_AVOIDANCE
 		if (conn->unacked_len >= conn->ca.cwnd) {
 			unsent_len = 0;
 		} else {
-			unsent_len = MIN(unsent_len, conn->ca.cwnd - conn->unacked_len);
+			unsent_len = MIN(unsent_len, (int)(conn->ca.cwnd - conn->unacked_len));
 		}
 #endif
 	}
@@ -1735,42 +2075,73 @@ static int tcp_unsent_len(struct tcp *conn)
 	return unsent_len;
 }
 
-static int tcp_send_data(struct tcp *conn)
+/* Data for a local address is looped back before it reaches a device that
+ * could segment it, so it is never sent as a GSO packet.
+ */
+static bool tcp_gso_usable(struct tcp *conn)
+{
+	if (IS_ENABLED(CONFIG_NET_IPV4) && conn->dst.sa.sa_family == AF_INET) {
+		return !net_ipv4_is_addr_loopback(&conn->dst.sin.sin_addr) &&
+			!net_ipv4_is_my_addr(&conn->dst.sin.sin_addr);
+	}
+
+	if (IS_ENABLED(CONFIG_NET_IPV6) && conn->dst.sa.sa_family == AF_INET6) {
+		return !net_ipv6_is_addr_loopback(&conn->dst.sin6.sin6_addr) &&
+			!net_ipv6_is_my_addr(&conn->dst.sin6.sin6_addr);
+	}
+
+	return false;
+}
+
+/* More than a segment of data goes out as one GSO packet. It is larger than
+ * the MTU, so its buffer is allocated without the MTU limit.
+ */
+static struct net_pkt *tcp_gso_pkt_alloc(struct tcp *conn, int len)
 {
-	int ret = 0;
-	int len;
 	struct net_pkt *pkt;
 
-	len = MIN(tcp_unsent_len(conn), conn_mss(conn));
-	if (len < 0) {
-		ret = len;
-		goto out;
+	pkt = tcp_pkt_alloc(conn, 0);
+	if (!pkt) {
+		return NULL;
 	}
-	if (len == 0) {
-		NET_DBG("conn: %p no data to send", conn);
-		ret = -ENODATA;
-		goto out;
+
+	if (net_pkt_alloc_buffer_raw(pkt, len, TCP_PKT_ALLOC_TIMEOUT) < 0) {
+		tcp_pkt_unref(pkt);
+		return NULL;
+	}
+
+	net_pkt_set_gso_size(pkt, conn_mss(conn));
+
+	return pkt;
+}
+
+/* Send len bytes found at offset in the send_data queue */
+static int tcp_send_range(struct tcp *conn, int offset, int len, bool resend)
+{
+	struct net_pkt *pkt;
+	int ret;
+
+	if (IS_ENABLED(CONFIG_NET_TCP_GSO) && len > conn_mss(conn) &&
+	    tcp_gso_usable(conn)) {
+		pkt = tcp_gso_pkt_alloc(conn, len);
+	} else {
+		pkt = tcp_pkt_alloc(conn, len);
 	}
 
-	pkt = tcp_pkt_alloc(conn, len);
 	if (!pkt) {
 		NET_ERR("conn: %p packet allocation failed, len=%d", conn, len);
-		ret = -ENOBUFS;
-		goto out;
+		return -ENOBUFS;
 	}
 
-	ret = tcp_pkt_peek(pkt, conn->send_data, conn->unacked_len, len);
+	ret = tcp_pkt_peek(pkt, conn->send_data, offset, len);
 	if (ret < 0) {
 		tcp_pkt_unref(pkt);
-		ret = -ENOBUFS;
-		goto out;
+		return -ENOBUFS;
 	}
 
-	ret = tcp_out_ext(conn, PSH | ACK, pkt, conn->seq + conn->unacked_len);
+	ret = tcp_out_ext(conn, PSH | ACK, pkt, conn->seq + offset);
 	if (ret == 0) {
-		conn->unacked_len += len;
-
-		if (conn->data_mode == TCP_DATA_MODE_RESEND) {
+		if (resend) {
 			net_stats_update_tcp_resent(conn->iface, len);
 			net_stats_update_tcp_seg_rexmit(conn->iface);
 		} else {
@@ -1785,6 +2156,297 @@ static int tcp_send_data(struct tcp *conn)
 	 */
 	tcp_pkt_unref(pkt);
 
+	return ret;
+}
+
+#ifdef CONFIG_NET_TCP_SACK
+/* Merge [start, end) into the scoreboard, which is kept sorted and free of
+ * overlaps. When it is full, the highest block is forgotten, as the holes
+ * nearest to conn->seq are the ones that matter for recovery.
+ */
+static void tcp_sack_board_add(struct tcp *conn, uint32_t start, uint32_t end)
+{
+	struct tcp_sack_block *board = conn->sack_board;
+	int cnt = conn->sack_board_cnt;
+	int i, j;
+
+	for (i = 0; i < cnt && net_tcp_seq_cmp(board[i].end, start) < 0; i++) {
+	}
+
+	for (j = i; j < cnt && net_tcp_seq_cmp(board[j].start, end) <= 0; j++) {
+		if (net_tcp_seq_cmp(board[j].start, start) < 0) {
+			start = board[j].start;
+		}
+
+		if (net_tcp_seq_cmp(board[j].end, end) > 0) {
+			end = board[j].end;
+		}
+	}
+
+	if (i == j && cnt == NET_TCP_SACK_MAX_BLOCKS) {
+		if (i == cnt) {
+			return;
+		}
+
+		cnt--;
+	}
+
+	memmove(&board[i + 1], &board[j], (cnt - j) * sizeof(board[0]));
+	board[i].start = start;
+	board[i].end = end;
+	conn->sack_board_cnt = cnt - (j - i) + 1;
+}
+
+/* Drop the scoreboard entries covered by the cumulative ACK */
+static void tcp_sack_board_prune(struct tcp *conn)
+{
+	struct tcp_sack_block *board = conn->sack_board;
+	int i;
+
+	for (i = 0; i < conn->sack_board_cnt &&
+	     !net_tcp_seq_greater(board[i].end, conn->seq); i++) {
+	}
+
+	conn->sack_board_cnt -= i;
+	memmove(&board[0], &board[i], conn->sack_board_cnt * sizeof(board[0]));
+
+	if (conn->sack_board_cnt > 0U &&
+	    net_tcp_seq_greater(conn->seq, board[0].start)) {
+		board[0].start = conn->seq;
+	}
+}
+
+static bool tcp_sack_in_recovery(struct tcp *conn)
+{
+	return conn->sack_recovery;
+}
+
+/* Resend the holes between conn->sack_rexmit_next and the highest SACKed
+ * block. The holes lie within data that was already in flight, so this
+ * never sends more than the current flight size.
+ */
+static void tcp_sack_retransmit(struct tcp *conn)
+{
+	uint32_t next = conn->sack_rexmit_next;
+
+	if (net_tcp_seq_greater(conn->seq, next)) {
+		next = conn->seq;
+	}
+
+	for (int i = 0; i < conn->sack_board_cnt; i++) {
+		struct tcp_sack_block *blk = &conn->sack_board[i];
+
+		while (net_tcp_seq_greater(blk->start, next)) {
+			int len = MIN(blk->start - next, conn_mss(conn));
+
+			NET_DBG("conn: %p SACK resend seq %u len %d", conn, next, len);
+
+			if (tcp_send_range(conn, next - conn->seq, len, true) < 0) {
+				goto out;
+			}
+
+			next += len;
+		}
+
+		if (net_tcp_seq_greater(blk->end, next)) {
+			next = blk->end;
+		}
+	}
+out:
+	conn->sack_rexmit_next = next;
+}
+
+/* Record the SACK blocks of an incoming ACK */
+static void tcp_sack_update(struct tcp *conn, size_t tcp_options_len)
+{
+	uint32_t snd_nxt = conn->seq + conn->unacked_len;
+	bool updated = false;
+
+	if (!conn->sack_permitted || tcp_options_len == 0) {
+		return;
+	}
+
+	for (int i = 0; i < conn->recv_options.sack_cnt; i++) {
+		struct tcp_sack_block *blk = &conn->recv_options.sack[i];
+
+		/* Ignore blocks that are acked already or cover unsent data */
+		if (!net_tcp_seq_greater(blk->end, blk->start) ||
+		    !net_tcp_seq_greater(blk->start, conn->seq) ||
+		    net_tcp_seq_greater(blk->end, snd_nxt)) {
+			continue;
+		}
+
+		tcp_sack_board_add(conn, blk->start, blk->end);
+		updated = true;
+	}
+
+	/* New SACK information can expose further holes */
+	if (updated && conn->sack_recovery) {
+		tcp_sack_retransmit(conn);
+	}
+}
+
+/* Called on the duplicate ACK that triggers fast retransmit. Returns false
+ * when no SACK information is available and the caller should fall back to
+ * resending the first segment only.
+ */
+static bool tcp_sack_recovery_start(struct tcp *conn)
+{
+	if (!conn->sack_permitted || conn->sack_board_cnt == 0U) {
+		return false;
+	}
+
+	conn->sack_recovery = true;
+	conn->sack_recovery_point = conn->seq + conn->unacked_len;
+	conn->sack_rexmit_next = conn->seq;
+
+	tcp_sack_retransmit(conn);
+
+	return true;
+}
+
+/* Called once conn->seq has advanced over newly acked data */
+static void tcp_sack_acked(struct tcp *conn)
+{
+	int len;
+
+	tcp_sack_board_prune(conn);
+
+	if (!conn->sack_recovery) {
+		return;
+	}
+
+	if (!net_tcp_seq_greater(conn->sack_recovery_point, conn->seq)) {
+		conn->sack_recovery = false;
+		return;
+	}
+
+	/* Partial ACK. If nothing is SACKed above it, the front of the queue
+	 * is lost as well: resend it as NewReno would.
+	 */
+	if (conn->sack_board_cnt == 0U &&
+	    !net_tcp_seq_greater(conn->sack_rexmit_next, conn->seq)) {
+		len = MIN(conn->unacked_len, conn_mss(conn));
+		if (len > 0 && tcp_send_range(conn, 0, len, true) == 0) {
+			conn->sack_rexmit_next = conn->seq + len;
+		}
+
+		return;
+	}
+
+	tcp_sack_retransmit(conn);
+}
+
+static void tcp_sack_timeout(struct tcp *conn)
+{
+	conn->sack_recovery = false;
+
+	/* Keep the scoreboard over the first timeout, so that the following
+	 * go-back-N skips data the peer holds. Should the timer expire again,
+	 * the peer may have discarded that data (RFC 2018, section 8).
+	 */
+	if (conn->send_data_retries > 0) {
+		conn->sack_board_cnt = 0U;
+	}
+}
+
+/* Move conn->unacked_len past data the peer has SACKed */
+static void tcp_sack_skip(struct tcp *conn)
+{
+	uint32_t offset = conn->unacked_len;
+
+	for (int i = 0; i < conn->sack_board_cnt; i++) {
+		uint32_t start = conn->sack_board[i].start - conn->seq;
+		uint32_t end = conn->sack_board[i].end - conn->seq;
+
+		if (start <= offset && end > offset) {
+			offset = end;
+		}
+	}
+
+	conn->unacked_len = offset;
+}
+
+/* Shorten a segment at conn->unacked_len so it ends at the next SACKed block */
+static int tcp_sack_clip(struct tcp *conn, int len)
+{
+	uint32_t offset = conn->unacked_len;
+
+	for (int i = 0; i < conn->sack_board_cnt; i++) {
+		uint32_t start = conn->sack_board[i].start - conn->seq;
+
+		if (start > offset) {
+			return MIN(len, (int)(start - offset));
+		}
+	}
+
+	return len;
+}
+#else
+static inline bool tcp_sack_in_recovery(struct tcp *conn) { return false; }
+
+static void tcp_sack_update(struct tcp *conn, size_t tcp_options_len) { }
+
+static inline bool tcp_sack_recovery_start(struct tcp *conn) { return false; }
+
+static void tcp_sack_acked(struct tcp *conn) { }
+
+static void tcp_sack_timeout(struct tcp *conn) { }
+
+static void tcp_sack_skip(struct tcp *conn) { }
+
+static int tcp_sack_clip(struct tcp *conn, int len) { return len; }
+#endif /* CONFIG_NET_TCP_SACK */
+
+/* Length of the next packet of new data. With GSO this can be several full
+ * segments, and a tail shorter than a segment is left for the next round,
+ * so that Nagle's algorithm sees it just as it would without GSO.
+ */
+static int tcp_send_len(struct tcp *conn)
+{
+	int unsent_len = tcp_unsent_len(conn);
+	int mss = conn_mss(conn);
+
+#ifdef CONFIG_NET_TCP_GSO
+	int max_len = MIN(CONFIG_NET_TCP_GSO_MAX_SEGS * mss, TCP_GSO_MAX_LEN);
+
+	if (unsent_len > mss && max_len >= 2 * mss &&
+	    conn->data_mode != TCP_DATA_MODE_RESEND) {
+		unsent_len = MIN(unsent_len, max_len);
+
+		return unsent_len - unsent_len % mss;
+	}
+#endif /* CONFIG_NET_TCP_GSO */
+
+	return MIN(unsent_len, mss);
+}
+
+static int tcp_send_data(struct tcp *conn)
+{
+	int ret = 0;
+	int len;
+
+	tcp_sack_skip(conn);
+
+	len = tcp_send_len(conn);
+	if (len < 0) {
+		ret = len;
+		goto out;
+	}
+
+	len = tcp_sack_clip(conn, len);
+	if (len == 0) {
+		NET_DBG("conn: %p no data to send", conn);
+		ret = -ENODATA;
+		goto out;
+	}
+
+	ret = tcp_send_range(conn, conn->unacked_len, len,
+			     conn->data_mode == TCP_DATA_MODE_RESEND);
+	if (ret == 0) {
+		conn->unacked_len += len;
+	}
+
 	conn_send_data_dump(conn);
 
  out:
@@ -1882,6 +2544,8 @@ static void tcp_resend_data(struct k_work *work)
 		}
 	}
 
+	tcp_sack_timeout(conn);
+
 	conn->data_mode = TCP_DATA_MODE_RESEND;
 	conn->unacked_len = 0;
 
@@ -2125,9 +2789,13 @@ static struct tcp *tcp_conn_alloc(void)
 	conn->in_connect = false;
 	conn->state = TCP_LISTEN;
 	conn->recv_win_max = tcp_rx_window;
+	conn->send_win_max = MAX(tcp_tx_window, NET_IPV6_MTU);
+	if (!IS_ENABLED(CONFIG_NET_TCP_WINDOW_SCALE)) {
+		conn->recv_win_max = MIN(conn->recv_win_max, UINT16_MAX);
+		conn->send_win_max = MIN(conn->send_win_max, UINT16_MAX);
+	}
 	conn->recv_win = conn->recv_win_max;
 	conn->recv_win_sent = conn->recv_win_max;
-	conn->send_win_max = MAX(tcp_tx_window, NET_IPV6_MTU);
 	conn->send_win = conn->send_win_max;
 	conn->tcp_nodelay = false;
 	conn->addr_ref_done = false;
@@ -2234,6 +2902,30 @@ static struct tcp *tcp_conn_search(struct net_pkt *pkt)
 	return found ? conn : NULL;
 }
 
+/* An established connection registers its own connection handler, so the
+ * context passed to tcp_recv() normally owns the connection the packet is
+ * for and the walk over all the connections can be skipped.
+ */
+static struct tcp *tcp_conn_search_context(struct net_context *context,
+					   struct net_pkt *pkt)
+{
+	struct tcp *conn = NULL;
+
+	if (context == NULL) {
+		return NULL;
+	}
+
+	k_mutex_lock(&tcp_lock, K_FOREVER);
+
+	if (context->tcp != NULL && tcp_conn_cmp(context->tcp, pkt)) {
+		conn = context->tcp;
+	}
+
+	k_mutex_unlock(&tcp_lock);
+
+	return conn;
+}
+
 static struct tcp *tcp_conn_new(struct net_pkt *pkt);
 
 static enum net_verdict tcp_recv(struct net_conn *net_conn,
@@ -2249,7 +2941,11 @@ static enum net_verdict tcp_recv(struct net_conn *net_conn,
 	ARG_UNUSED(net_conn);
 	ARG_UNUSED(proto);
 
-	conn = tcp_conn_search(pkt);
+	conn = tcp_conn_search_context(user_data, pkt);
+	if (conn == NULL) {
+		conn = tcp_conn_search(pkt);
+	}
+
 	if (conn) {
 		goto in;
 	}
@@ -2758,6 +3454,24 @@ static void tcp_out_of_order_data(struct tcp *conn, struct net_pkt *pkt,
 	tcp_queue_recv_data(conn, pkt, data_len, seq);
 }
 
+/* Largest receive window the connection can advertise. The shift is
+ * only fixed once our SYN or SYN-ACK has been sent.
+ */
+static uint32_t tcp_recv_win_limit(struct tcp *conn)
+{
+#ifdef CONFIG_NET_TCP_WINDOW_SCALE
+	if (conn->state == TCP_LISTEN) {
+		return (uint32_t)UINT16_MAX << NET_TCP_MAX_WINDOW_SCALE;
+	}
+
+	return (uint32_t)UINT16_MAX << conn->recv_wscale;
+#else
+	ARG_UNUSED(conn);
+
+	return UINT16_MAX;
+#endif /* CONFIG_NET_TCP_WINDOW_SCALE */
+}
+
 static void tcp_check_sock_options(struct tcp *conn)
 {
 	int sndbuf_opt = 0;
@@ -2784,6 +3498,10 @@ static void tcp_check_sock_options(struct tcp *conn)
 		k_mutex_unlock(&conn->lock);
 	}
 
+	if (rcvbuf_opt > 0) {
+		rcvbuf_opt = MIN((uint32_t)rcvbuf_opt, tcp_recv_win_limit(conn));
+	}
+
 	if (rcvbuf_opt > 0 && rcvbuf_opt != conn->recv_win_max) {
 		int diff;
 
@@ -2869,7 +3587,7 @@ static enum net_verdict tcp_in(struct tcp *conn, struct net_pkt *pkt)
 	}
 
 	if (tcp_options_len && !tcp_options_check(&conn->recv_options, pkt,
-						  tcp_options_len)) {
+						  tcp_options_len, (fl & SYN) != 0)) {
 		NET_DBG("DROP: Invalid TCP option list");
 		tcp_out(conn, RST);
 		do_close = true;
@@ -2894,6 +3612,12 @@ static enum net_verdict tcp_in(struct tcp *conn, struct net_pkt *pkt)
 
 	if (th) {
 		conn->send_win = ntohs(th_win(th));
+#ifdef CONFIG_NET_TCP_WINDOW_SCALE
+		/* RFC 7323: the window in a SYN segment is never scaled */
+		if (!(th_flags(th) & SYN)) {
+			conn->send_win <<= conn->send_wscale;
+		}
+#endif /* CONFIG_NET_TCP_WINDOW_SCALE */
 		if (conn->send_win > conn->send_win_max) {
 			NET_DBG("Lowering send window from %u to %u",
 				conn->send_win, conn->send_win_max);
@@ -2925,11 +3649,27 @@ next_state:
 	switch (conn->state) {
 	case TCP_LISTEN:
 		if (FL(&fl, ==, SYN)) {
+			bool peer_wscale = IS_ENABLED(CONFIG_NET_TCP_WINDOW_SCALE) &&
+					   tcp_options_len && conn->recv_options.wnd_found;
+			bool peer_sack = IS_ENABLED(CONFIG_NET_TCP_SACK) &&
+					 tcp_options_len && conn->recv_options.sack_perm_found;
+
+#ifdef CONFIG_NET_TCP_WINDOW_SCALE
+			conn->recv_wscale = tcp_wscale_get(conn->recv_win_max);
+#endif /* CONFIG_NET_TCP_WINDOW_SCALE */
+			tcp_wscale_negotiate(conn, peer_wscale);
+			tcp_sack_negotiate(conn, peer_sack);
+
 			/* Make sure our MSS is also sent in the ACK */
 			conn->send_options.mss_found = true;
+			/* Only answer window scale and SACK-permitted options */
+			conn->send_options.wnd_found = peer_wscale;
+			conn->send_options.sack_perm_found = peer_sack;
 			conn_ack(conn, th_seq(th) + 1); /* capture peer's isn */
 			tcp_out(conn, SYN | ACK);
 			conn->send_options.mss_found = false;
+			conn->send_options.wnd_found = false;
+			conn->send_options.sack_perm_found = false;
 			conn_seq(conn, + 1);
 			next = TCP_SYN_RECEIVED;
 
@@ -2941,7 +3681,14 @@ next_state:
 			verdict = NET_OK;
 		} else {
 			conn->send_options.mss_found = true;
+#ifdef CONFIG_NET_TCP_WINDOW_SCALE
+			conn->recv_wscale = tcp_wscale_get(conn->recv_win_max);
+			conn->send_options.wnd_found = true;
+#endif /* CONFIG_NET_TCP_WINDOW_SCALE */
+			conn->send_options.sack_perm_found = IS_ENABLED(CONFIG_NET_TCP_SACK);
 			ret = tcp_out_ext(conn, SYN, NULL /* no data */, conn->seq);
+			conn->send_options.wnd_found = false;
+			conn->send_options.sack_perm_found = false;
 			if (ret < 0) {
 				do_close = true;
 				close_status = ret;
@@ -3051,6 +3798,10 @@ next_state:
 		 * 6 of RFC 793
 		 */
 		if (FL(&fl, &, SYN | ACK, th && th_ack(th) == conn->seq)) {
+			tcp_wscale_negotiate(conn, IS_ENABLED(CONFIG_NET_TCP_WINDOW_SCALE) &&
+					     tcp_options_len && conn->recv_options.wnd_found);
+			tcp_sack_negotiate(conn, IS_ENABLED(CONFIG_NET_TCP_SACK) &&
+					   tcp_options_len && conn->recv_options.sack_perm_found);
 			tcp_send_timer_cancel(conn);
 			conn_ack(conn, th_seq(th) + 1);
 			if (len) {
@@ -3135,6 +3886,10 @@ next_state:
 		 */
 		keep_alive_timer_restart(conn);
 
+		if (th) {
+			tcp_sack_update(conn, tcp_options_len);
+		}
+
 #ifdef CONFIG_NET_TCP_FAST_RETRANSMIT
 		if (th && (net_tcp_seq_cmp(th_ack(th), conn->seq) == 0)) {
 			/* Only if there is pending data, increment the duplicate ack count */
@@ -3154,16 +3909,22 @@ next_state:
 
 			/* Only do fast retransmit when not already in a resend state */
 			if ((conn->data_mode == TCP_DATA_MODE_SEND) &&
-			    (conn->dup_ack_cnt == DUPLICATE_ACK_RETRANSMIT_TRHESHOLD)) {
-				/* Apply a fast retransmit */
-				int temp_unacked_len = conn->unacked_len;
+			    (conn->dup_ack_cnt == DUPLICATE_ACK_RETRANSMIT_TRHESHOLD) &&
+			    !tcp_sack_in_recovery(conn)) {
+				/* With SACK, resend every hole below the highest
+				 * SACKed block, otherwise apply a fast retransmit
+				 * of the first segment.
+				 */
+				if (!tcp_sack_recovery_start(conn)) {
+					int temp_unacked_len = conn->unacked_len;
 
-				conn->unacked_len = 0;
+					conn->unacked_len = 0;
 
-				(void)tcp_send_data(conn);
+					(void)tcp_send_data(conn);
 
-				/* Restore the current transmission */
-				conn->unacked_len = temp_unacked_len;
+					/* Restore the current transmission */
+					conn->unacked_len = temp_unacked_len;
+				}
 
 				tcp_ca_fast_retransmit(conn);
 				if (tcp_window_full(conn)) {
@@ -3214,6 +3975,7 @@ next_state:
 
 			conn_seq(conn, + len_acked);
 			net_stats_update_tcp_seg_recv(conn->iface);
+			tcp_sack_acked(conn);
 
 			/* Receipt of an acknowledgment that covers a sequence number
 			 * not previously acknowledged indicates that the connection
@@ -4092,7 +4854,9 @@ int net_tcp_finalize(struct net_pkt *pkt, bool force_chksum)
 
 	tcp_hdr->chksum = 0U;
 
-	if (net_if_need_calc_tx_checksum(net_pkt_iface(pkt), type) || force_chksum) {
+	/* The checksums of a GSO packet are calculated per segment */
+	if ((net_if_need_calc_tx_checksum(net_pkt_iface(pkt), type) &&
+	     net_pkt_gso_size(pkt) == 0U) || force_chksum) {
 		tcp_hdr->chksum = net_calc_chksum_tcp(pkt);
 		net_pkt_set_chksum_done(pkt, true);
 	}
@@ -4107,7 +4871,9 @@ struct net_tcp_hdr *net_tcp_input(struct net_pkt *pkt,
 	enum net_if_checksum_type type = net_pkt_family(pkt) == AF_INET6 ?
 		NET_IF_CHECKSUM_IPV6_TCP : NET_IF_CHECKSUM_IPV4_TCP;
 
+	/* Packets coalesced by GRO had each segment verified already */
 	if (IS_ENABLED(CONFIG_NET_TCP_CHECKSUM) &&
+	    !net_pkt_is_rx_chksum_verified(pkt) &&
 	    (net_if_need_calc_rx_checksum(net_pkt_iface(pkt), type) ||
 	     net_pkt_is_ip_reassembled(pkt)) &&
 	    net_calc_chksum_tcp(pkt) != 0U) {
@@ -0,0 +1,378 @@
+/*
+ * Copyright (c) 2026 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/** @file
+ * @brief Generic receive offload for TCP
+ *
+ * Back-to-back in-order segments of one TCP connection are chained into a
+ * single packet before IP input, so that IP, TCP and the socket layer see
+ * one packet per batch. The state is kept per RX traffic class thread and
+ * a held packet is passed on when the RX queue of that thread runs empty.
+ */
+
+#include <zephyr/logging/log.h>
+LOG_MODULE_DECLARE(net_tcp, CONFIG_NET_TCP_LOG_LEVEL);
+
+#include <zephyr/kernel.h>
+#include <zephyr/sys/byteorder.h>
+#include <zephyr/net/net_core.h>
+#include <zephyr/net/net_if.h>
+#include <zephyr/net/net_ip.h>
+#include <zephyr/net/net_pkt.h>
+
+#include "net_private.h"
+#include "tcp_internal.h"
+#include "tcp_private.h"
+
+struct tcp_gro {
+	/** Packet being coalesced, NULL if nothing is held */
+	struct net_pkt *pkt;
+	/** Sequence number expected from the next segment */
+	uint32_t next_seq;
+	/** Payload length of the first segment */
+	uint16_t seg_len;
+	/** Length of the IP and TCP headers of the held packet */
+	uint16_t hdr_len;
+	/** Number of segments in the held packet */
+	uint8_t segs;
+};
+
+struct tcp_gro_seg {
+	uint8_t *ip;
+	struct tcphdr *th;
+	uint16_t ip_hdr_len;
+	uint16_t hdr_len;
+	uint16_t payload_len;
+	uint8_t family;
+};
+
+static struct tcp_gro gro_ctx[NET_TC_RX_QUEUE_COUNT];
+
+static struct tcp_gro *gro_get(void)
+{
+	int queue = net_tc_rx_current();
+
+	return queue < 0 ? NULL : &gro_ctx[queue];
+}
+
+/* Check that a packet is a plain in-sequence data segment for us, with the
+ * IP and TCP headers in the first fragment, and trim any link layer padding.
+ */
+static bool gro_parse(struct net_pkt *pkt, struct tcp_gro_seg *seg)
+{
+	struct net_buf *buf = pkt->buffer;
+	size_t ip_len;
+	uint8_t flags;
+
+	seg->ip = buf->data;
+
+	if (IS_ENABLED(CONFIG_NET_IPV4) && buf->len >= sizeof(struct net_ipv4_hdr) &&
+	    (seg->ip[0] & 0xf0) == 0x40) {
+		struct net_ipv4_hdr *hdr = (struct net_ipv4_hdr *)seg->ip;
+
+		/* No options and no fragments */
+		if (hdr->vhl != 0x45 || hdr->proto != IPPROTO_TCP ||
+		    (sys_get_be16(hdr->offset) &
+		     (NET_IPV4_MORE_FRAG_MASK | NET_IPV4_FRAGH_OFFSET_MASK)) != 0) {
+			return false;
+		}
+
+		if (!net_ipv4_is_my_addr((struct in_addr *)hdr->dst) ||
+		    net_ipv4_is_addr_bcast(net_pkt_iface(pkt),
+					   (struct in_addr *)hdr->dst)) {
+			return false;
+		}
+
+		seg->family = AF_INET;
+		seg->ip_hdr_len = sizeof(struct net_ipv4_hdr);
+		ip_len = ntohs(hdr->len);
+	} else if (IS_ENABLED(CONFIG_NET_IPV6) && buf->len >= sizeof(struct net_ipv6_hdr) &&
+		   (seg->ip[0] & 0xf0) == 0x60) {
+		struct net_ipv6_hdr *hdr = (struct net_ipv6_hdr *)seg->ip;
+
+		/* No extension headers */
+		if (hdr->nexthdr != IPPROTO_TCP) {
+			return false;
+		}
+
+		if (!net_ipv6_is_my_addr((struct in6_addr *)hdr->dst)) {
+			return false;
+		}
+
+		seg->family = AF_INET6;
+		seg->ip_hdr_len = sizeof(struct net_ipv6_hdr);
+		ip_len = sizeof(struct net_ipv6_hdr) + ntohs(hdr->len);
+	} else {
+		return false;
+	}
+
+	if (buf->len < seg->ip_hdr_len + sizeof(struct tcphdr) ||
+	    ip_len > net_pkt_get_len(pkt)) {
+		return false;
+	}
+
+	seg->th = (struct tcphdr *)(seg->ip + seg->ip_hdr_len);
+	seg->hdr_len = seg->ip_hdr_len + th_off(seg->th) * 4U;
+
+	if (th_off(seg->th) < 5 || buf->len < seg->hdr_len || ip_len <= seg->hdr_len) {
+		return false;
+	}
+
+	/* Only ACK, optionally with PSH, may be set */
+	flags = th_flags(seg->th);
+	if (!(flags & ACK) || (flags & ~(ACK | PSH)) != 0) {
+		return false;
+	}
+
+	seg->payload_len = ip_len - seg->hdr_len;
+
+	if (net_pkt_update_length(pkt, ip_len) < 0) {
+		return false;
+	}
+
+	net_pkt_set_family(pkt, seg->family);
+	net_pkt_set_ip_hdr_len(pkt, seg->ip_hdr_len);
+
+	if (seg->family == AF_INET) {
+		net_pkt_set_ipv4_opts_len(pkt, 0);
+
+		if (net_if_need_calc_rx_checksum(net_pkt_iface(pkt),
+						 NET_IF_CHECKSUM_IPV4_HEADER) &&
+		    net_calc_chksum_ipv4(pkt) != 0U) {
+			return false;
+		}
+	} else {
+		net_pkt_set_ipv6_ext_len(pkt, 0);
+	}
+
+	/* The TCP checksum is checked here, as it will not match the
+	 * coalesced packet any more.
+	 */
+	if (IS_ENABLED(CONFIG_NET_TCP_CHECKSUM) &&
+	    net_if_need_calc_rx_checksum(net_pkt_iface(pkt),
+					 seg->family == AF_INET6 ?
+					 NET_IF_CHECKSUM_IPV6_TCP :
+					 NET_IF_CHECKSUM_IPV4_TCP) &&
+	    net_calc_chksum_tcp(pkt) != 0U) {
+		return false;
+	}
+
+	return true;
+}
+
+/* Segments can be merged when they belong to the same connection and only
+ * the sequence number, length, checksum and PSH flag differ.
+ */
+static bool gro_same_flow(struct tcp_gro *gro, struct net_pkt *pkt,
+			  struct tcp_gro_seg *seg)
+{
+	uint8_t *held_ip = gro->pkt->buffer->data;
+	struct tcphdr *held_th = (struct tcphdr *)(held_ip + seg->ip_hdr_len);
+
+	if (net_pkt_iface(gro->pkt) != net_pkt_iface(pkt) ||
+	    net_pkt_family(gro->pkt) != seg->family) {
+		return false;
+	}
+
+	if (held_th->th_sport != seg->th->th_sport ||
+	    held_th->th_dport != seg->th->th_dport) {
+		return false;
+	}
+
+	if (seg->family == AF_INET) {
+		struct net_ipv4_hdr *a = (struct net_ipv4_hdr *)held_ip;
+		struct net_ipv4_hdr *b = (struct net_ipv4_hdr *)seg->ip;
+
+		return net_ipv4_addr_cmp_raw(a->src, b->src) &&
+			net_ipv4_addr_cmp_raw(a->dst, b->dst);
+	}
+
+	struct net_ipv6_hdr *a = (struct net_ipv6_hdr *)held_ip;
+	struct net_ipv6_hdr *b = (struct net_ipv6_hdr *)seg->ip;
+
+	return net_ipv6_addr_cmp_raw(a->src, b->src) &&
+		net_ipv6_addr_cmp_raw(a->dst, b->dst);
+}
+
+static bool gro_can_merge(struct tcp_gro *gro, struct tcp_gro_seg *seg)
+{
+	uint8_t *held_ip = gro->pkt->buffer->data;
+	struct tcphdr *held_th = (struct tcphdr *)(held_ip + seg->ip_hdr_len);
+	size_t ip_len = net_pkt_get_len(gro->pkt) + seg->payload_len;
+
+	if (th_seq(seg->th) != gro->next_seq ||
+	    gro->segs >= CONFIG_NET_TCP_GRO_MAX_SEGS ||
+	    seg->payload_len > gro->seg_len ||
+	    seg->hdr_len != gro->hdr_len) {
+		return false;
+	}
+
+	if (seg->family == AF_INET) {
+		struct net_ipv4_hdr *a = (struct net_ipv4_hdr *)held_ip;
+		struct net_ipv4_hdr *b = (struct net_ipv4_hdr *)seg->ip;
+
+		if (ip_len > UINT16_MAX || a->tos != b->tos || a->ttl != b->ttl) {
+			return false;
+		}
+	} else {
+		if (ip_len - sizeof(struct net_ipv6_hdr) > UINT16_MAX ||
+		    memcmp(held_ip, seg->ip, 4) != 0 ||
+		    ((struct net_ipv6_hdr *)held_ip)->hop_limit !=
+		    ((struct net_ipv6_hdr *)seg->ip)->hop_limit) {
+			return false;
+		}
+	}
+
+	/* Same ACK, window and options, so nothing but data is lost
+	 * by dropping the header.
+	 */
+	return held_th->th_ack == seg->th->th_ack &&
+		held_th->th_win == seg->th->th_win &&
+		memcmp((uint8_t *)held_th + sizeof(struct tcphdr),
+		       (uint8_t *)seg->th + sizeof(struct tcphdr),
+		       seg->hdr_len - seg->ip_hdr_len - sizeof(struct tcphdr)) == 0;
+}
+
+static void gro_deliver(struct net_pkt *pkt, uint8_t segs)
+{
+	enum net_verdict verdict;
+
+	if (segs > 1 && net_pkt_family(pkt) == AF_INET) {
+		struct net_ipv4_hdr *hdr = (struct net_ipv4_hdr *)pkt->buffer->data;
+
+		hdr->chksum = 0U;
+		hdr->chksum = net_calc_chksum_ipv4(pkt);
+	}
+
+	/* Checksums were verified segment by segment */
+	net_pkt_set_rx_chksum_verified(pkt, true);
+	net_pkt_cursor_init(pkt);
+
+	NET_DBG("pkt %p with %u segments len %zu", pkt, segs, net_pkt_get_len(pkt));
+
+	if (IS_ENABLED(CONFIG_NET_IPV6) && net_pkt_family(pkt) == AF_INET6) {
+		verdict = net_ipv6_input(pkt, false);
+	} else {
+		verdict = net_ipv4_input(pkt, false);
+	}
+
+	if (verdict != NET_OK) {
+		net_pkt_unref(pkt);
+	}
+}
+
+static void gro_flush(struct tcp_gro *gro)
+{
+	struct net_pkt *pkt = gro->pkt;
+
+	if (pkt == NULL) {
+		return;
+	}
+
+	gro->pkt = NULL;
+
+	gro_deliver(pkt, gro->segs);
+}
+
+static void gro_hold(struct tcp_gro *gro, struct net_pkt *pkt,
+		     struct tcp_gro_seg *seg)
+{
+	gro->pkt = pkt;
+	gro->next_seq = th_seq(seg->th) + seg->payload_len;
+	gro->seg_len = seg->payload_len;
+	gro->hdr_len = seg->hdr_len;
+	gro->segs = 1U;
+}
+
+static void gro_merge(struct tcp_gro *gro, struct net_pkt *pkt,
+		      struct tcp_gro_seg *seg)
+{
+	uint8_t *held_ip = gro->pkt->buffer->data;
+	struct tcphdr *held_th = (struct tcphdr *)(held_ip + seg->ip_hdr_len);
+	struct net_buf *frags;
+
+	if (th_flags(seg->th) & PSH) {
+		held_th->th_flags |= PSH;
+	}
+
+	/* Chain the payload of the new segment behind the held one */
+	net_buf_pull(pkt->buffer, seg->hdr_len);
+
+	frags = pkt->buffer;
+	pkt->buffer = NULL;
+	net_pkt_unref(pkt);
+
+	net_buf_frag_add(gro->pkt->buffer, frags);
+
+	if (seg->family == AF_INET) {
+		struct net_ipv4_hdr *hdr = (struct net_ipv4_hdr *)held_ip;
+
+		hdr->len = htons(ntohs(hdr->len) + seg->payload_len);
+	} else {
+		struct net_ipv6_hdr *hdr = (struct net_ipv6_hdr *)held_ip;
+
+		hdr->len = htons(ntohs(hdr->len) + seg->payload_len);
+	}
+
+	gro->next_seq += seg->payload_len;
+	gro->segs++;
+}
+
+enum net_verdict net_tcp_gro_receive(struct net_pkt *pkt)
+{
+	struct tcp_gro *gro = gro_get();
+	struct tcp_gro_seg seg;
+
+	if (gro == NULL || net_pkt_is_ip_reassembled(pkt)) {
+		return NET_CONTINUE;
+	}
+
+	if (!gro_parse(pkt, &seg)) {
+		/* Keep the order of segments within a connection, a packet
+		 * we cannot parse might belong to the held one.
+		 */
+		gro_flush(gro);
+		net_pkt_cursor_init(pkt);
+		return NET_CONTINUE;
+	}
+
+	if (gro->pkt != NULL && gro_same_flow(gro, pkt, &seg)) {
+		if (gro_can_merge(gro, &seg)) {
+			bool last = (th_flags(seg.th) & PSH) ||
+				seg.payload_len < gro->seg_len ||
+				gro->segs + 1 >= CONFIG_NET_TCP_GRO_MAX_SEGS;
+
+			gro_merge(gro, pkt, &seg);
+
+			if (last) {
+				gro_flush(gro);
+			}
+
+			return NET_OK;
+		}
+	}
+
+	gro_flush(gro);
+
+	/* Nothing will be merged behind a pushed segment */
+	if (th_flags(seg.th) & PSH) {
+		gro_deliver(pkt, 1U);
+		return NET_OK;
+	}
+
+	gro_hold(gro, pkt, &seg);
+
+	return NET_OK;
+}
+
+void net_tcp_gro_flush(void)
+{
+	struct tcp_gro *gro = gro_get();
+
+	if (gro != NULL) {
+		gro_flush(gro);
+	}
+}
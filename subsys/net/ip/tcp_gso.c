@@ -0,0 +1,184 @@
+/*
+ * Copyright (c) 2026 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/** @file
+ * @brief Generic segmentation offload for TCP
+ *
+ * TCP hands out new data in packets holding several segments worth of
+ * payload. Unless the device can segment them itself, such a packet is cut
+ * here into segments of net_pkt_gso_size() bytes, each with a copy of the
+ * IP and TCP headers, just before it is passed to the network interface.
+ */
+
+#include <zephyr/logging/log.h>
+LOG_MODULE_DECLARE(net_tcp, CONFIG_NET_TCP_LOG_LEVEL);
+
+#include <zephyr/kernel.h>
+#include <zephyr/sys/byteorder.h>
+#include <zephyr/net/net_core.h>
+#include <zephyr/net/net_if.h>
+#include <zephyr/net/net_ip.h>
+#include <zephyr/net/net_pkt.h>
+
+#include "net_private.h"
+#include "ipv4.h"
+#include "ipv6.h"
+#include "tcp_internal.h"
+#include "tcp_private.h"
+
+#define GSO_ALLOC_TIMEOUT K_MSEC(CONFIG_NET_TCP_PKT_ALLOC_TIMEOUT)
+
+static size_t gso_ip_hdr_len(struct net_pkt *pkt)
+{
+	if (IS_ENABLED(CONFIG_NET_IPV4) && net_pkt_family(pkt) == AF_INET) {
+		return net_pkt_ip_hdr_len(pkt) + net_pkt_ipv4_opts_len(pkt);
+	}
+
+	return net_pkt_ip_hdr_len(pkt) + net_pkt_ipv6_ext_len(pkt);
+}
+
+static void gso_copy_attributes(struct net_pkt *pkt, struct net_pkt *seg)
+{
+	net_pkt_set_family(seg, net_pkt_family(pkt));
+	net_pkt_set_context(seg, net_pkt_context(pkt));
+	net_pkt_set_ip_hdr_len(seg, net_pkt_ip_hdr_len(pkt));
+	net_pkt_set_ip_dscp(seg, net_pkt_ip_dscp(pkt));
+	net_pkt_set_ip_ecn(seg, net_pkt_ip_ecn(pkt));
+	net_pkt_set_vlan_tag(seg, net_pkt_vlan_tag(pkt));
+	net_pkt_set_priority(seg, net_pkt_priority(pkt));
+
+	if (IS_ENABLED(CONFIG_NET_IPV4) && net_pkt_family(pkt) == AF_INET) {
+		net_pkt_set_ipv4_ttl(seg, net_pkt_ipv4_ttl(pkt));
+		net_pkt_set_ipv4_opts_len(seg, net_pkt_ipv4_opts_len(pkt));
+	} else if (IS_ENABLED(CONFIG_NET_IPV6) &&
+		   net_pkt_family(pkt) == AF_INET6) {
+		net_pkt_set_ipv6_hop_limit(seg, net_pkt_ipv6_hop_limit(pkt));
+		net_pkt_set_ipv6_ext_len(seg, net_pkt_ipv6_ext_len(pkt));
+		net_pkt_set_ipv6_next_hdr(seg, net_pkt_ipv6_next_hdr(pkt));
+	}
+}
+
+/* Build the segment holding len bytes of payload found at offset, and
+ * calculate its lengths and checksums.
+ */
+static struct net_pkt *gso_segment(struct net_pkt *pkt, size_t ip_len,
+				   size_t hdr_len, size_t offset, size_t len,
+				   bool last)
+{
+	NET_PKT_DATA_ACCESS_DEFINE(tcp_access, struct net_tcp_hdr);
+	struct net_tcp_hdr *tcp_hdr;
+	struct net_pkt *seg;
+	int ret;
+
+	seg = net_pkt_alloc_with_buffer(net_pkt_iface(pkt), hdr_len + len,
+					AF_UNSPEC, 0, GSO_ALLOC_TIMEOUT);
+	if (!seg) {
+		return NULL;
+	}
+
+	gso_copy_attributes(pkt, seg);
+
+	net_pkt_cursor_init(pkt);
+
+	if (net_pkt_copy(seg, pkt, hdr_len) ||
+	    net_pkt_skip(pkt, offset) ||
+	    net_pkt_copy(seg, pkt, len)) {
+		goto fail;
+	}
+
+	net_pkt_cursor_init(seg);
+	net_pkt_set_overwrite(seg, true);
+
+	if (net_pkt_skip(seg, ip_len)) {
+		goto fail;
+	}
+
+	tcp_hdr = (struct net_tcp_hdr *)net_pkt_get_data(seg, &tcp_access);
+	if (!tcp_hdr) {
+		goto fail;
+	}
+
+	sys_put_be32(sys_get_be32(tcp_hdr->seq) + offset, tcp_hdr->seq);
+
+	/* Only the last segment completes what the application pushed */
+	if (!last) {
+		tcp_hdr->flags &= ~(PSH | FIN);
+	}
+
+	net_pkt_set_data(seg, &tcp_access);
+	net_pkt_cursor_init(seg);
+
+	if (IS_ENABLED(CONFIG_NET_IPV4) && net_pkt_family(seg) == AF_INET) {
+		ret = net_ipv4_finalize(seg, IPPROTO_TCP);
+	} else {
+		ret = net_ipv6_finalize(seg, IPPROTO_TCP);
+	}
+
+	if (ret < 0) {
+		goto fail;
+	}
+
+	return seg;
+
+fail:
+	net_pkt_unref(seg);
+
+	return NULL;
+}
+
+int net_tcp_gso_segment(struct net_pkt *pkt, int (*send)(struct net_pkt *pkt))
+{
+	NET_PKT_DATA_ACCESS_DEFINE(tcp_access, struct net_tcp_hdr);
+	uint16_t gso_size = net_pkt_gso_size(pkt);
+	size_t ip_len = gso_ip_hdr_len(pkt);
+	struct net_tcp_hdr *tcp_hdr;
+	size_t payload_len;
+	size_t hdr_len;
+	size_t offset;
+	int ret;
+
+	if (gso_size == 0U) {
+		return -EINVAL;
+	}
+
+	net_pkt_cursor_init(pkt);
+
+	if (net_pkt_skip(pkt, ip_len)) {
+		return -EINVAL;
+	}
+
+	tcp_hdr = (struct net_tcp_hdr *)net_pkt_get_data(pkt, &tcp_access);
+	if (!tcp_hdr) {
+		return -ENOBUFS;
+	}
+
+	hdr_len = ip_len + (tcp_hdr->offset >> 4) * 4U;
+	if (net_pkt_get_len(pkt) < hdr_len) {
+		return -EINVAL;
+	}
+
+	payload_len = net_pkt_get_len(pkt) - hdr_len;
+
+	for (offset = 0; offset < payload_len; offset += gso_size) {
+		size_t len = MIN(gso_size, payload_len - offset);
+		struct net_pkt *seg;
+
+		seg = gso_segment(pkt, ip_len, hdr_len, offset, len,
+				  offset + len == payload_len);
+		if (!seg) {
+			NET_DBG("pkt %p cannot build segment at %zu", pkt, offset);
+			return -ENOBUFS;
+		}
+
+		ret = send(seg);
+		if (ret < 0) {
+			net_pkt_unref(seg);
+			return ret;
+		}
+	}
+
+	return 0;
+}
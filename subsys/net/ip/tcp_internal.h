@@ -448,6 +448,66 @@ static inline void net_tcp_reply_rst(struct net_pkt *pkt)
 }
 #endif
 
+/**
+ * @brief Pass a received packet to TCP generic receive offload.
+ *
+ * Called from the RX traffic class thread after L2 processing. Segments
+ * that can be coalesced are held and later passed to IP input as one packet.
+ *
+ * @param pkt Received packet, starting with the IP header.
+ *
+ * @return NET_OK if the packet was consumed, NET_CONTINUE if it should be
+ *         processed as usual.
+ */
+#if defined(CONFIG_NET_TCP_GRO)
+enum net_verdict net_tcp_gro_receive(struct net_pkt *pkt);
+#else
+static inline enum net_verdict net_tcp_gro_receive(struct net_pkt *pkt)
+{
+	ARG_UNUSED(pkt);
+
+	return NET_CONTINUE;
+}
+#endif
+
+/**
+ * @brief Pass on the packet held by TCP generic receive offload, if any.
+ *
+ * Called by the RX traffic class thread when its queue runs empty.
+ */
+#if defined(CONFIG_NET_TCP_GRO)
+void net_tcp_gro_flush(void);
+#else
+static inline void net_tcp_gro_flush(void)
+{
+}
+#endif
+
+/**
+ * @brief Cut a TCP GSO packet into segments and send them.
+ *
+ * Each segment carries net_pkt_gso_size() bytes of the payload, the last
+ * one possibly less, and has its lengths and checksums calculated. The
+ * original packet is not consumed.
+ *
+ * @param pkt Packet with a non-zero GSO size
+ * @param send Function that consumes a segment when it returns 0
+ *
+ * @return 0 if all the segments were sent, <0 otherwise.
+ */
+#if defined(CONFIG_NET_TCP_GSO)
+int net_tcp_gso_segment(struct net_pkt *pkt, int (*send)(struct net_pkt *pkt));
+#else
+static inline int net_tcp_gso_segment(struct net_pkt *pkt,
+				      int (*send)(struct net_pkt *pkt))
+{
+	ARG_UNUSED(pkt);
+	ARG_UNUSED(send);
+
+	return -ENOTSUP;
+}
+#endif
+
 /**
  * @brief Get the TCP connection endpoint information.
  *
@@ -146,7 +146,7 @@
 #define conn_send_data_dump(_conn)                                             \
 	({                                                                     \
 		NET_DBG("conn: %p total=%zd, unacked_len=%d, "                 \
-			"send_win=%hu, mss=%hu",                               \
+			"send_win=%u, mss=%hu",                                \
 			(_conn), net_pkt_get_len((_conn)->send_data),          \
 			_conn->unacked_len, _conn->send_win,                   \
 			(uint16_t)conn_mss((_conn)));                          \
@@ -227,26 +227,46 @@ union tcp_endpoint {
 #define NET_TCP_NOP_OPT          1
 #define NET_TCP_MSS_OPT          2
 #define NET_TCP_WINDOW_SCALE_OPT 3
+#define NET_TCP_SACK_PERM_OPT    4
+#define NET_TCP_SACK_OPT         5
 
 /* TCP Option sizes */
 #define NET_TCP_END_SIZE          1
 #define NET_TCP_NOP_SIZE          1
 #define NET_TCP_MSS_SIZE          4
 #define NET_TCP_WINDOW_SCALE_SIZE 3
+#define NET_TCP_SACK_PERM_SIZE    2
+#define NET_TCP_SACK_BLOCK_SIZE   8
+
+/* Largest window shift count allowed by RFC 7323 */
+#define NET_TCP_MAX_WINDOW_SCALE 14
+
+/* SACK blocks that fit in 40 bytes of options together with two NOPs */
+#define NET_TCP_SACK_MAX_BLOCKS 4
+
+struct tcp_sack_block {
+	uint32_t start; /* First sequence number of the block */
+	uint32_t end;   /* Sequence number following the block */
+};
 
 struct tcp_options {
+#ifdef CONFIG_NET_TCP_SACK
+	struct tcp_sack_block sack[NET_TCP_SACK_MAX_BLOCKS];
+	uint8_t sack_cnt;
+#endif /* CONFIG_NET_TCP_SACK */
 	uint16_t mss;
-	uint16_t window;
+	uint16_t window; /* Window scale shift count */
 	bool mss_found : 1;
 	bool wnd_found : 1;
+	bool sack_perm_found : 1;
 };
 
 #ifdef CONFIG_NET_TCP_CONGESTION_AVOIDANCE
 
 struct tcp_collision_avoidance_reno {
-	uint16_t cwnd;
-	uint16_t ssthresh;
-	uint16_t pending_fast_retransmit_bytes;
+	uint32_t cwnd;
+	uint32_t ssthresh;
+	uint32_t pending_fast_retransmit_bytes;
 };
 #endif
 
@@ -314,11 +334,22 @@ struct tcp { /* TCP connection */
 	uint32_t keep_cnt;
 	uint32_t keep_cur;
 #endif /* CONFIG_NET_TCP_KEEPALIVE */
-	uint16_t recv_win_sent;
-	uint16_t recv_win_max;
-	uint16_t recv_win;
-	uint16_t send_win_max;
-	uint16_t send_win;
+	uint32_t recv_win_sent;
+	uint32_t recv_win_max;
+	uint32_t recv_win;
+	uint32_t send_win_max;
+	uint32_t send_win;
+#ifdef CONFIG_NET_TCP_WINDOW_SCALE
+	uint8_t recv_wscale; /* Shift applied to the window we advertise */
+	uint8_t send_wscale; /* Shift applied to the peer's advertised window */
+#endif /* CONFIG_NET_TCP_WINDOW_SCALE */
+#ifdef CONFIG_NET_TCP_SACK
+	/* Ranges above conn->seq that the peer has SACKed, in order */
+	struct tcp_sack_block sack_board[NET_TCP_SACK_MAX_BLOCKS];
+	uint32_t sack_recovery_point; /* Recovery ends when this is acked */
+	uint32_t sack_rexmit_next; /* Holes below this were resent */
+	uint8_t sack_board_cnt;
+#endif /* CONFIG_NET_TCP_SACK */
 #ifdef CONFIG_NET_TCP_RANDOMIZED_RTO
 	uint16_t rto;
 #endif
@@ -338,6 +369,10 @@ struct tcp { /* TCP connection */
 #endif /* CONFIG_NET_TCP_KEEPALIVE */
 	bool tcp_nodelay : 1;
 	bool addr_ref_done : 1;
+#ifdef CONFIG_NET_TCP_SACK
+	bool sack_permitted : 1;
+	bool sack_recovery : 1;
+#endif /* CONFIG_NET_TCP_SACK */
 };
 
 #define _flags(_fl, _op, _mask, _cond)					\
@@ -556,6 +556,14 @@ static void net_shell_print_statistics(struct net_if *iface, void *user_data)
 	   GET_STAT(iface, dns.sent),
 	   GET_STAT(iface, dns.drop));
 #endif /* CONFIG_NET_STATISTICS_DNS */
+#if defined(CONFIG_NET_STATISTICS_RX_STEERING)
+	for (int i = 0; i < CONFIG_NET_TC_RX_STEERING_QUEUES; i++) {
+		PR("RX queue [%d]   %d\n", i,
+		   GET_STAT(iface, rx_steering.queued[i]));
+	}
+
+	PR("RX unhashed    %d\n", GET_STAT(iface, rx_steering.unhashed));
+#endif /* CONFIG_NET_STATISTICS_RX_STEERING */
 
 	PR("Bytes received %u\n", GET_STAT(iface, bytes.received));
 	PR("Bytes sent     %u\n", GET_STAT(iface, bytes.sent));
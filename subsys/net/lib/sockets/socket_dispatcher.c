@@ -299,6 +299,58 @@ static ssize_t sock_dispatch_recvfrom_vmeth(void *obj, void *buf,
 	return zsock_recvfrom(fd, buf, max_len, flags, addr, addrlen);
 }
 
+static int sock_dispatch_sendmmsg_vmeth(void *obj, struct mmsghdr *msgvec,
+					unsigned int vlen, int flags)
+{
+	int fd = sock_dispatch_default(obj);
+
+	if (fd < 0) {
+		return -1;
+	}
+
+	return zsock_sendmmsg(fd, msgvec, vlen, flags);
+}
+
+static int sock_dispatch_recvmmsg_vmeth(void *obj, struct mmsghdr *msgvec,
+					unsigned int vlen, int flags,
+					struct timespec *timeout)
+{
+	int fd = sock_dispatch_default(obj);
+
+	if (fd < 0) {
+		return -1;
+	}
+
+	return zsock_recvmmsg(fd, msgvec, vlen, flags, timeout);
+}
+
+#if defined(CONFIG_NET_SOCKETS_RX_LOAN)
+static ssize_t sock_dispatch_recv_loan_vmeth(void *obj, struct msghdr *msg,
+					     int flags,
+					     struct zsock_rx_loan *loan)
+{
+	int fd = sock_dispatch_default(obj);
+
+	if (fd < 0) {
+		return -1;
+	}
+
+	return zsock_recv_loan(fd, msg, flags, loan);
+}
+
+static int sock_dispatch_recv_loan_release_vmeth(void *obj,
+						 struct zsock_rx_loan *loan)
+{
+	int fd = sock_dispatch_default(obj);
+
+	if (fd < 0) {
+		return -1;
+	}
+
+	return zsock_recv_loan_release(fd, loan);
+}
+#endif /* CONFIG_NET_SOCKETS_RX_LOAN */
+
 static int sock_dispatch_getsockopt_vmeth(void *obj, int level, int optname,
 					  void *optval, socklen_t *optlen)
 {
@@ -443,6 +495,12 @@ static const struct socket_op_vtable sock_dispatch_fd_op_vtable = {
 	.setsockopt = sock_dispatch_setsockopt_vmeth,
 	.getpeername = sock_dispatch_getpeername_vmeth,
 	.getsockname = sock_dispatch_getsockname_vmeth,
+	.sendmmsg = sock_dispatch_sendmmsg_vmeth,
+	.recvmmsg = sock_dispatch_recvmmsg_vmeth,
+#if defined(CONFIG_NET_SOCKETS_RX_LOAN)
+	.recv_loan = sock_dispatch_recv_loan_vmeth,
+	.recv_loan_release = sock_dispatch_recv_loan_release_vmeth,
+#endif
 };
 
 static int sock_dispatch_create(int family, int type, int proto)
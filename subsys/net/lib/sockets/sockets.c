@@ -13,6 +13,7 @@ LOG_MODULE_REGISTER(net_sock, CONFIG_NET_SOCKETS_LOG_LEVEL);
 #include <zephyr/kernel.h>
 #include <zephyr/tracing/tracing.h>
 #include <zephyr/net/socket.h>
+#include <zephyr/net/net_pkt.h>
 #include <zephyr/internal/syscall_handler.h>
 
 #include "sockets_internal.h"
@@ -87,6 +88,82 @@ size_t msghdr_non_empty_iov_count(const struct msghdr *msg)
 	return non_empty_iov_count;
 }
 
+int zsock_sendmmsg_loop(void *obj,
+			ssize_t (*sendmsg)(void *obj, const struct msghdr *msg,
+					   int flags),
+			struct mmsghdr *msgvec, unsigned int vlen, int flags)
+{
+	unsigned int i;
+	ssize_t ret;
+
+	for (i = 0; i < vlen; i++) {
+		ret = sendmsg(obj, &msgvec[i].msg_hdr, flags);
+		if (ret < 0) {
+			/* Report the error only if nothing could be sent */
+			if (i == 0) {
+				return -1;
+			}
+
+			break;
+		}
+
+		msgvec[i].msg_len = ret;
+	}
+
+	return i;
+}
+
+int zsock_recvmmsg_loop(void *obj,
+			ssize_t (*recvmsg)(void *obj, struct msghdr *msg,
+					   int flags),
+			struct mmsghdr *msgvec, unsigned int vlen, int flags,
+			const struct timespec *timeout)
+{
+	k_timepoint_t end = sys_timepoint_calc(K_FOREVER);
+	unsigned int i;
+	ssize_t ret;
+
+	if (timeout != NULL) {
+		if (timeout->tv_sec < 0 || timeout->tv_nsec < 0 ||
+		    timeout->tv_nsec >= NSEC_PER_SEC) {
+			errno = EINVAL;
+			return -1;
+		}
+
+		end = sys_timepoint_calc(K_USEC((int64_t)timeout->tv_sec * USEC_PER_SEC +
+						timeout->tv_nsec / NSEC_PER_USEC));
+	}
+
+	for (i = 0; i < vlen; i++) {
+		ret = recvmsg(obj, &msgvec[i].msg_hdr,
+			      flags & ~ZSOCK_MSG_WAITFORONE);
+		if (ret < 0) {
+			/* Report the error only if nothing was received, the
+			 * caller picks it up on the next call otherwise.
+			 */
+			if (i == 0) {
+				return -1;
+			}
+
+			break;
+		}
+
+		msgvec[i].msg_len = ret;
+
+		if (flags & ZSOCK_MSG_WAITFORONE) {
+			flags |= ZSOCK_MSG_DONTWAIT;
+		}
+
+		/* Like on Linux, the timeout is only checked between messages */
+		if (sys_timepoint_expired(end)) {
+			i++;
+			break;
+		}
+	}
+
+	return i;
+}
+
 void *z_impl_zsock_get_context_object(int sock)
 {
 	const struct socket_op_vtable *ignored;
@@ -474,6 +551,62 @@ fail:
 #include <zephyr/syscalls/zsock_sendmsg_mrsh.c>
 #endif /* CONFIG_USERSPACE */
 
+static ssize_t sock_sendmsg_fd(void *obj, const struct msghdr *msg, int flags)
+{
+	return z_impl_zsock_sendmsg(POINTER_TO_INT(obj), msg, flags);
+}
+
+int z_impl_zsock_sendmmsg(int sock, struct mmsghdr *msgvec, unsigned int vlen,
+			  int flags)
+{
+	const struct socket_op_vtable *vtable;
+	struct k_mutex *lock;
+	void *obj;
+	int ret;
+
+	obj = get_sock_vtable(sock, &vtable, &lock);
+	if (obj == NULL) {
+		errno = EBADF;
+		return -1;
+	}
+
+	if (vtable->sendmmsg == NULL) {
+		return zsock_sendmmsg_loop(INT_TO_POINTER(sock), sock_sendmsg_fd,
+					   msgvec, vlen, flags);
+	}
+
+	(void)k_mutex_lock(lock, K_FOREVER);
+
+	ret = vtable->sendmmsg(obj, msgvec, vlen, flags);
+
+	k_mutex_unlock(lock);
+
+	for (int i = 0; i < ret; i++) {
+		sock_obj_core_update_send_stats(sock, msgvec[i].msg_len);
+	}
+
+	return ret;
+}
+
+#ifdef CONFIG_USERSPACE
+static ssize_t sock_vrfy_sendmsg_fd(void *obj, const struct msghdr *msg,
+				    int flags)
+{
+	return z_vrfy_zsock_sendmsg(POINTER_TO_INT(obj), msg, flags);
+}
+
+static inline int z_vrfy_zsock_sendmmsg(int sock, struct mmsghdr *msgvec,
+					unsigned int vlen, int flags)
+{
+	K_OOPS(K_SYSCALL_MEMORY_ARRAY_WRITE(msgvec, vlen, sizeof(*msgvec)));
+
+	/* Each message needs its own copy, so send them one by one */
+	return zsock_sendmmsg_loop(INT_TO_POINTER(sock), sock_vrfy_sendmsg_fd,
+				   msgvec, vlen, flags);
+}
+#include <zephyr/syscalls/zsock_sendmmsg_mrsh.c>
+#endif /* CONFIG_USERSPACE */
+
 ssize_t z_impl_zsock_recvfrom(int sock, void *buf, size_t max_len, int flags,
 			     struct sockaddr *src_addr, socklen_t *addrlen)
 {
@@ -710,6 +843,112 @@ fail:
 #include <zephyr/syscalls/zsock_recvmsg_mrsh.c>
 #endif /* CONFIG_USERSPACE */
 
+static ssize_t sock_recvmsg_fd(void *obj, struct msghdr *msg, int flags)
+{
+	return z_impl_zsock_recvmsg(POINTER_TO_INT(obj), msg, flags);
+}
+
+int z_impl_zsock_recvmmsg(int sock, struct mmsghdr *msgvec, unsigned int vlen,
+			  int flags, struct timespec *timeout)
+{
+	const struct socket_op_vtable *vtable;
+	struct k_mutex *lock;
+	void *obj;
+	int ret;
+
+	obj = get_sock_vtable(sock, &vtable, &lock);
+	if (obj == NULL) {
+		errno = EBADF;
+		return -1;
+	}
+
+	if (vtable->recvmmsg == NULL) {
+		return zsock_recvmmsg_loop(INT_TO_POINTER(sock), sock_recvmsg_fd,
+					   msgvec, vlen, flags, timeout);
+	}
+
+	(void)k_mutex_lock(lock, K_FOREVER);
+
+	ret = vtable->recvmmsg(obj, msgvec, vlen, flags, timeout);
+
+	k_mutex_unlock(lock);
+
+	for (int i = 0; i < ret; i++) {
+		sock_obj_core_update_recv_stats(sock, msgvec[i].msg_len);
+	}
+
+	return ret;
+}
+
+#ifdef CONFIG_USERSPACE
+static ssize_t sock_vrfy_recvmsg_fd(void *obj, struct msghdr *msg, int flags)
+{
+	return z_vrfy_zsock_recvmsg(POINTER_TO_INT(obj), msg, flags);
+}
+
+static inline int z_vrfy_zsock_recvmmsg(int sock, struct mmsghdr *msgvec,
+					unsigned int vlen, int flags,
+					struct timespec *timeout)
+{
+	struct timespec timeout_copy;
+
+	K_OOPS(K_SYSCALL_MEMORY_ARRAY_WRITE(msgvec, vlen, sizeof(*msgvec)));
+
+	if (timeout != NULL) {
+		K_OOPS(k_usermode_from_copy(&timeout_copy, timeout,
+					    sizeof(timeout_copy)));
+	}
+
+	/* Each message needs its own copy, so receive them one by one */
+	return zsock_recvmmsg_loop(INT_TO_POINTER(sock), sock_vrfy_recvmsg_fd,
+				   msgvec, vlen, flags,
+				   timeout != NULL ? &timeout_copy : NULL);
+}
+#include <zephyr/syscalls/zsock_recvmmsg_mrsh.c>
+#endif /* CONFIG_USERSPACE */
+
+#if defined(CONFIG_NET_SOCKETS_RX_LOAN)
+ssize_t zsock_recv_loan(int sock, struct msghdr *msg, int flags,
+			struct zsock_rx_loan *loan)
+{
+	int bytes_received;
+
+	bytes_received = VTABLE_CALL(recv_loan, sock, msg, flags, loan);
+
+	sock_obj_core_update_recv_stats(sock, bytes_received);
+
+	return bytes_received;
+}
+
+int zsock_recv_loan_release(int sock, struct zsock_rx_loan *loan)
+{
+	const struct socket_op_vtable *vtable;
+	struct k_mutex *lock;
+	void *obj;
+	int ret;
+
+	obj = get_sock_vtable(sock, &vtable, &lock);
+	if (obj == NULL || vtable->recv_loan_release == NULL) {
+		/* Still give the buffers back to the RX pool */
+		if (loan != NULL && loan->pkt != NULL) {
+			net_pkt_unref(loan->pkt);
+			loan->pkt = NULL;
+		}
+
+		errno = EBADF;
+		return -1;
+	}
+
+	(void)k_mutex_lock(lock, K_FOREVER);
+
+	ret = vtable->recv_loan_release(obj, loan);
+
+	k_mutex_unlock(lock);
+
+	return ret;
+}
+#endif /* CONFIG_NET_SOCKETS_RX_LOAN */
+
 /* As this is limited function, we don't follow POSIX signature, with
  * "..." instead of last arg.
  */
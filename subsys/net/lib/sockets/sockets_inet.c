@@ -1047,6 +1047,44 @@ static int update_msg_controllen(struct msghdr *msg)
 	return 0;
 }
 
+static int sock_get_dgram_src_addr(struct net_context *ctx,
+				   struct net_pkt *pkt,
+				   struct sockaddr *src_addr,
+				   socklen_t *addrlen)
+{
+	int ret;
+
+	if (IS_ENABLED(CONFIG_NET_OFFLOAD) &&
+	    net_if_is_ip_offloaded(net_context_get_iface(ctx))) {
+		ret = sock_get_offload_pkt_src_addr(pkt, ctx, src_addr,
+						     *addrlen);
+		if (ret < 0) {
+			NET_DBG("sock_get_offload_pkt_src_addr %d", ret);
+			return ret;
+		}
+	} else {
+		ret = sock_get_pkt_src_addr(pkt, net_context_get_proto(ctx),
+					    src_addr, *addrlen);
+		if (ret < 0) {
+			NET_DBG("sock_get_pkt_src_addr %d", ret);
+			return ret;
+		}
+	}
+
+	/* addrlen is a value-result argument, set to actual
+	 * size of source address
+	 */
+	if (src_addr->sa_family == AF_INET) {
+		*addrlen = sizeof(struct sockaddr_in);
+	} else if (src_addr->sa_family == AF_INET6) {
+		*addrlen = sizeof(struct sockaddr_in6);
+	} else {
+		return -ENOTSUP;
+	}
+
+	return 0;
+}
+
 static inline ssize_t zsock_recv_dgram(struct net_context *ctx,
 				       struct msghdr *msg,
 				       void *buf,
@@ -1098,38 +1136,11 @@ static inline ssize_t zsock_recv_dgram(struct net_context *ctx,
 	net_pkt_cursor_backup(pkt, &backup);
 
 	if (src_addr && addrlen) {
-		if (IS_ENABLED(CONFIG_NET_OFFLOAD) &&
-		    net_if_is_ip_offloaded(net_context_get_iface(ctx))) {
-			int ret;
-
-			ret  = sock_get_offload_pkt_src_addr(pkt, ctx, src_addr,
-								*addrlen);
-			if (ret < 0) {
-				errno = -ret;
-				NET_DBG("sock_get_offload_pkt_src_addr %d", ret);
-				goto fail;
-			}
-		} else {
-			int ret;
-
-			ret = sock_get_pkt_src_addr(pkt, net_context_get_proto(ctx),
-						   src_addr, *addrlen);
-			if (ret < 0) {
-				errno = -ret;
-				NET_DBG("sock_get_pkt_src_addr %d", ret);
-				goto fail;
-			}
-		}
+		int ret;
 
-		/* addrlen is a value-result argument, set to actual
-		 * size of source address
-		 */
-		if (src_addr->sa_family == AF_INET) {
-			*addrlen = sizeof(struct sockaddr_in);
-		} else if (src_addr->sa_family == AF_INET6) {
-			*addrlen = sizeof(struct sockaddr_in6);
-		} else {
-			errno = ENOTSUP;
+		ret = sock_get_dgram_src_addr(ctx, pkt, src_addr, addrlen);
+		if (ret < 0) {
+			errno = -ret;
 			goto fail;
 		}
 	}
@@ -1509,6 +1520,242 @@ ssize_t zsock_recvmsg_ctx(struct net_context *ctx, struct msghdr *msg,
 	return -1;
 }
 
+#if defined(CONFIG_NET_SOCKETS_RX_LOAN)
+/* Point the iovecs of msg at up to len bytes of pkt, starting at its cursor */
+static size_t sock_loan_fill_iov(struct net_pkt *pkt, struct msghdr *msg,
+				 size_t len)
+{
+	struct net_buf *frag = pkt->cursor.buf;
+	uint8_t *pos = pkt->cursor.pos;
+	size_t loaned = 0;
+	size_t iovec = 0;
+
+	while (frag != NULL && len > 0 && iovec < msg->msg_iovlen) {
+		size_t frag_len = MIN(frag->len - (pos - frag->data), len);
+
+		if (frag_len > 0) {
+			msg->msg_iov[iovec].iov_base = pos;
+			msg->msg_iov[iovec].iov_len = frag_len;
+			iovec++;
+
+			loaned += frag_len;
+			len -= frag_len;
+		}
+
+		frag = frag->frags;
+		if (frag != NULL) {
+			pos = frag->data;
+		}
+	}
+
+	msg->msg_iovlen = iovec;
+
+	return loaned;
+}
+
+static ssize_t zsock_recv_dgram_loan(struct net_context *ctx,
+				     struct msghdr *msg, int flags,
+				     struct zsock_rx_loan *loan)
+{
+	k_timeout_t timeout = K_FOREVER;
+	struct net_pkt *pkt;
+	size_t recv_len;
+	size_t loaned;
+	int ret;
+
+	if ((flags & ZSOCK_MSG_DONTWAIT) || sock_is_nonblock(ctx)) {
+		timeout = K_NO_WAIT;
+	} else {
+		net_context_get_option(ctx, NET_OPT_RCVTIMEO, &timeout, NULL);
+
+		ret = zsock_wait_data(ctx, &timeout);
+		if (ret < 0) {
+			errno = -ret;
+			return -1;
+		}
+	}
+
+	pkt = k_fifo_get(&ctx->recv_q, timeout);
+	if (!pkt) {
+		errno = EAGAIN;
+		return -1;
+	}
+
+	if (msg->msg_name != NULL) {
+		ret = sock_get_dgram_src_addr(ctx, pkt, msg->msg_name,
+					      &msg->msg_namelen);
+		if (ret < 0) {
+			net_pkt_unref(pkt);
+			errno = -ret;
+			return -1;
+		}
+	}
+
+	recv_len = net_pkt_remaining_data(pkt);
+	loaned = sock_loan_fill_iov(pkt, msg, recv_len);
+	if (loaned != recv_len) {
+		msg->msg_flags |= ZSOCK_MSG_TRUNC;
+	}
+
+	msg->msg_controllen = 0U;
+
+	if (IS_ENABLED(CONFIG_NET_PKT_RXTIME_STATS) ||
+	    IS_ENABLED(CONFIG_TRACING_NET_CORE)) {
+		net_socket_update_tc_rx_time(pkt, k_cycle_get_32());
+	}
+
+	/* The whole datagram goes with the loan, no window to reopen */
+	loan->pkt = pkt;
+	loan->wnd_len = 0;
+
+	return loaned;
+}
+
+static ssize_t zsock_recv_stream_loan(struct net_context *ctx,
+				      struct msghdr *msg, int flags,
+				      struct zsock_rx_loan *loan)
+{
+	k_timeout_t timeout = K_FOREVER;
+	struct net_pkt *pkt;
+	k_timepoint_t end;
+	size_t pkt_len;
+	size_t loaned;
+	int res;
+
+	if (!net_context_is_used(ctx)) {
+		errno = EBADF;
+		return -1;
+	}
+
+	if (net_context_get_state(ctx) != NET_CONTEXT_CONNECTED) {
+		errno = ENOTCONN;
+		return -1;
+	}
+
+	if ((flags & ZSOCK_MSG_DONTWAIT) || sock_is_nonblock(ctx)) {
+		timeout = K_NO_WAIT;
+	} else if (!sock_is_eof(ctx) && !sock_is_error(ctx)) {
+		net_context_get_option(ctx, NET_OPT_RCVTIMEO, &timeout, NULL);
+	}
+
+	for (end = sys_timepoint_calc(timeout); ; timeout = sys_timepoint_timeout(end)) {
+		if (sock_is_error(ctx)) {
+			errno = POINTER_TO_INT(ctx->user_data);
+			return -1;
+		}
+
+		if (sock_is_eof(ctx)) {
+			return 0;
+		}
+
+		if (!K_TIMEOUT_EQ(timeout, K_NO_WAIT)) {
+			res = zsock_wait_data(ctx, &timeout);
+			if (res < 0) {
+				errno = -res;
+				return -1;
+			}
+		}
+
+		pkt = k_fifo_peek_head(&ctx->recv_q);
+		if (pkt == NULL) {
+			if (K_TIMEOUT_EQ(timeout, K_NO_WAIT)) {
+				errno = EAGAIN;
+				return -1;
+			}
+
+			continue;
+		}
+
+		pkt_len = net_pkt_remaining_data(pkt);
+		if (pkt_len > 0) {
+			break;
+		}
+
+		/* Nothing to loan, e.g. the packet that carried FIN */
+		pkt = k_fifo_get(&ctx->recv_q, K_NO_WAIT);
+		if (net_pkt_eof(pkt)) {
+			sock_set_eof(ctx);
+		}
+
+		net_pkt_unref(pkt);
+	}
+
+	loaned = sock_loan_fill_iov(pkt, msg, pkt_len);
+	if (loaned == pkt_len) {
+		/* Hand the queue's reference over to the loan */
+		pkt = k_fifo_get(&ctx->recv_q, K_NO_WAIT);
+		if (net_pkt_eof(pkt)) {
+			sock_set_eof(ctx);
+		}
+
+		if (IS_ENABLED(CONFIG_NET_PKT_RXTIME_STATS) ||
+		    IS_ENABLED(CONFIG_TRACING_NET_CORE)) {
+			net_socket_update_tc_rx_time(pkt, k_cycle_get_32());
+		}
+	} else {
+		/* The rest of the packet stays queued for the next call */
+		net_pkt_ref(pkt);
+		(void)net_pkt_skip(pkt, loaned);
+	}
+
+	msg->msg_controllen = 0U;
+
+	/* The receive window is reopened once the buffers are given back */
+	loan->pkt = pkt;
+	loan->wnd_len = loaned;
+
+	return loaned;
+}
+
+ssize_t zsock_recv_loan_ctx(struct net_context *ctx, struct msghdr *msg,
+			    int flags, struct zsock_rx_loan *loan)
+{
+	enum net_sock_type sock_type = net_context_get_type(ctx);
+
+	if (msg == NULL || loan == NULL || (flags & ZSOCK_MSG_PEEK)) {
+		errno = EINVAL;
+		return -1;
+	}
+
+	if (msg->msg_iov == NULL || msg->msg_iovlen < 1) {
+		errno = ENOMEM;
+		return -1;
+	}
+
+	if (sock_type == SOCK_DGRAM) {
+		return zsock_recv_dgram_loan(ctx, msg, flags, loan);
+	} else if (sock_type == SOCK_STREAM) {
+		return zsock_recv_stream_loan(ctx, msg, flags, loan);
+	}
+
+	__ASSERT(0, "Unknown socket type");
+
+	errno = ENOTSUP;
+
+	return -1;
+}
+
+int zsock_recv_loan_release_ctx(struct net_context *ctx,
+				struct zsock_rx_loan *loan)
+{
+	if (loan == NULL || loan->pkt == NULL) {
+		errno = EINVAL;
+		return -1;
+	}
+
+	net_pkt_unref(loan->pkt);
+
+	if (loan->wnd_len > 0) {
+		net_context_update_recv_wnd(ctx, loan->wnd_len);
+	}
+
+	loan->pkt = NULL;
+	loan->wnd_len = 0;
+
+	return 0;
+}
+#endif /* CONFIG_NET_SOCKETS_RX_LOAN */
+
 static int zsock_poll_prepare_ctx(struct net_context *ctx,
 				  struct zsock_pollfd *pfd,
 				  struct k_poll_event **pev,
@@ -2982,6 +3229,33 @@ static ssize_t sock_recvfrom_vmeth(void *obj, void *buf, size_t max_len,
 				  src_addr, addrlen);
 }
 
+#if defined(CONFIG_NET_SOCKETS_RX_LOAN)
+static ssize_t sock_recv_loan_vmeth(void *obj, struct msghdr *msg, int flags,
+				    struct zsock_rx_loan *loan)
+{
+	return zsock_recv_loan_ctx(obj, msg, flags, loan);
+}
+
+static int sock_recv_loan_release_vmeth(void *obj, struct zsock_rx_loan *loan)
+{
+	return zsock_recv_loan_release_ctx(obj, loan);
+}
+#endif /* CONFIG_NET_SOCKETS_RX_LOAN */
+
+static int sock_sendmmsg_vmeth(void *obj, struct mmsghdr *msgvec,
+			       unsigned int vlen, int flags)
+{
+	return zsock_sendmmsg_loop(obj, sock_sendmsg_vmeth, msgvec, vlen, flags);
+}
+
+static int sock_recvmmsg_vmeth(void *obj, struct mmsghdr *msgvec,
+			       unsigned int vlen, int flags,
+			       struct timespec *timeout)
+{
+	return zsock_recvmmsg_loop(obj, sock_recvmsg_vmeth, msgvec, vlen, flags,
+				   timeout);
+}
+
 static int sock_getsockopt_vmeth(void *obj, int level, int optname,
 				 void *optval, socklen_t *optlen)
 {
@@ -3030,6 +3304,12 @@ const struct socket_op_vtable sock_fd_op_vtable = {
 	.setsockopt = sock_setsockopt_vmeth,
 	.getpeername = sock_getpeername_vmeth,
 	.getsockname = sock_getsockname_vmeth,
+	.sendmmsg = sock_sendmmsg_vmeth,
+	.recvmmsg = sock_recvmmsg_vmeth,
+#if defined(CONFIG_NET_SOCKETS_RX_LOAN)
+	.recv_loan = sock_recv_loan_vmeth,
+	.recv_loan_release = sock_recv_loan_release_vmeth,
+#endif
 };
 
 static bool inet_is_supported(int family, int type, int proto)
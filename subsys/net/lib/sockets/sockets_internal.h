@@ -75,10 +75,28 @@ struct socket_op_vtable {
 			   socklen_t *addrlen);
 	int (*getsockname)(void *obj, struct sockaddr *addr,
 			   socklen_t *addrlen);
+	/* Optional, sendmsg/recvmsg are called for each message if NULL */
+	int (*sendmmsg)(void *obj, struct mmsghdr *msgvec, unsigned int vlen,
+			int flags);
+	int (*recvmmsg)(void *obj, struct mmsghdr *msgvec, unsigned int vlen,
+			int flags, struct timespec *timeout);
+	ssize_t (*recv_loan)(void *obj, struct msghdr *msg, int flags,
+			     struct zsock_rx_loan *loan);
+	int (*recv_loan_release)(void *obj, struct zsock_rx_loan *loan);
 };
 
 size_t msghdr_non_empty_iov_count(const struct msghdr *msg);
 
+int zsock_sendmmsg_loop(void *obj,
+			ssize_t (*sendmsg)(void *obj, const struct msghdr *msg,
+					   int flags),
+			struct mmsghdr *msgvec, unsigned int vlen, int flags);
+int zsock_recvmmsg_loop(void *obj,
+			ssize_t (*recvmsg)(void *obj, struct msghdr *msg,
+					   int flags),
+			struct mmsghdr *msgvec, unsigned int vlen, int flags,
+			const struct timespec *timeout);
+
 #if defined(CONFIG_NET_SOCKETS_OBJ_CORE)
 int sock_obj_core_alloc(int sock, struct net_socket_register *reg,
 			int family, int type, int proto);
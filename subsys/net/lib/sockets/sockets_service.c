@@ -10,7 +10,7 @@ LOG_MODULE_REGISTER(net_sock_svc, CONFIG_NET_SOCKETS_LOG_LEVEL);
 #include <zephyr/kernel.h>
 #include <zephyr/init.h>
 #include <zephyr/net/socket_service.h>
-#include <zephyr/zvfs/eventfd.h>
+#include <zephyr/zvfs/epoll.h>
 
 static int init_socket_service(void);
 
@@ -29,12 +29,10 @@ STRUCT_SECTION_START_EXTERN(net_socket_service_desc);
 STRUCT_SECTION_END_EXTERN(net_socket_service_desc);
 
 static struct service {
-	struct zsock_pollfd events[CONFIG_ZVFS_POLL_MAX];
-	int count;
+	struct zvfs_epoll_event events[CONFIG_ZVFS_EPOLL_MAX_FDS];
+	int epfd;
 } ctx;
 
-#define get_idx(svc) (*(svc->idx))
-
 void net_socket_service_foreach(net_socket_service_cb_t cb, void *user_data)
 {
 	STRUCT_SECTION_FOREACH(net_socket_service_desc, svc) {
@@ -42,6 +40,41 @@ void net_socket_service_foreach(net_socket_service_cb_t cb, void *user_data)
 	}
 }
 
+static void unwatch_svc_events(const struct net_socket_service_desc *svc)
+{
+	for (int i = 0; i < svc->pev_len; i++) {
+		if (svc->pev[i].event.fd >= 0) {
+			/* The socket may already be closed */
+			(void)zvfs_epoll_ctl(ctx.epfd, ZVFS_EPOLL_CTL_DEL,
+					     svc->pev[i].event.fd, NULL);
+		}
+	}
+}
+
+static int watch_svc_events(const struct net_socket_service_desc *svc)
+{
+	struct zvfs_epoll_event ev;
+	int ret = 0;
+
+	for (int i = 0; i < svc->pev_len; i++) {
+		if (svc->pev[i].event.fd < 0) {
+			continue;
+		}
+
+		ev.events = svc->pev[i].event.events;
+		ev.data.ptr = &svc->pev[i];
+
+		if (zvfs_epoll_ctl(ctx.epfd, ZVFS_EPOLL_CTL_ADD,
+				   svc->pev[i].event.fd, &ev) < 0) {
+			ret = -errno;
+			NET_ERR("Cannot monitor socket %d of service %p (%d)",
+				svc->pev[i].event.fd, svc, ret);
+		}
+	}
+
+	return ret;
+}
+
 static void cleanup_svc_events(const struct net_socket_service_desc *svc)
 {
 	for (int i = 0; i < svc->pev_len; i++) {
@@ -71,26 +104,30 @@ int z_impl_net_socket_service_register(const struct net_socket_service_desc *svc
 		goto out;
 	}
 
+	if (fds != NULL && len > svc->pev_len) {
+		NET_DBG("Too many file descriptors, "
+			"max is %d for service %p",
+			svc->pev_len, svc);
+		ret = -ENOMEM;
+		goto out;
+	}
+
+	/* The thread picks up the changes of the interest list itself */
+	unwatch_svc_events(svc);
+
 	if (fds == NULL) {
 		cleanup_svc_events(svc);
-	} else {
-		if (len > svc->pev_len) {
-			NET_DBG("Too many file descriptors, "
-				"max is %d for service %p",
-				svc->pev_len, svc);
-			ret = -ENOMEM;
-			goto out;
-		}
+		ret = 0;
+		goto out;
+	}
 
-		for (i = 0; i < len; i++) {
-			svc->pev[i].event = fds[i];
-			svc->pev[i].user_data = user_data;
-		}
+	for (i = 0; i < len; i++) {
+		svc->pev[i].event = fds[i];
+		svc->pev[i].user_data = user_data;
+		svc->pev[i].svc = (struct net_socket_service_desc *)svc;
 	}
 
-	/* Tell the thread to re-read the variables */
-	zvfs_eventfd_write(ctx.events[0].fd, 1);
-	ret = 0;
+	ret = watch_svc_events(svc);
 
 out:
 	k_mutex_unlock(&lock);
@@ -98,82 +135,37 @@ out:
 	return ret;
 }
 
-static struct net_socket_service_desc *find_svc_and_event(
-	struct zsock_pollfd *pev,
-	struct net_socket_service_event **event)
-{
-	STRUCT_SECTION_FOREACH(net_socket_service_desc, svc) {
-		for (int i = 0; i < svc->pev_len; i++) {
-			if (svc->pev[i].event.fd == pev->fd) {
-				*event = &svc->pev[i];
-				return svc;
-			}
-		}
-	}
-
-	return NULL;
-}
-
-/* We do not set the user callback to our work struct because we need to
- * hook into the flow and restore the global poll array so that the next poll
- * round will not notice it and call the callback again while we are
- * servicing the callback.
- */
 void net_socket_service_callback(struct net_socket_service_event *pev)
 {
-	struct net_socket_service_desc *svc = pev->svc;
 	struct net_socket_service_event ev = *pev;
 
 	ev.callback(&ev);
-
-	/* Copy back the socket fd to the global array because we marked
-	 * it as -1 when triggering the work.
-	 */
-	for (int i = 0; i < svc->pev_len; i++) {
-		ctx.events[get_idx(svc) + i] = svc->pev[i].event;
-	}
 }
 
-static int call_work(struct zsock_pollfd *pev, struct net_socket_service_event *event)
+static void trigger_work(struct net_socket_service_event *event, uint32_t revents)
 {
-	int ret = 0;
-
-	/* Mark the global fd non pollable so that we do not
-	 * call the callback second time.
-	 */
-	pev->fd = -1;
-
-	/* Synchronous call */
-	net_socket_service_callback(event);
-
-	return ret;
-
-}
-
-static int trigger_work(struct zsock_pollfd *pev)
-{
-	struct net_socket_service_event *event;
-	struct net_socket_service_desc *svc;
+	k_mutex_lock(&lock, K_FOREVER);
 
-	svc = find_svc_and_event(pev, &event);
-	if (svc == NULL) {
-		return -ENOENT;
+	/* Unregistered after being reported */
+	if (event->event.fd < 0) {
+		k_mutex_unlock(&lock);
+		return;
 	}
 
-	event->svc = svc;
+	/* Tell the service what was actually causing the event */
+	event->event.revents = (short)revents;
 
-	/* Copy the triggered event to our event so that we know what
-	 * was actually causing the event.
-	 */
-	event->event = *pev;
+	k_mutex_unlock(&lock);
 
-	return call_work(pev, event);
+	/* Synchronous call. The socket is not reported again before the
+	 * callback returns because the thread only waits after that.
+	 */
+	net_socket_service_callback(event);
 }
 
 static void socket_service_thread(void)
 {
-	int ret, i, fd, count = 0;
-	zvfs_eventfd_t value;
+	int ret, count = 0;
 
 	STRUCT_SECTION_COUNT(net_socket_service_desc, &ret);
 	if (ret == 0) {
@@ -181,87 +173,50 @@ static void socket_service_thread(void)
 		goto fail;
 	}
 
-	/* Create contiguous poll event array to enable socket polling */
 	STRUCT_SECTION_FOREACH(net_socket_service_desc, svc) {
 		NET_DBG("Service %s has %d pollable sockets",
 			COND_CODE_1(CONFIG_NET_SOCKETS_LOG_LEVEL_DBG,
 				    (svc->owner), ("")),
 			svc->pev_len);
-		get_idx(svc) = count + 1;
 		count += svc->pev_len;
 	}
 
-	if ((count + 1) > ARRAY_SIZE(ctx.events)) {
+	if (count > CONFIG_ZVFS_EPOLL_MAX_FDS) {
 		NET_ERR("You have %d services to monitor but "
-			"%zd poll entries configured.",
-			count + 1, ARRAY_SIZE(ctx.events));
+			"%d epoll entries configured.",
+			count, CONFIG_ZVFS_EPOLL_MAX_FDS);
 		NET_ERR("Please increase value of %s to at least %d",
-			"CONFIG_ZVFS_POLL_MAX", count + 1);
+			"CONFIG_ZVFS_EPOLL_MAX_FDS", count);
 		goto fail;
 	}
 
 	NET_DBG("Monitoring %d socket entries", count);
 
-	ctx.count = count + 1;
-
-	/* Create an zvfs_eventfd that can be used to trigger events during polling */
-	fd = zvfs_eventfd(0, 0);
-	if (fd < 0) {
-		fd = -errno;
-		NET_ERR("zvfs_eventfd failed (%d)", fd);
-		goto out;
+	/* The epoll instance keeps the interest list between waits, so the
+	 * sockets of a service are only looked at when they are registered
+	 * or ready.
+	 */
+	ctx.epfd = zvfs_epoll_create(0);
+	if (ctx.epfd < 0) {
+		NET_ERR("zvfs_epoll_create failed (%d)", -errno);
+		goto fail;
 	}
 
+	k_mutex_lock(&lock, K_FOREVER);
 	thread_status = SOCKET_SERVICE_THREAD_RUNNING;
 	k_condvar_broadcast(&wait_start);
-
-	ctx.events[0].fd = fd;
-	ctx.events[0].events = ZSOCK_POLLIN;
-
-restart:
-	i = 1;
-
-	k_mutex_lock(&lock, K_FOREVER);
-
-	/* Copy individual events to the big array */
-	STRUCT_SECTION_FOREACH(net_socket_service_desc, svc) {
-		for (int j = 0; j < svc->pev_len; j++) {
-			ctx.events[get_idx(svc) + j] = svc->pev[j].event;
-		}
-	}
-
 	k_mutex_unlock(&lock);
 
 	while (true) {
-		ret = zsock_poll(ctx.events, count + 1, -1);
+		ret = zvfs_epoll_wait(ctx.epfd, ctx.events, ARRAY_SIZE(ctx.events), -1);
 		if (ret < 0) {
 			ret = -errno;
-			NET_ERR("poll failed (%d)", ret);
+			NET_ERR("epoll wait failed (%d)", ret);
 			goto out;
 		}
 
-		if (ret == 0) {
-			/* should not happen because timeout is -1 */
-			break;
-		}
-
-		if (ret > 0 && ctx.events[0].revents) {
-			zvfs_eventfd_read(ctx.events[0].fd, &value);
-			NET_DBG("Received restart event.");
-			goto restart;
-		}
-
-		for (i = 1; i < (count + 1); i++) {
-			if (ctx.events[i].fd < 0) {
-				continue;
-			}
-
-			if (ctx.events[i].revents > 0) {
-				ret = trigger_work(&ctx.events[i]);
-				if (ret < 0) {
-					NET_DBG("Triggering work failed (%d)", ret);
-				}
-			}
+		for (int i = 0; i < ret; i++) {
+			trigger_work(ctx.events[i].data.ptr, ctx.events[i].events);
 		}
 	}
 
@@ -569,6 +569,15 @@ static void shell_tcp_upload_print_stats(const struct shell *sh,
 		shell_fprintf(sh, SHELL_NORMAL, "Rate:\t\t");
 		print_number(sh, client_rate_in_kbps, KBPS, KBPS_UNIT);
 		shell_fprintf(sh, SHELL_NORMAL, "\n");
+
+		if (results->cpu_cycles != 0U && results->nb_packets_sent != 0U) {
+			uint64_t total_len = (uint64_t)results->nb_packets_sent *
+					     results->packet_size;
+
+			shell_fprintf(sh, SHELL_NORMAL, "CPU load:\t%llu cycles/MB\n",
+				      (unsigned long long)(results->cpu_cycles * MB(1) /
+							   total_len));
+		}
 	}
 }
 
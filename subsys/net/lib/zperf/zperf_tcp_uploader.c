@@ -46,6 +46,9 @@ static int tcp_upload(int sock,
 	uint32_t nb_packets = 0U, nb_errors = 0U;
 	uint32_t alloc_errors = 0U;
 	int ret = 0;
+#if defined(CONFIG_SCHED_THREAD_USAGE_ALL)
+	k_thread_runtime_stats_t start_stats, end_stats;
+#endif
 
 	if (packet_size > PACKET_SIZE_MAX) {
 		NET_WARN("Packet size too large! max size: %u\n",
@@ -56,6 +59,10 @@ static int tcp_upload(int sock,
 	/* Start the loop */
 	start_time = k_uptime_ticks();
 
+#if defined(CONFIG_SCHED_THREAD_USAGE_ALL)
+	(void)k_thread_runtime_stats_all_get(&start_stats);
+#endif
+
 	(void)memset(sample_packet, 'z', sizeof(sample_packet));
 
 	/* Set the "flags" field in start of the packet to be 0.
@@ -99,6 +106,13 @@ static int tcp_upload(int sock,
 
 	end_time = k_uptime_ticks();
 
+#if defined(CONFIG_SCHED_THREAD_USAGE_ALL)
+	(void)k_thread_runtime_stats_all_get(&end_stats);
+	results->cpu_cycles = end_stats.total_cycles - start_stats.total_cycles;
+#else
+	results->cpu_cycles = 0U;
+#endif
+
 	/* Add result coming from the client */
 	results->nb_packets_sent = nb_packets;
 	results->client_time_in_us =
@@ -200,6 +214,7 @@ static void tcp_upload_async_work(struct k_work *work)
 			result.nb_packets_sent += periodic_result.nb_packets_sent;
 			result.client_time_in_us += periodic_result.client_time_in_us;
 			result.nb_packets_errors += periodic_result.nb_packets_errors;
+			result.cpu_cycles += periodic_result.cpu_cycles;
 		}
 
 		result.packet_size = periodic_result.packet_size;
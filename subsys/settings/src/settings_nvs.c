@@ -25,9 +25,21 @@ LOG_MODULE_DECLARE(settings, CONFIG_SETTINGS_LOG_LEVEL);
 
 struct settings_nvs_read_fn_arg {
 	struct nvs_fs *fs;
-	uint16_t id;
+	const struct nvs_entry *entry;
 };
 
+/* Latest NVS entries of the names and values of a batch of settings, filled
+ * in by a single nvs_foreach() walk. Only used with the settings lock held.
+ */
+struct settings_nvs_load_batch {
+	uint16_t first_id;
+	uint16_t count;
+	struct nvs_entry name[CONFIG_SETTINGS_NVS_LOAD_BATCH_SIZE];
+	struct nvs_entry value[CONFIG_SETTINGS_NVS_LOAD_BATCH_SIZE];
+};
+
+static struct settings_nvs_load_batch settings_nvs_load_batch;
+
 static int settings_nvs_load(struct settings_store *cs,
 			     const struct settings_load_arg *arg);
 static int settings_nvs_save(struct settings_store *cs, const char *name,
@@ -40,6 +52,23 @@ static struct settings_store_itf settings_nvs_itf = {
 	.csi_storage_get = settings_nvs_storage_get
 };
 
+/* Read an entry found while loading, it has to be looked up again if it was
+ * moved by garbage collection since.
+ */
+static ssize_t settings_nvs_entry_read(struct nvs_fs *fs,
+				       const struct nvs_entry *entry,
+				       void *data, size_t len)
+{
+	ssize_t rc;
+
+	rc = nvs_entry_read(fs, entry, data, len);
+	if (rc == -ENOENT) {
+		rc = nvs_read(fs, entry->id, data, len);
+	}
+
+	return rc;
+}
+
 static ssize_t settings_nvs_read_fn(void *back_end, void *data, size_t len)
 {
 	struct settings_nvs_read_fn_arg *rd_fn_arg;
@@ -47,7 +76,7 @@ static ssize_t settings_nvs_read_fn(void *back_end, void *data, size_t len)
 
 	rd_fn_arg = (struct settings_nvs_read_fn_arg *)back_end;
 
-	rc = nvs_read(rd_fn_arg->fs, rd_fn_arg->id, data, len);
+	rc = settings_nvs_entry_read(rd_fn_arg->fs, rd_fn_arg->entry, data, len);
 	if (rc > (ssize_t)len) {
 		/* nvs_read signals that not all bytes were read
 		 * align read len to what was requested
@@ -120,16 +149,43 @@ static uint16_t settings_nvs_cache_match(struct settings_nvs *cf, const char *na
 }
 #endif /* CONFIG_SETTINGS_NVS_NAME_CACHE */
 
+static int settings_nvs_load_collect(struct nvs_fs *fs,
+				     const struct nvs_entry *entry, void *arg)
+{
+	struct settings_nvs_load_batch *batch = arg;
+	struct nvs_entry *slot;
+	uint16_t idx;
+
+	if (entry->id > NVS_NAMECNT_ID + NVS_NAME_ID_OFFSET) {
+		idx = entry->id - NVS_NAME_ID_OFFSET - batch->first_id;
+		slot = batch->value;
+	} else {
+		idx = entry->id - batch->first_id;
+		slot = batch->name;
+	}
+
+	if (idx >= batch->count) {
+		return 0;
+	}
+
+	/* Only the first entry found for an ID is its latest one */
+	if (slot[idx].id == 0U) {
+		slot[idx] = *entry;
+	}
+
+	return 0;
+}
+
 static int settings_nvs_load(struct settings_store *cs,
 			     const struct settings_load_arg *arg)
 {
 	int ret = 0;
 	struct settings_nvs *cf = CONTAINER_OF(cs, struct settings_nvs, cf_store);
+	struct settings_nvs_load_batch *batch = &settings_nvs_load_batch;
 	struct settings_nvs_read_fn_arg read_fn_arg;
 	char name[SETTINGS_MAX_NAME_LEN + SETTINGS_EXTRA_LEN + 1];
-	char buf;
 	ssize_t rc1, rc2;
-	uint16_t name_id = NVS_NAMECNT_ID;
+	uint16_t name_id = cf->last_name_id;
 
 #if CONFIG_SETTINGS_NVS_NAME_CACHE
 	uint16_t cached = 0;
@@ -137,79 +193,94 @@ static int settings_nvs_load(struct settings_store *cs,
 	cf->loaded = false;
 #endif
 
-	name_id = cf->last_name_id + 1;
-
-	while (1) {
+	while (name_id != NVS_NAMECNT_ID) {
+		/* Find the entries of the settings from name_id down in one
+		 * walk through NVS, rather than with two nvs_read() each.
+		 */
+		batch->count = MIN(name_id - NVS_NAMECNT_ID,
+				   CONFIG_SETTINGS_NVS_LOAD_BATCH_SIZE);
+		batch->first_id = name_id - batch->count + 1;
+		memset(batch->name, 0, sizeof(batch->name));
+		memset(batch->value, 0, sizeof(batch->value));
 
-		name_id--;
-		if (name_id == NVS_NAMECNT_ID) {
-#if CONFIG_SETTINGS_NVS_NAME_CACHE
-			cf->loaded = true;
-			cf->cache_total = cached;
-#endif
-			break;
+		ret = nvs_foreach(&cf->cf_nvs, settings_nvs_load_collect, batch);
+		if (ret) {
+			return ret;
 		}
 
-		/* In the NVS backend, each setting item is stored in two NVS
-		 * entries one for the setting's name and one with the
-		 * setting's value.
-		 */
-		rc1 = nvs_read(&cf->cf_nvs, name_id, &name, sizeof(name));
-		rc2 = nvs_read(&cf->cf_nvs, name_id + NVS_NAME_ID_OFFSET,
-			       &buf, sizeof(buf));
-
-		if ((rc1 <= 0) && (rc2 <= 0)) {
-			/* Settings largest ID in use is invalid due to
-			 * reset, power failure or partition overflow.
-			 * Decrement it and check the next ID in subsequent
-			 * iteration.
+		for (int i = batch->count - 1; i >= 0; i--, name_id--) {
+			/* In the NVS backend, each setting item is stored in
+			 * two NVS entries one for the setting's name and one
+			 * with the setting's value.
 			 */
-			if (name_id == cf->last_name_id) {
-				cf->last_name_id--;
-				nvs_write(&cf->cf_nvs, NVS_NAMECNT_ID,
-					  &cf->last_name_id, sizeof(uint16_t));
+			rc1 = 0;
+			if (batch->name[i].len > 0U) {
+				rc1 = settings_nvs_entry_read(&cf->cf_nvs,
+							      &batch->name[i],
+							      &name, sizeof(name));
 			}
+			rc2 = batch->value[i].len;
 
-			continue;
-		}
-
-		if ((rc1 <= 0) || (rc2 <= 0)) {
-			/* Settings item is not stored correctly in the NVS.
-			 * NVS entry for its name or value is either missing
-			 * or deleted. Clean dirty entries to make space for
-			 * future settings item.
-			 */
-			nvs_delete(&cf->cf_nvs, name_id);
-			nvs_delete(&cf->cf_nvs, name_id + NVS_NAME_ID_OFFSET);
+			if ((rc1 <= 0) && (rc2 <= 0)) {
+				/* Settings largest ID in use is invalid due to
+				 * reset, power failure or partition overflow.
+				 * Decrement it and check the next ID in
+				 * subsequent iteration.
+				 */
+				if (name_id == cf->last_name_id) {
+					cf->last_name_id--;
+					nvs_write(&cf->cf_nvs, NVS_NAMECNT_ID,
+						  &cf->last_name_id, sizeof(uint16_t));
+				}
 
-			if (name_id == cf->last_name_id) {
-				cf->last_name_id--;
-				nvs_write(&cf->cf_nvs, NVS_NAMECNT_ID,
-					  &cf->last_name_id, sizeof(uint16_t));
+				continue;
 			}
 
-			continue;
-		}
+			if ((rc1 <= 0) || (rc2 <= 0)) {
+				/* Settings item is not stored correctly in the
+				 * NVS. NVS entry for its name or value is
+				 * either missing or deleted. Clean dirty
+				 * entries to make space for future settings
+				 * item.
+				 */
+				nvs_delete(&cf->cf_nvs, name_id);
+				nvs_delete(&cf->cf_nvs, name_id + NVS_NAME_ID_OFFSET);
 
-		/* Found a name, this might not include a trailing \0 */
-		name[rc1] = '\0';
-		read_fn_arg.fs = &cf->cf_nvs;
-		read_fn_arg.id = name_id + NVS_NAME_ID_OFFSET;
+				if (name_id == cf->last_name_id) {
+					cf->last_name_id--;
+					nvs_write(&cf->cf_nvs, NVS_NAMECNT_ID,
+						  &cf->last_name_id, sizeof(uint16_t));
+				}
+
+				continue;
+			}
+
+			/* Found a name, this might not include a trailing \0 */
+			name[rc1] = '\0';
+			read_fn_arg.fs = &cf->cf_nvs;
+			read_fn_arg.entry = &batch->value[i];
 
 #if CONFIG_SETTINGS_NVS_NAME_CACHE
-		settings_nvs_cache_add(cf, name, name_id);
-		cached++;
+			settings_nvs_cache_add(cf, name, name_id);
+			cached++;
 #endif
 
-		ret = settings_call_set_handler(
-			name, rc2,
-			settings_nvs_read_fn, &read_fn_arg,
-			(void *)arg);
-		if (ret) {
-			break;
+			ret = settings_call_set_handler(
+				name, rc2,
+				settings_nvs_read_fn, &read_fn_arg,
+				(void *)arg);
+			if (ret) {
+				return ret;
+			}
 		}
 	}
-	return ret;
+
+#if CONFIG_SETTINGS_NVS_NAME_CACHE
+	cf->loaded = true;
+	cf->cache_total = cached;
+#endif
+
+	return 0;
 }
 
 static int settings_nvs_save(struct settings_store *cs, const char *name,
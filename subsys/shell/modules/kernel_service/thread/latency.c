@@ -0,0 +1,81 @@
+/*
+ * Copyright (c) 2026 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "kernel_shell.h"
+
+#include <zephyr/kernel.h>
+
+static void latency_dump(const struct shell *sh, const k_thread_runtime_stats_t *stats)
+{
+	uint32_t count = 0U;
+
+	for (unsigned int i = 0; i < ARRAY_SIZE(stats->latency); i++) {
+		count += stats->latency[i];
+	}
+
+	shell_print(sh, "\tswitch ins: %u, max latency: %u cycles", count,
+		    stats->latency_max);
+
+	for (unsigned int i = 0; i < ARRAY_SIZE(stats->latency); i++) {
+		if (stats->latency[i] == 0U) {
+			continue;
+		}
+
+		if (i == (ARRAY_SIZE(stats->latency) - 1U)) {
+			shell_print(sh, "\t  >= %10u: %u", (uint32_t)BIT(i), stats->latency[i]);
+		} else {
+			shell_print(sh, "\t  <  %10u: %u", (uint32_t)BIT(i + 1), stats->latency[i]);
+		}
+	}
+}
+
+static void shell_latency_dump(const struct k_thread *cthread, void *user_data)
+{
+	struct k_thread *thread = (struct k_thread *)cthread;
+	const struct shell *sh = (const struct shell *)user_data;
+	k_thread_runtime_stats_t stats;
+	const char *tname;
+
+	if (k_thread_runtime_stats_get(thread, &stats) != 0) {
+		return;
+	}
+
+	tname = k_thread_name_get(thread);
+
+	shell_print(sh, "%p %-10s priority: %d", thread, tname ? tname : "NA",
+		    thread->base.prio);
+	latency_dump(sh, &stats);
+}
+
+static int cmd_kernel_thread_latency(const struct shell *sh, size_t argc, char **argv)
+{
+	ARG_UNUSED(argc);
+	ARG_UNUSED(argv);
+	k_thread_runtime_stats_t stats;
+	unsigned int num_cpus = arch_num_cpus();
+
+	shell_print(sh, "Ready to switched in latency, in cycles");
+
+	/*
+	 * Use the unlocked version as the callback itself might call
+	 * arch_irq_unlock.
+	 */
+	k_thread_foreach_unlocked(shell_latency_dump, (void *)sh);
+
+	for (int i = 0; i < num_cpus; i++) {
+		if (k_thread_runtime_stats_cpu_get(i, &stats) != 0) {
+			continue;
+		}
+
+		shell_print(sh, "CPU %d", i);
+		latency_dump(sh, &stats);
+	}
+
+	return 0;
+}
+
+KERNEL_THREAD_CMD_ADD(latency, NULL, "Show wakeup to run latency histograms.",
+		      cmd_kernel_thread_latency);
@@ -16,6 +16,10 @@ LOG_MODULE_REGISTER(LOG_MODULE_NAME, CONFIG_STREAM_FLASH_LOG_LEVEL);
 
 #include <zephyr/storage/stream_flash.h>
 
+#ifdef CONFIG_STREAM_FLASH_ERASE_ASYNC
+#include <zephyr/rtio/rtio.h>
+#endif
+
 #ifdef CONFIG_STREAM_FLASH_PROGRESS
 #include <zephyr/settings/settings.h>
 
@@ -72,6 +76,149 @@ static int settings_direct_loader(const char *key, size_t len,
 
 #endif /* CONFIG_STREAM_FLASH_PROGRESS */
 
+#ifdef CONFIG_STREAM_FLASH_ERASE_ASYNC
+
+/* Page erase running in the background for a context */
+struct stream_flash_erase {
+	struct rtio_iodev iodev;
+	struct stream_flash_ctx *ctx; /* NULL when unused */
+	off_t page_start_offset;
+	int rc;
+	bool done;
+};
+
+static struct stream_flash_erase erases[CONFIG_STREAM_FLASH_ERASE_ASYNC_CONTEXTS];
+
+RTIO_DEFINE(stream_flash_rtio, CONFIG_STREAM_FLASH_ERASE_ASYNC_CONTEXTS,
+	    CONFIG_STREAM_FLASH_ERASE_ASYNC_CONTEXTS);
+
+/* Protects the erases and the completion queue */
+static K_MUTEX_DEFINE(erase_lock);
+
+/* Record the result of a finished erase */
+static void stream_flash_erase_complete(struct rtio_cqe *cqe)
+{
+	struct stream_flash_erase *erase = cqe->userdata;
+
+	erase->rc = cqe->result;
+	erase->done = true;
+	rtio_cqe_release(&stream_flash_rtio, cqe);
+}
+
+/* Start erasing the page holding the offset, unless it is already erased.
+ * If no erase can be started, the page is erased when the buffer is written.
+ */
+static void stream_flash_erase_start(struct stream_flash_ctx *ctx, off_t off)
+{
+	struct stream_flash_erase *erase = NULL;
+	struct flash_pages_info page;
+	struct rtio_sqe *sqe;
+	struct rtio_cqe *cqe;
+
+#if defined(CONFIG_FLASH_HAS_NO_EXPLICIT_ERASE)
+	const struct flash_parameters *fparams = flash_get_parameters(ctx->fdev);
+
+	if (!(flash_params_get_erase_cap(fparams) & FLASH_ERASE_C_EXPLICIT)) {
+		return;
+	}
+#endif
+	if (flash_get_page_info_by_offs(ctx->fdev, off, &page) != 0 ||
+	    ctx->last_erased_page_start_offset == page.start_offset) {
+		return;
+	}
+
+	k_mutex_lock(&erase_lock, K_FOREVER);
+
+	for (int i = 0; i < ARRAY_SIZE(erases); i++) {
+		if (erases[i].ctx == ctx) {
+			/* Only one erase at a time for each context */
+			goto out;
+		}
+
+		if (erases[i].ctx == NULL && erase == NULL) {
+			erase = &erases[i];
+		}
+	}
+
+	/* A context keeps its erase until it writes again or is initialized,
+	 * which a context that was given up never does. Take over the slot
+	 * of a finished erase of another context then. That context only
+	 * erases its page again when it writes it.
+	 */
+	if (erase == NULL) {
+		while ((cqe = rtio_cqe_consume(&stream_flash_rtio)) != NULL) {
+			stream_flash_erase_complete(cqe);
+		}
+
+		for (int i = 0; i < ARRAY_SIZE(erases); i++) {
+			if (erases[i].done) {
+				erase = &erases[i];
+				break;
+			}
+		}
+	}
+
+	sqe = (erase != NULL) ? rtio_sqe_acquire(&stream_flash_rtio) : NULL;
+	if (sqe == NULL) {
+		goto out;
+	}
+
+	LOG_DBG("Erasing page at offset 0x%08lx in the background",
+		(long)page.start_offset);
+
+	flash_iodev_init(&erase->iodev, ctx->fdev);
+	flash_sqe_prep_erase(sqe, &erase->iodev, page.start_offset, page.size,
+			     erase);
+	erase->ctx = ctx;
+	erase->page_start_offset = page.start_offset;
+	erase->done = false;
+
+	rtio_submit(&stream_flash_rtio, 0);
+
+out:
+	k_mutex_unlock(&erase_lock);
+}
+
+/* Wait for the background erase of a context, if there is one */
+static int stream_flash_erase_wait(struct stream_flash_ctx *ctx)
+{
+	struct stream_flash_erase *erase = NULL;
+	int rc = 0;
+
+	k_mutex_lock(&erase_lock, K_FOREVER);
+
+	for (int i = 0; i < ARRAY_SIZE(erases); i++) {
+		if (erases[i].ctx == ctx) {
+			erase = &erases[i];
+		}
+	}
+
+	if (erase == NULL) {
+		goto out;
+	}
+
+	/* Completions of the erases of other contexts are kept for them */
+	while (!erase->done) {
+		stream_flash_erase_complete(rtio_cqe_consume_block(&stream_flash_rtio));
+	}
+
+	rc = erase->rc;
+	if (rc != 0) {
+		LOG_ERR("Error %d while erasing page", rc);
+	} else {
+		ctx->last_erased_page_start_offset = erase->page_start_offset;
+	}
+
+	erase->ctx = NULL;
+
+out:
+	k_mutex_unlock(&erase_lock);
+
+	return rc;
+}
+
+#endif /* CONFIG_STREAM_FLASH_ERASE_ASYNC */
+
 #ifdef CONFIG_STREAM_FLASH_ERASE
 
 int stream_flash_erase_page(struct stream_flash_ctx *ctx, off_t off)
@@ -85,6 +232,13 @@ int stream_flash_erase_page(struct stream_flash_ctx *ctx, off_t off)
 		return -ERANGE;
 	}
 
+#ifdef CONFIG_STREAM_FLASH_ERASE_ASYNC
+	rc = stream_flash_erase_wait(ctx);
+	if (rc != 0) {
+		return rc;
+	}
+#endif
+
 #if defined(CONFIG_FLASH_HAS_NO_EXPLICIT_ERASE)
 	/* There are both types of devices */
 	const struct flash_parameters *fparams = flash_get_parameters(ctx->fdev);
@@ -230,6 +384,14 @@ int stream_flash_buffered_write(struct stream_flash_ctx *ctx, const uint8_t *dat
 		ctx->buf_bytes += len - processed;
 	}
 
+#ifdef CONFIG_STREAM_FLASH_ERASE_ASYNC
+	/* Erase the page of the buffered data while more is buffered */
+	if (!flush && ctx->buf_bytes > 0) {
+		stream_flash_erase_start(ctx, ctx->offset + ctx->bytes_written +
+					 ctx->buf_bytes - 1);
+	}
+#endif
+
 	if (flush && ctx->buf_bytes > 0) {
 		rc = flash_sync(ctx);
 	}
@@ -272,6 +434,11 @@ int stream_flash_init(struct stream_flash_ctx *ctx, const struct device *fdev,
 		return -EFAULT;
 	}
 
+#ifdef CONFIG_STREAM_FLASH_ERASE_ASYNC
+	/* The context may be re-initialized while erasing */
+	(void)stream_flash_erase_wait(ctx);
+#endif
+
 #ifdef CONFIG_STREAM_FLASH_PROGRESS
 	int rc = settings_subsys_init();
 
@@ -336,6 +503,10 @@ int stream_flash_progress_load(struct stream_flash_ctx *ctx,
 		return -EFAULT;
 	}
 
+#ifdef CONFIG_STREAM_FLASH_ERASE_ASYNC
+	(void)stream_flash_erase_wait(ctx);
+#endif
+
 	int rc = settings_load_subtree_direct(settings_key,
 					      settings_direct_loader,
 					      (void *) ctx);
@@ -0,0 +1,115 @@
+/*
+ * Copyright (c) 2026 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * @file
+ * This file contains tests that will measure the throughput of the CRC
+ * library functions that are used on large buffers, such as flash sectors
+ * and network packets.
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/timing/timing.h>
+#include <zephyr/tc_util.h>
+#include <zephyr/sys/crc.h>
+
+static uint8_t buffer[CONFIG_BENCHMARK_BUFFER_SIZE];
+
+static const size_t buffer_sizes[] = {64, 512, CONFIG_BENCHMARK_BUFFER_SIZE};
+
+/* Prevent the compiler from discarding the results */
+static volatile uint32_t sink;
+
+enum crc_func {
+	FUNC_CRC32_IEEE,
+	FUNC_CRC32_C,
+	FUNC_CRC16_CCITT,
+	FUNC_CRC16_ITU_T,
+	FUNC_COUNT,
+};
+
+static const char *const func_names[FUNC_COUNT] = {
+	"crc32_ieee", "crc32_c", "crc16_ccitt", "crc16_itu_t",
+};
+
+static uint32_t crc_run(enum crc_func func, const uint8_t *data, size_t len)
+{
+	switch (func) {
+	case FUNC_CRC32_IEEE:
+		return crc32_ieee(data, len);
+	case FUNC_CRC32_C:
+		return crc32_c(0, data, len, true, true);
+	case FUNC_CRC16_CCITT:
+		return crc16_ccitt(0xffff, data, len);
+	case FUNC_CRC16_ITU_T:
+		return crc16_itu_t(0xffff, data, len);
+	default:
+		return 0;
+	}
+}
+
+static void test_crc(enum crc_func func, size_t len)
+{
+	timing_t start;
+	timing_t finish;
+	uint64_t cycles;
+	uint64_t ns;
+	uint64_t bytes = (uint64_t)len * CONFIG_BENCHMARK_NUM_ITERATIONS;
+
+	start = timing_counter_get();
+
+	for (unsigned int i = 0; i < CONFIG_BENCHMARK_NUM_ITERATIONS; i++) {
+		sink = crc_run(func, buffer, len);
+	}
+
+	finish = timing_counter_get();
+
+	cycles = timing_cycles_get(&start, &finish);
+	ns = timing_cycles_to_ns(cycles);
+
+	printk("%-12s %5zu bytes : %4u.%02u cycles/byte %8u KiB/s\n",
+	       func_names[func], len,
+	       (uint32_t)(cycles / bytes),
+	       (uint32_t)(((cycles % bytes) * 100U) / bytes),
+	       (ns == 0U) ? 0U : (uint32_t)((bytes * 1000000000ULL) / (ns * 1024U)));
+}
+
+int main(void)
+{
+	uint32_t seed = 0x12345678U;
+	unsigned int freq;
+
+	for (size_t i = 0; i < sizeof(buffer); i++) {
+		seed = seed * 1103515245U + 12345U;
+		buffer[i] = (uint8_t)(seed >> 16);
+	}
+
+	timing_init();
+
+	freq = timing_freq_get_mhz();
+
+	printk("Throughput Measurements for %s CRC%s\n",
+	       IS_ENABLED(CONFIG_CRC_SLICE_BY_8) ? "slicing-by-8" : "4-bit table",
+	       IS_ENABLED(CONFIG_CRC_ARCH) ? " with CPU instructions" : "");
+	printk("Timing results: Clock frequency: %u MHz\n", freq);
+
+	timing_start();
+
+	for (unsigned int f = 0; f < FUNC_COUNT; f++) {
+		for (unsigned int i = 0; i < ARRAY_SIZE(buffer_sizes); i++) {
+			if (buffer_sizes[i] <= CONFIG_BENCHMARK_BUFFER_SIZE) {
+				test_crc(f, buffer_sizes[i]);
+			}
+		}
+		printk("------------------------------------\n");
+	}
+
+	timing_stop();
+
+	TC_END_REPORT(0);
+
+	return 0;
+}
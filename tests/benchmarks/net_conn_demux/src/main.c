@@ -0,0 +1,289 @@
+/*
+ * Copyright (c) 2026 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * @file
+ * This file contains tests that will measure the length of time required
+ * by the connection layer to find the receiver of an incoming UDP packet
+ * while a varying number of connections are registered. The packets are
+ * handed directly to net_conn_input() so that neither the driver nor the
+ * IP layer is included in the measurements.
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/timing/timing.h>
+#include <zephyr/tc_util.h>
+#include <zephyr/net/net_core.h>
+#include <zephyr/net/net_if.h>
+#include <zephyr/net/net_pkt.h>
+#include <zephyr/net/dummy.h>
+
+#include "connection.h"
+
+#define LOCAL_PORT    5000
+#define LISTEN_PORT   7000
+#define REMOTE_PORT   40000
+
+static const unsigned int conn_counts[] = {8, 64, 256};
+
+static struct net_conn_handle *handles[CONFIG_NET_MAX_CONN];
+static struct net_conn_handle *listener;
+static unsigned int num_conns;
+
+static struct in_addr local_addr = { { { 192, 0, 2, 1 } } };
+
+static void *last_user_data;
+
+struct cycle_stats {
+	uint64_t minimum;
+	uint64_t maximum;
+	uint64_t total;
+};
+
+static int dummy_send(const struct device *dev, struct net_pkt *pkt)
+{
+	ARG_UNUSED(dev);
+	ARG_UNUSED(pkt);
+
+	return 0;
+}
+
+static void dummy_iface_init(struct net_if *iface)
+{
+	static uint8_t mac[] = { 0x00, 0x00, 0x5E, 0x00, 0x53, 0x01 };
+
+	net_if_set_link_addr(iface, mac, sizeof(mac), NET_LINK_ETHERNET);
+}
+
+static struct dummy_api dummy_api_funcs = {
+	.iface_api.init = dummy_iface_init,
+	.send = dummy_send,
+};
+
+NET_DEVICE_INIT(net_conn_demux_test, "net_conn_demux_test", NULL, NULL,
+		NULL, NULL, CONFIG_KERNEL_INIT_PRIORITY_DEFAULT,
+		&dummy_api_funcs, DUMMY_L2, NET_L2_GET_CTX_TYPE(DUMMY_L2), 127);
+
+/* Consume nothing, so the same packet can be passed in again */
+static enum net_verdict conn_cb(struct net_conn *conn, struct net_pkt *pkt,
+				union net_ip_header *ip_hdr,
+				union net_proto_header *proto_hdr,
+				void *user_data)
+{
+	ARG_UNUSED(conn);
+	ARG_UNUSED(pkt);
+	ARG_UNUSED(ip_hdr);
+	ARG_UNUSED(proto_hdr);
+
+	last_user_data = user_data;
+
+	return NET_OK;
+}
+
+static void remote_addr_get(unsigned int idx, struct in_addr *addr)
+{
+	addr->s4_addr[0] = 198;
+	addr->s4_addr[1] = 51;
+	addr->s4_addr[2] = 100 + idx / 250U;
+	addr->s4_addr[3] = 1 + idx % 250U;
+}
+
+static int conn_add(unsigned int idx)
+{
+	struct sockaddr_in remote = {
+		.sin_family = AF_INET,
+	};
+	struct sockaddr_in local = {
+		.sin_family = AF_INET,
+		.sin_addr = local_addr,
+	};
+
+	remote_addr_get(idx, &remote.sin_addr);
+
+	return net_conn_register(IPPROTO_UDP, AF_INET,
+				 (struct sockaddr *)&remote,
+				 (struct sockaddr *)&local,
+				 REMOTE_PORT + idx, LOCAL_PORT, NULL, conn_cb,
+				 UINT_TO_POINTER(idx + 1), &handles[idx]);
+}
+
+static int listener_add(void)
+{
+	struct sockaddr_in local = {
+		.sin_family = AF_INET,
+	};
+
+	return net_conn_register(IPPROTO_UDP, AF_INET, NULL,
+				 (struct sockaddr *)&local, 0, LISTEN_PORT,
+				 NULL, conn_cb, &listener, &listener);
+}
+
+static void stats_reset(struct cycle_stats *stats)
+{
+	stats->minimum = UINT64_MAX;
+	stats->maximum = 0ULL;
+	stats->total = 0ULL;
+}
+
+static void stats_add(struct cycle_stats *stats, uint64_t cycles)
+{
+	stats->minimum = MIN(stats->minimum, cycles);
+	stats->maximum = MAX(stats->maximum, cycles);
+	stats->total += cycles;
+}
+
+static void report_stats(const struct cycle_stats *stats,
+			 unsigned int num_iterations, const char *str)
+{
+	uint64_t average = stats->total / num_iterations;
+
+	printk("%s\n", str);
+
+	printk("    Minimum : %7llu cycles (%7u nsec)\n",
+	       stats->minimum, (uint32_t)timing_cycles_to_ns(stats->minimum));
+	printk("    Maximum : %7llu cycles (%7u nsec)\n",
+	       stats->maximum, (uint32_t)timing_cycles_to_ns(stats->maximum));
+	printk("    Average : %7llu cycles (%7u nsec)\n",
+	       average, (uint32_t)timing_cycles_to_ns(average));
+}
+
+static int measure_input(struct net_pkt *pkt, unsigned int remote_idx,
+			 uint16_t dst_port, void *expected,
+			 const char *str)
+{
+	struct net_ipv4_hdr ipv4_hdr = { 0 };
+	struct net_udp_hdr udp_hdr = { 0 };
+	union net_ip_header ip_hdr = { .ipv4 = &ipv4_hdr };
+	union net_proto_header proto_hdr = { .udp = &udp_hdr };
+	struct cycle_stats stats;
+	enum net_verdict verdict;
+	timing_t start;
+	timing_t finish;
+
+	remote_addr_get(remote_idx, (struct in_addr *)ipv4_hdr.src);
+	memcpy(ipv4_hdr.dst, &local_addr, sizeof(ipv4_hdr.dst));
+	ipv4_hdr.proto = IPPROTO_UDP;
+
+	udp_hdr.src_port = htons(REMOTE_PORT + remote_idx);
+	udp_hdr.dst_port = htons(dst_port);
+
+	stats_reset(&stats);
+
+	for (unsigned int i = 0; i < CONFIG_BENCHMARK_NUM_ITERATIONS; i++) {
+		last_user_data = NULL;
+
+		start = timing_counter_get();
+		verdict = net_conn_input(pkt, &ip_hdr, IPPROTO_UDP, &proto_hdr);
+		finish = timing_counter_get();
+
+		if (verdict != NET_OK || last_user_data != expected) {
+			printk("Packet for %s was not delivered\n", str);
+			return -EIO;
+		}
+
+		stats_add(&stats, timing_cycles_get(&start, &finish));
+	}
+
+	report_stats(&stats, CONFIG_BENCHMARK_NUM_ITERATIONS, str);
+
+	return 0;
+}
+
+static int test_conn_count(struct net_pkt *pkt, unsigned int count)
+{
+	char description[80];
+	int ret;
+
+	while (num_conns < count) {
+		ret = conn_add(num_conns);
+		if (ret < 0) {
+			printk("Cannot register connection %u (%d)\n",
+			       num_conns, ret);
+			return ret;
+		}
+
+		num_conns++;
+	}
+
+	snprintk(description, sizeof(description),
+		 "Newest of %u connections", count);
+	ret = measure_input(pkt, count - 1, LOCAL_PORT,
+			    UINT_TO_POINTER(count), description);
+	if (ret < 0) {
+		return ret;
+	}
+
+	snprintk(description, sizeof(description),
+		 "Oldest of %u connections", count);
+	ret = measure_input(pkt, 0, LOCAL_PORT, UINT_TO_POINTER(1),
+			    description);
+	if (ret < 0) {
+		return ret;
+	}
+
+	snprintk(description, sizeof(description),
+		 "Listener next to %u connections", count);
+	ret = measure_input(pkt, count, LISTEN_PORT, &listener, description);
+	if (ret < 0) {
+		return ret;
+	}
+
+	printk("------------------------------------\n");
+
+	return 0;
+}
+
+int main(void)
+{
+	struct net_if *iface = net_if_get_first_by_type(&NET_L2_GET_NAME(DUMMY));
+	struct net_pkt *pkt;
+	unsigned int freq;
+	int ret = 0;
+
+	if (iface == NULL ||
+	    net_if_ipv4_addr_add(iface, &local_addr, NET_ADDR_MANUAL, 0) == NULL) {
+		printk("Cannot set up the network interface\n");
+		TC_END_REPORT(TC_FAIL);
+		return 0;
+	}
+
+	pkt = net_pkt_alloc_on_iface(iface, K_FOREVER);
+	net_pkt_set_family(pkt, AF_INET);
+
+	ret = listener_add();
+	if (ret < 0) {
+		printk("Cannot register listener (%d)\n", ret);
+		TC_END_REPORT(TC_FAIL);
+		return 0;
+	}
+
+	timing_init();
+
+	freq = timing_freq_get_mhz();
+
+	printk("Time Measurements for %s connection lookup\n",
+	       IS_ENABLED(CONFIG_NET_CONN_HASH) ? "hashed" : "linear");
+	printk("Timing results: Clock frequency: %u MHz\n", freq);
+
+	timing_start();
+
+	for (unsigned int i = 0; i < ARRAY_SIZE(conn_counts); i++) {
+		if (conn_counts[i] < CONFIG_NET_MAX_CONN) {
+			ret = test_conn_count(pkt, conn_counts[i]);
+			if (ret < 0) {
+				break;
+			}
+		}
+	}
+
+	timing_stop();
+
+	net_pkt_unref(pkt);
+
+	TC_END_REPORT(ret < 0 ? TC_FAIL : TC_PASS);
+
+	return 0;
+}
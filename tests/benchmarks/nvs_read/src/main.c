@@ -0,0 +1,164 @@
+/*
+ * Copyright (c) 2026 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * @file
+ * This file contains tests that will measure the time needed to read an
+ * entry stored in NVS, depending on the number of entries stored.
+ */
+
+#include <string.h>
+
+#include <zephyr/kernel.h>
+#include <zephyr/tc_util.h>
+#include <zephyr/drivers/flash.h>
+#include <zephyr/fs/nvs.h>
+#include <zephyr/storage/flash_map.h>
+#include <zephyr/stats/stats.h>
+
+#define NVS_PARTITION_ID     FIXED_PARTITION_ID(nvs_partition)
+#define NVS_PARTITION_OFFSET FIXED_PARTITION_OFFSET(nvs_partition)
+#define NVS_PARTITION_SIZE   FIXED_PARTITION_SIZE(nvs_partition)
+
+static struct nvs_fs fs;
+static uint32_t *flash_read_calls;
+
+static int flash_sim_read_calls_find(struct stats_hdr *hdr, void *arg,
+				     const char *name, uint16_t off)
+{
+	if (!strcmp(name, "flash_read_calls")) {
+		*(uint32_t **)arg = (uint32_t *)((uint8_t *)hdr + off);
+	}
+
+	return 0;
+}
+
+static int nvs_setup(void)
+{
+	const struct flash_area *fa;
+	struct flash_pages_info info;
+	int rc;
+
+	rc = flash_area_open(NVS_PARTITION_ID, &fa);
+	if (rc) {
+		return rc;
+	}
+
+	fs.flash_device = flash_area_get_device(fa);
+	fs.offset = NVS_PARTITION_OFFSET;
+
+	rc = flash_get_page_info_by_offs(fs.flash_device, fs.offset, &info);
+	if (rc) {
+		return rc;
+	}
+
+	fs.sector_size = info.size;
+	fs.sector_count = NVS_PARTITION_SIZE / info.size;
+
+	return nvs_mount(&fs);
+}
+
+static int store_entries(void)
+{
+	uint32_t val;
+	ssize_t rc;
+
+	for (uint16_t id = 0; id < CONFIG_BENCHMARK_NVS_ENTRY_COUNT; id++) {
+		val = id;
+
+		rc = nvs_write(&fs, id, &val, sizeof(val));
+		if (rc < 0) {
+			return rc;
+		}
+	}
+
+	/* Leave some history entries behind, as a device in use would */
+	for (uint16_t id = 0; id < CONFIG_BENCHMARK_NVS_ENTRY_COUNT; id += 4) {
+		val = id + 1;
+
+		rc = nvs_write(&fs, id, &val, sizeof(val));
+		if (rc < 0) {
+			return rc;
+		}
+	}
+
+	return 0;
+}
+
+static int test_read(void)
+{
+	uint32_t reads;
+	uint32_t start;
+	uint64_t cycles = 0;
+	uint64_t ns;
+	uint32_t val;
+	ssize_t rc;
+
+	reads = *flash_read_calls;
+
+	/* A single read is too short for the system timer: time each pass
+	 * over all the entries instead, in cycles.
+	 */
+	for (unsigned int i = 0; i < CONFIG_BENCHMARK_NUM_ITERATIONS; i++) {
+		start = k_cycle_get_32();
+
+		for (uint16_t id = 0; id < CONFIG_BENCHMARK_NVS_ENTRY_COUNT; id++) {
+			rc = nvs_read(&fs, id, &val, sizeof(val));
+
+			if ((rc != sizeof(val)) || (val != ((id % 4) ? id : id + 1))) {
+				printk("nvs_read of id %u failed: %d\n", id, (int)rc);
+				return -EIO;
+			}
+		}
+
+		cycles += k_cycle_get_32() - start;
+	}
+
+	reads = *flash_read_calls - reads;
+	ns = k_cyc_to_ns_floor64(cycles / CONFIG_BENCHMARK_NUM_ITERATIONS);
+
+	printk("nvs_read %5u entries : %10llu ns %10u flash reads per read\n",
+	       CONFIG_BENCHMARK_NVS_ENTRY_COUNT,
+	       (unsigned long long)(ns / CONFIG_BENCHMARK_NVS_ENTRY_COUNT),
+	       reads / (CONFIG_BENCHMARK_NUM_ITERATIONS * CONFIG_BENCHMARK_NVS_ENTRY_COUNT));
+
+	return 0;
+}
+
+int main(void)
+{
+	struct stats_hdr *sim_stats;
+	int rc;
+
+	sim_stats = stats_group_find("flash_sim_stats");
+	if (sim_stats == NULL) {
+		TC_END_REPORT(TC_FAIL);
+		return 0;
+	}
+
+	stats_walk(sim_stats, flash_sim_read_calls_find, &flash_read_calls);
+
+	rc = nvs_setup();
+	if (rc == 0) {
+		rc = store_entries();
+	}
+
+	if (rc) {
+		printk("Cannot store the entries: %d\n", rc);
+		TC_END_REPORT(TC_FAIL);
+		return 0;
+	}
+
+	printk("Read Time Measurements, %s\n",
+	       IS_ENABLED(CONFIG_NVS_LOOKUP_INDEX) ? "lookup index" :
+	       IS_ENABLED(CONFIG_NVS_LOOKUP_CACHE) ? "lookup cache" : "no lookup cache");
+
+	rc = test_read();
+
+	TC_END_REPORT(rc ? TC_FAIL : TC_PASS);
+
+	return 0;
+}
@@ -84,6 +84,10 @@ static void start_threads(unsigned int num_threads)
 		k_thread_create(&test_thread[i], test_stack, TEST_STACK_SIZE,
 				test_entry, (void *)(uintptr_t)i, NULL, NULL,
 				i / bucket_size, 0, K_NO_WAIT);
+#ifdef CONFIG_SCHED_DEADLINE
+		/* Spread deadlines so that ties within a priority are rare */
+		k_thread_deadline_set(&test_thread[i], (int)((i * 7919U) % 100000U) + 1);
+#endif /* CONFIG_SCHED_DEADLINE */
 	}
 }
 
@@ -218,9 +222,11 @@ int main(void)
 
 	freq = timing_freq_get_mhz();
 
-	printk("Time Measurements for %s sched queues\n",
+	printk("Time Measurements for %s sched queues%s with %u threads\n",
 	       IS_ENABLED(CONFIG_SCHED_DUMB) ? "dumb" :
-	       IS_ENABLED(CONFIG_SCHED_SCALABLE) ? "scalable" : "multiq");
+	       IS_ENABLED(CONFIG_SCHED_SCALABLE) ? "scalable" : "multiq",
+	       IS_ENABLED(CONFIG_SCHED_DEADLINE) ? " (deadline)" : "",
+	       CONFIG_BENCHMARK_NUM_THREADS);
 	printk("Timing results: Clock frequency: %u MHz\n", freq);
 
 	start_threads(CONFIG_BENCHMARK_NUM_THREADS);
@@ -0,0 +1,182 @@
+/*
+ * Copyright (c) 2026 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * @file
+ * This file contains tests that will measure the time needed to load the
+ * settings stored in NVS, as done at boot.
+ */
+
+#include <stdio.h>
+#include <string.h>
+
+#include <zephyr/kernel.h>
+#include <zephyr/tc_util.h>
+#include <zephyr/fs/nvs.h>
+#include <zephyr/settings/settings.h>
+#include <zephyr/stats/stats.h>
+
+#include "settings/settings_nvs.h"
+
+static uint32_t *flash_read_calls;
+static unsigned int loaded;
+
+static int bench_set(const char *name, size_t len, settings_read_cb read_cb,
+		     void *cb_arg)
+{
+	uint32_t val;
+
+	if (read_cb(cb_arg, &val, sizeof(val)) != sizeof(val)) {
+		return -EINVAL;
+	}
+
+	loaded++;
+
+	return 0;
+}
+
+SETTINGS_STATIC_HANDLER_DEFINE(bench, "bench", NULL, bench_set, NULL, NULL);
+
+static int flash_sim_read_calls_find(struct stats_hdr *hdr, void *arg,
+				     const char *name, uint16_t off)
+{
+	if (!strcmp(name, "flash_read_calls")) {
+		*(uint32_t **)arg = (uint32_t *)((uint8_t *)hdr + off);
+	}
+
+	return 0;
+}
+
+static int store_settings(void)
+{
+	char name[SETTINGS_MAX_NAME_LEN];
+	uint32_t val;
+	int rc;
+
+	for (unsigned int i = 0; i < CONFIG_BENCHMARK_SETTINGS_COUNT; i++) {
+		snprintf(name, sizeof(name), "bench/key%u", i);
+		val = i;
+
+		rc = settings_save_one(name, &val, sizeof(val));
+		if (rc) {
+			return rc;
+		}
+	}
+
+	/* Leave some history entries behind, as a device in use would */
+	for (unsigned int i = 0; i < CONFIG_BENCHMARK_SETTINGS_COUNT; i += 4) {
+		snprintf(name, sizeof(name), "bench/key%u", i);
+		val = i + 1;
+
+		rc = settings_save_one(name, &val, sizeof(val));
+		if (rc) {
+			return rc;
+		}
+	}
+
+	return 0;
+}
+
+/* Load the settings the way the NVS backend used to, with two nvs_read()
+ * calls for each of them.
+ */
+static int nvs_read_load(void)
+{
+	char name[SETTINGS_MAX_NAME_LEN + SETTINGS_EXTRA_LEN + 1];
+	struct nvs_fs *fs;
+	uint16_t last_name_id;
+	uint32_t val;
+	int rc;
+
+	rc = settings_storage_get((void **)&fs);
+	if (rc) {
+		return rc;
+	}
+
+	rc = nvs_read(fs, NVS_NAMECNT_ID, &last_name_id, sizeof(last_name_id));
+	if (rc < 0) {
+		return rc;
+	}
+
+	for (uint16_t id = last_name_id; id > NVS_NAMECNT_ID; id--) {
+		if ((nvs_read(fs, id, name, sizeof(name)) > 0) &&
+		    (nvs_read(fs, id + NVS_NAME_ID_OFFSET, &val, sizeof(val)) > 0)) {
+			loaded++;
+		}
+	}
+
+	return 0;
+}
+
+static int test_load(const char *what, int (*load)(void))
+{
+	uint32_t reads = 0;
+	int64_t start;
+	int64_t ticks = 0;
+	uint64_t us;
+	int rc;
+
+	for (unsigned int i = 0; i < CONFIG_BENCHMARK_NUM_ITERATIONS; i++) {
+		loaded = 0;
+		reads -= *flash_read_calls;
+		start = k_uptime_ticks();
+
+		rc = load();
+
+		ticks += k_uptime_ticks() - start;
+		reads += *flash_read_calls;
+
+		if (rc || (loaded != CONFIG_BENCHMARK_SETTINGS_COUNT)) {
+			printk("%s failed: %d, %u settings loaded\n", what, rc, loaded);
+			return -EIO;
+		}
+	}
+
+	us = k_ticks_to_us_floor64(ticks / CONFIG_BENCHMARK_NUM_ITERATIONS);
+
+	printk("%-16s %5u settings : %10llu us %10u flash reads\n", what,
+	       CONFIG_BENCHMARK_SETTINGS_COUNT, (unsigned long long)us,
+	       reads / CONFIG_BENCHMARK_NUM_ITERATIONS);
+
+	return 0;
+}
+
+int main(void)
+{
+	struct stats_hdr *sim_stats;
+	int rc;
+
+	sim_stats = stats_group_find("flash_sim_stats");
+	if (sim_stats == NULL) {
+		TC_END_REPORT(TC_FAIL);
+		return 0;
+	}
+
+	stats_walk(sim_stats, flash_sim_read_calls_find, &flash_read_calls);
+
+	rc = settings_subsys_init();
+	if (rc == 0) {
+		rc = store_settings();
+	}
+
+	if (rc) {
+		printk("Cannot store the settings: %d\n", rc);
+		TC_END_REPORT(TC_FAIL);
+		return 0;
+	}
+
+	printk("Load Time Measurements, batches of %u settings\n",
+	       CONFIG_SETTINGS_NVS_LOAD_BATCH_SIZE);
+
+	rc = test_load("settings_load", settings_load);
+	if (rc == 0) {
+		rc = test_load("nvs_read", nvs_read_load);
+	}
+
+	TC_END_REPORT(rc ? TC_FAIL : TC_PASS);
+
+	return 0;
+}
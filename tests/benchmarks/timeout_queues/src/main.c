@@ -0,0 +1,152 @@
+/*
+ * Copyright (c) 2026 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * @file
+ * This file contains tests that will measure the length of time required
+ * to arm and to cancel a kernel timeout while the timeout queue already
+ * holds a varying number of outstanding timeouts. Bare _timeout objects
+ * are used rather than k_timers so that only the timeout queue itself is
+ * included in the measurements, and so that ten thousand of them fit in
+ * a modest amount of RAM.
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/timing/timing.h>
+#include <zephyr/tc_util.h>
+#include <timeout_q.h>
+
+/* Keep every timeout well in the future so none fires mid-measurement */
+#define TIMEOUT_BASE_TICKS   (100U * CONFIG_SYS_CLOCK_TICKS_PER_SEC)
+#define TIMEOUT_SPREAD_TICKS (1000U * CONFIG_SYS_CLOCK_TICKS_PER_SEC)
+
+static struct _timeout timeouts[CONFIG_BENCHMARK_NUM_TIMEOUTS];
+static struct _timeout probe;
+
+static const unsigned int queue_depths[] = {10, 1000, 10000};
+
+struct cycle_stats {
+	uint64_t minimum;
+	uint64_t maximum;
+	uint64_t total;
+};
+
+static void dummy_handler(struct _timeout *t)
+{
+	ARG_UNUSED(t);
+}
+
+/* Cheap deterministic scatter of expiries across the spread */
+static k_timeout_t spread_timeout(unsigned int i)
+{
+	return K_TICKS(TIMEOUT_BASE_TICKS +
+		       ((i * 7919U) % TIMEOUT_SPREAD_TICKS));
+}
+
+static void stats_reset(struct cycle_stats *stats)
+{
+	stats->minimum = UINT64_MAX;
+	stats->maximum = 0ULL;
+	stats->total = 0ULL;
+}
+
+static void stats_add(struct cycle_stats *stats, uint64_t cycles)
+{
+	stats->minimum = MIN(stats->minimum, cycles);
+	stats->maximum = MAX(stats->maximum, cycles);
+	stats->total += cycles;
+}
+
+static void report_stats(const struct cycle_stats *stats,
+			 unsigned int num_iterations, const char *str)
+{
+	uint64_t average = stats->total / num_iterations;
+
+	printk("%s\n", str);
+
+	printk("    Minimum : %7llu cycles (%7u nsec)\n",
+	       stats->minimum, (uint32_t)timing_cycles_to_ns(stats->minimum));
+	printk("    Maximum : %7llu cycles (%7u nsec)\n",
+	       stats->maximum, (uint32_t)timing_cycles_to_ns(stats->maximum));
+	printk("    Average : %7llu cycles (%7u nsec)\n",
+	       average, (uint32_t)timing_cycles_to_ns(average));
+}
+
+static void test_queue_depth(unsigned int depth)
+{
+	struct cycle_stats arm;
+	struct cycle_stats cancel;
+	timing_t start;
+	timing_t finish;
+	unsigned int i;
+	char description[80];
+
+	for (i = 0; i < depth; i++) {
+		z_init_timeout(&timeouts[i]);
+		z_add_timeout(&timeouts[i], dummy_handler, spread_timeout(i));
+	}
+
+	stats_reset(&arm);
+	stats_reset(&cancel);
+
+	for (i = 0; i < CONFIG_BENCHMARK_NUM_ITERATIONS; i++) {
+		z_init_timeout(&probe);
+
+		start = timing_counter_get();
+		z_add_timeout(&probe, dummy_handler,
+			      spread_timeout(depth + i));
+		finish = timing_counter_get();
+
+		stats_add(&arm, timing_cycles_get(&start, &finish));
+
+		start = timing_counter_get();
+		z_abort_timeout(&probe);
+		finish = timing_counter_get();
+
+		stats_add(&cancel, timing_cycles_get(&start, &finish));
+	}
+
+	for (i = 0; i < depth; i++) {
+		z_abort_timeout(&timeouts[i]);
+	}
+
+	snprintk(description, sizeof(description),
+		 "Arm timeout with %u outstanding", depth);
+	report_stats(&arm, CONFIG_BENCHMARK_NUM_ITERATIONS, description);
+
+	snprintk(description, sizeof(description),
+		 "Cancel timeout with %u outstanding", depth);
+	report_stats(&cancel, CONFIG_BENCHMARK_NUM_ITERATIONS, description);
+
+	printk("------------------------------------\n");
+}
+
+int main(void)
+{
+	unsigned int freq;
+
+	timing_init();
+
+	freq = timing_freq_get_mhz();
+
+	printk("Time Measurements for %s timeout queue\n",
+	       IS_ENABLED(CONFIG_TIMEOUT_QUEUE_WHEEL) ? "timing wheel" : "dlist");
+	printk("Timing results: Clock frequency: %u MHz\n", freq);
+
+	timing_start();
+
+	for (unsigned int i = 0; i < ARRAY_SIZE(queue_depths); i++) {
+		if (queue_depths[i] <= CONFIG_BENCHMARK_NUM_TIMEOUTS) {
+			test_queue_depth(queue_depths[i]);
+		}
+	}
+
+	timing_stop();
+
+	TC_END_REPORT(0);
+
+	return 0;
+}
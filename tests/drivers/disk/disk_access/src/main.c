@@ -275,6 +275,76 @@ ZTEST(disk_driver, test_write)
 	}
 }
 
+#ifdef CONFIG_DISK_ACCESS_CACHE
+/* Test that the cache serves repeated reads, keeps written sectors until the
+ * disk is synced and then writes consecutive ones back at once.
+ */
+ZTEST(disk_driver, test_cache)
+{
+	struct disk_cache_stats before, after;
+	uint32_t sector = disk_sector_count / 2;
+	int rc, i;
+
+	rc = disk_access_ioctl(disk_pdrv, DISK_IOCTL_CTRL_SYNC, NULL);
+	zassert_equal(rc, 0, "Disk sync failed");
+
+	/* Repeated reads of a sector are served by the cache */
+	rc = read_sector(scratch_buf[0], sector, 1);
+	zassert_equal(rc, 0, "Failed to read from disk");
+	rc = disk_access_cache_stats(disk_pdrv, &before);
+	zassert_equal(rc, 0, "Failed to get the cache statistics");
+	rc = read_sector(scratch_buf[1], sector, 1);
+	zassert_equal(rc, 0, "Failed to read from disk");
+	rc = disk_access_cache_stats(disk_pdrv, &after);
+	zassert_equal(rc, 0, "Failed to get the cache statistics");
+	zassert_equal(after.hits, before.hits + 1, "Sector read again is not a hit");
+	zassert_equal(after.misses, before.misses, "Sector read again is a miss");
+	zassert_mem_equal(scratch_buf[0], scratch_buf[1], disk_sector_size,
+			  "Cached sector does not match");
+
+	/* Writes of single sectors stay in the cache until the disk is synced */
+	for (i = 0; i < 2 * disk_sector_size; i++) {
+		scratch_buf[0][i] = i + 1;
+	}
+
+	before = after;
+	for (i = 0; i < 2; i++) {
+		rc = disk_access_write(disk_pdrv, &scratch_buf[0][i * disk_sector_size],
+				       sector + i, 1);
+		zassert_equal(rc, 0, "Failed to write to disk");
+	}
+
+	rc = disk_access_cache_stats(disk_pdrv, &after);
+	zassert_equal(rc, 0, "Failed to get the cache statistics");
+	zassert_equal(after.write_backs, before.write_backs, "Sectors written back early");
+
+	rc = read_sector(scratch_buf[1], sector - SECTOR_COUNT4 / 2, SECTOR_COUNT4);
+	zassert_equal(rc, 0, "Failed to read from disk");
+	zassert_mem_equal(scratch_buf[0],
+			  &scratch_buf[1][(SECTOR_COUNT4 / 2) * disk_sector_size],
+			  2 * disk_sector_size, "Large read misses the cached sectors");
+
+	rc = disk_access_ioctl(disk_pdrv, DISK_IOCTL_CTRL_SYNC, NULL);
+	zassert_equal(rc, 0, "Disk sync failed");
+	rc = disk_access_cache_stats(disk_pdrv, &after);
+	zassert_equal(rc, 0, "Failed to get the cache statistics");
+	zassert_equal(after.write_backs, before.write_backs + 2, "Sectors not written back");
+	zassert_equal(after.write_calls, before.write_calls + 1, "Sectors not written at once");
+
+	/* The sectors are on the disk once the cache is dropped */
+	rc = disk_access_ioctl(disk_pdrv, DISK_IOCTL_CTRL_DEINIT, NULL);
+	zassert_equal(rc, 0, "Disk deinit failed");
+	rc = disk_access_init(disk_pdrv);
+	zassert_equal(rc, 0, "Disk access initialization failed");
+
+	memset(scratch_buf[1], 0, 2 * disk_sector_size);
+	rc = read_sector(scratch_buf[1], sector, 2);
+	zassert_equal(rc, 0, "Failed to read from disk");
+	zassert_mem_equal(scratch_buf[0], scratch_buf[1], 2 * disk_sector_size,
+			  "Written back data does not match");
+}
+#endif /* CONFIG_DISK_ACCESS_CACHE */
+
 static void *disk_driver_setup(void)
 {
 #ifdef CONFIG_DISK_DRIVER_LOOPBACK
@@ -576,6 +576,60 @@ ZTEST(flash_sim_api, test_get_mock)
 #endif
 }
 
+#ifdef CONFIG_FLASH_RTIO
+RTIO_DEFINE(flash_sim_rtio, 4, 4);
+
+static struct rtio_iodev flash_sim_iodev;
+
+ZTEST(flash_sim_api, test_rtio)
+{
+	uint32_t data[4] = { 0x01234567, 0x89abcdef, 0xfedcba98, 0x76543210 };
+	uint32_t rdata[ARRAY_SIZE(data)] = { 0 };
+	off_t off = FLASH_SIMULATOR_BASE_OFFSET;
+	struct rtio_sqe *sqe;
+	struct rtio_cqe *cqe;
+	int rc;
+
+	flash_iodev_init(&flash_sim_iodev, flash_dev);
+
+	/* Erase, write and read back with chained submissions */
+	sqe = rtio_sqe_acquire(&flash_sim_rtio);
+	flash_sqe_prep_erase(sqe, &flash_sim_iodev, off, FLASH_SIMULATOR_ERASE_UNIT, NULL);
+	sqe->flags |= RTIO_SQE_CHAINED;
+
+	sqe = rtio_sqe_acquire(&flash_sim_rtio);
+	flash_sqe_prep_write(sqe, &flash_sim_iodev, off, data, sizeof(data), NULL);
+	sqe->flags |= RTIO_SQE_CHAINED;
+
+	sqe = rtio_sqe_acquire(&flash_sim_rtio);
+	flash_sqe_prep_read(sqe, &flash_sim_iodev, off, rdata, sizeof(rdata), NULL);
+
+	rc = rtio_submit(&flash_sim_rtio, 3);
+	zassert_equal(0, rc, "rtio_submit should succeed");
+
+	for (int i = 0; i < 3; i++) {
+		cqe = rtio_cqe_consume_block(&flash_sim_rtio);
+		zassert_equal(0, cqe->result, "flash operation %d failed (%d)", i,
+			      cqe->result);
+		rtio_cqe_release(&flash_sim_rtio, cqe);
+	}
+
+	zassert_mem_equal(data, rdata, sizeof(data), "read data does not match");
+
+	/* Errors are reported in the completion */
+	sqe = rtio_sqe_acquire(&flash_sim_rtio);
+	flash_sqe_prep_write(sqe, &flash_sim_iodev, TEST_SIM_FLASH_END, data, sizeof(data),
+			     NULL);
+
+	rc = rtio_submit(&flash_sim_rtio, 1);
+	zassert_equal(0, rc, "rtio_submit should succeed");
+
+	cqe = rtio_cqe_consume_block(&flash_sim_rtio);
+	zassert_equal(-EINVAL, cqe->result, "Unexpected error code (%d)", cqe->result);
+	rtio_cqe_release(&flash_sim_rtio, cqe);
+}
+#endif /* CONFIG_FLASH_RTIO */
+
 void *flash_sim_setup(void)
 {
 	test_init();
@@ -585,6 +585,51 @@ ZTEST_USER(condvar_tests, test_condvar_usecase_broadcast)
 	_condvar_usecase(1);
 }
 
+void condvar_broadcast_waiter(void *p1, void *p2, void *p3)
+{
+	k_mutex_lock(&test_mutex, K_FOREVER);
+	zassert_equal(k_condvar_wait(&simple_condvar, &test_mutex, K_FOREVER), 0,
+		      "k_condvar_wait failed");
+	zassert_equal(test_mutex.owner, k_current_get(), "mutex not held after wait");
+	count++;
+	k_mutex_unlock(&test_mutex);
+}
+
+/**
+ * @brief Test k_condvar_broadcast() with the mutex held by the caller
+ *
+ * Every waiter must return owning the mutex exactly once, whether it was
+ * woken directly or handed the mutex after being requeued onto it.
+ */
+ZTEST(condvar_tests, test_condvar_broadcast_mutex_held)
+{
+	count = 0;
+	k_mutex_init(&test_mutex);
+	k_condvar_init(&simple_condvar);
+
+	for (int i = 0; i < TOTAL_THREADS_WAITING; i++) {
+		k_thread_create(&multiple_tid[i], multiple_stack[i], STACK_SIZE,
+				condvar_broadcast_waiter, NULL, NULL, NULL,
+				PRIO_WAIT, 0, K_NO_WAIT);
+	}
+
+	/* giving time for the waiters to block on the condvar */
+	k_sleep(K_MSEC(10));
+
+	k_mutex_lock(&test_mutex, K_FOREVER);
+	zassert_equal(k_condvar_broadcast(&simple_condvar), TOTAL_THREADS_WAITING,
+		      "not all waiters woken");
+	k_mutex_unlock(&test_mutex);
+
+	for (int i = 0; i < TOTAL_THREADS_WAITING; i++) {
+		k_thread_join(&multiple_tid[i], K_FOREVER);
+	}
+
+	zassert_equal(count, TOTAL_THREADS_WAITING, "waiters did not all run");
+	zassert_is_null(test_mutex.owner, "mutex left locked");
+	zassert_equal(test_mutex.lock_count, 0, "mutex lock count leaked");
+}
+
 /*test case main entry*/
 static void *condvar_tests_setup(void)
 {
@@ -338,3 +338,73 @@ ZTEST(mslab_api, test_mslab_pending)
 	/* Free memory block */
 	k_mem_slab_free(&kmslab, b);
 }
+
+#ifdef CONFIG_MEM_SLAB_PERCPU_CACHE
+static K_THREAD_STACK_DEFINE(cpu_stack, STACKSIZE);
+static struct k_thread cpu_thread;
+static void *cpu_blocks[BLK_NUM];
+
+static void tmslab_alloc_all(void *p1, void *p2, void *p3)
+{
+	for (int i = 0; i < BLK_NUM; i++) {
+		zassert_equal(k_mem_slab_alloc(&mslab, &cpu_blocks[i], K_NO_WAIT), 0,
+			      "Failed to allocate block %d", i);
+	}
+}
+
+static void tmslab_free_all(void *p1, void *p2, void *p3)
+{
+	for (int i = 0; i < BLK_NUM; i++) {
+		k_mem_slab_free(&mslab, cpu_blocks[i]);
+	}
+}
+
+static void run_on_cpu(k_thread_entry_t entry, int cpu)
+{
+	(void)k_thread_create(&cpu_thread, cpu_stack, STACKSIZE,
+			      entry, NULL, NULL, NULL,
+			      K_PRIO_PREEMPT(1), 0, K_FOREVER);
+	zassert_ok(k_thread_cpu_pin(&cpu_thread, cpu), "Failed to pin thread");
+	k_thread_start(&cpu_thread);
+	k_thread_join(&cpu_thread, K_FOREVER);
+}
+
+/**
+ * @brief Verify blocks freed on another CPU are not lost in its cache
+ *
+ * @details Blocks allocated on CPU 0 and freed on CPU 1 stay in the
+ * cache of CPU 1.  They must be reported as free, must not count in the
+ * maximum utilization, and CPU 0 must get all of them back once the
+ * shared free list runs dry.
+ *
+ * @ingroup kernel_memory_slab_tests
+ */
+ZTEST(mslab_api, test_mslab_percpu_cache_cross_cpu)
+{
+	struct sys_memory_stats stats;
+
+#ifdef CONFIG_MEM_SLAB_TRACE_MAX_UTILIZATION
+	zassert_ok(k_mem_slab_runtime_stats_reset_max(&mslab));
+#endif
+
+	for (int round = 0; round < 2; round++) {
+		run_on_cpu(tmslab_alloc_all, 0);
+		zassert_equal(k_mem_slab_num_free_get(&mslab), 0);
+
+		run_on_cpu(tmslab_free_all, 1);
+		zassert_equal(k_mem_slab_num_used_get(&mslab), 0);
+		zassert_equal(k_mem_slab_num_free_get(&mslab), BLK_NUM);
+	}
+
+	zassert_ok(k_mem_slab_runtime_stats_get(&mslab, &stats));
+	zassert_equal(stats.allocated_bytes, 0);
+	zassert_equal(stats.free_bytes, BLK_NUM * BLK_SIZE);
+	zassert_true(stats.cache_refills > 0, "No cache refill counted");
+	zassert_true(stats.cache_flushes > 0, "No cache flush counted");
+
+#ifdef CONFIG_MEM_SLAB_TRACE_MAX_UTILIZATION
+	zassert_equal(k_mem_slab_max_used_get(&mslab), BLK_NUM,
+		      "Cached blocks counted as used");
+#endif
+}
+#endif /* CONFIG_MEM_SLAB_PERCPU_CACHE */
@@ -109,6 +109,72 @@ ZTEST(suite_deadline, test_deadline)
 	}
 }
 
+/**
+ * @brief Validate the order of threads with and without a deadline
+ *
+ * @details Create threads at a single priority and give a deadline to
+ * every other one.  A thread that never had a deadline set counts as
+ * having deadline 0, so all of them must run in the order defined by
+ * comparing their deadlines as the scheduler does, and in creation
+ * order when those are equal.
+ *
+ * @ingroup kernel_sched_tests
+ */
+ZTEST(suite_deadline, test_deadline_mixed)
+{
+	int i;
+
+	n_exec = 0;
+
+	for (i = 0; i < NUM_THREADS; i++) {
+		worker_tids[i] = k_thread_create(&worker_threads[i],
+				worker_stacks[i], STACK_SIZE,
+				worker, INT_TO_POINTER(i), NULL, NULL,
+				K_LOWEST_APPLICATION_THREAD_PRIO,
+				0, K_NO_WAIT);
+	}
+
+	for (i = 0; i < NUM_THREADS; i += 2) {
+		k_thread_deadline_set(&worker_threads[i], (NUM_THREADS - i) * 0x10000);
+	}
+
+	/* The comparison is modular, so it only orders deadlines that
+	 * are all on the same side of 0 as 32 bit signed values.
+	 */
+	for (i = 2; i < NUM_THREADS; i += 2) {
+		if ((worker_threads[i].base.prio_deadline < 0) !=
+		    (worker_threads[0].base.prio_deadline < 0)) {
+			for (i = 0; i < NUM_THREADS; i++) {
+				k_thread_abort(worker_tids[i]);
+			}
+			ztest_test_skip();
+		}
+	}
+
+	zassert_true(n_exec == 0, "threads ran too soon");
+
+	k_sleep(K_MSEC(100));
+
+	zassert_true(n_exec == NUM_THREADS, "not enough threads ran");
+
+	for (i = 1; i < NUM_THREADS; i++) {
+		uint32_t d0 = worker_threads[exec_order[i - 1]].base.prio_deadline;
+		uint32_t d1 = worker_threads[exec_order[i]].base.prio_deadline;
+
+		zassert_true((int32_t)(d1 - d0) >= 0,
+			     "thread %d ran before thread %d", exec_order[i - 1],
+			     exec_order[i]);
+		if (d0 == d1) {
+			zassert_true(exec_order[i - 1] < exec_order[i],
+				     "threads with equal deadlines not in FIFO order");
+		}
+	}
+
+	for (i = 0; i < NUM_THREADS; i++) {
+		k_thread_abort(worker_tids[i]);
+	}
+}
+
 void yield_worker(void *p1, void *p2, void *p3)
 {
 	ARG_UNUSED(p1);
@@ -541,5 +541,70 @@ ZTEST(usage_api, test_thread_stats_usage)
 	k_thread_abort(tid);
 }
 
+#ifdef CONFIG_SCHED_THREAD_USAGE_LATENCY
+#define NUM_WAKEUPS 10
+
+static K_SEM_DEFINE(wake_sem, 0, 1);
+
+static void latency_helper(void *p1, void *p2, void *p3)
+{
+	for (int i = 0; i < NUM_WAKEUPS; i++) {
+		k_sem_take(&wake_sem, K_FOREVER);
+	}
+}
+
+static uint32_t latency_count(const k_thread_runtime_stats_t *stats)
+{
+	uint32_t count = 0U;
+
+	for (unsigned int i = 0; i < ARRAY_SIZE(stats->latency); i++) {
+		count += stats->latency[i];
+	}
+
+	return count;
+}
+
+/**
+ * @brief Test the wakeup to run latency histograms
+ *
+ * A higher priority helper thread is woken up NUM_WAKEUPS times. Each
+ * wakeup must be recorded exactly once in the helper thread histogram,
+ * and in the CPU histogram.
+ */
+ZTEST(usage_api, test_thread_stats_latency)
+{
+	k_tid_t tid;
+	k_thread_runtime_stats_t helper_stats;
+	k_thread_runtime_stats_t cpu_stats1;
+	k_thread_runtime_stats_t cpu_stats2;
+	int priority = k_thread_priority_get(k_current_get()) - 1;
+
+	k_thread_runtime_stats_cpu_get(0, &cpu_stats1);
+
+	/* The helper runs as soon as it is created and pends on the semaphore */
+
+	tid = k_thread_create(&helper_thread, helper_stack,
+			      K_THREAD_STACK_SIZEOF(helper_stack),
+			      latency_helper, NULL, NULL, NULL,
+			      priority, 0, K_NO_WAIT);
+
+	for (int i = 0; i < NUM_WAKEUPS; i++) {
+		k_sem_give(&wake_sem);
+	}
+
+	k_thread_runtime_stats_get(tid, &helper_stats);
+	k_thread_runtime_stats_cpu_get(0, &cpu_stats2);
+
+	/* One switch in after creation, plus one per wakeup */
+
+	zassert_equal(latency_count(&helper_stats), NUM_WAKEUPS + 1);
+	zassert_true(latency_count(&cpu_stats2) - latency_count(&cpu_stats1) >=
+		     NUM_WAKEUPS + 1);
+	zassert_true(cpu_stats2.latency_max >= helper_stats.latency_max);
+
+	k_thread_join(tid, K_FOREVER);
+}
+#endif /* CONFIG_SCHED_THREAD_USAGE_LATENCY */
+
 ZTEST_SUITE(usage_api, NULL, NULL,
 		ztest_simple_1cpu_before, ztest_simple_1cpu_after, NULL);
@@ -0,0 +1,152 @@
+/*
+ * Copyright (c) 2026 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/ztest.h>
+
+#define STACK_SIZE (1024 + CONFIG_TEST_EXTRA_STACK_SIZE)
+#define POOL_PRIORITY K_PRIO_PREEMPT(1)
+
+#define NUM_ITEMS 64
+#define ITEM_BUSY_US 200
+#define NUM_RESUBMITS 8
+
+K_WORK_POOL_STACK_DEFINE(pool_stacks, STACK_SIZE);
+
+static struct k_work_pool pool;
+static struct k_work_pool unstarted_pool;
+
+static struct k_work items[NUM_ITEMS];
+static atomic_t runs[NUM_ITEMS];
+static atomic_t cpus_used;
+
+static struct k_work resubmit_work;
+static atomic_t resubmit_active;
+static atomic_t resubmit_runs;
+static bool resubmit_overlap;
+
+/* Work synchronization objects must be in cache-coherent memory,
+ * which excludes stacks on some architectures.
+ */
+static struct k_work_sync work_sync;
+
+static void item_handler(struct k_work *work)
+{
+	unsigned int idx = (unsigned int)(work - items);
+
+	atomic_inc(&runs[idx]);
+	atomic_or(&cpus_used, BIT(arch_curr_cpu()->id));
+	k_busy_wait(ITEM_BUSY_US);
+}
+
+static void resubmit_handler(struct k_work *work)
+{
+	if (atomic_inc(&resubmit_active) != 0) {
+		resubmit_overlap = true;
+	}
+
+	k_busy_wait(ITEM_BUSY_US);
+
+	if (atomic_inc(&resubmit_runs) < (NUM_RESUBMITS - 1)) {
+		(void)k_work_pool_submit(&pool, work);
+	}
+
+	atomic_dec(&resubmit_active);
+}
+
+/* Every item submitted in a burst from one thread runs exactly once, and
+ * on SMP idle workers steal part of the burst.
+ */
+ZTEST(work_pool, test_burst)
+{
+	for (unsigned int i = 0; i < NUM_ITEMS; i++) {
+		k_work_init(&items[i], item_handler);
+		atomic_clear(&runs[i]);
+	}
+	atomic_clear(&cpus_used);
+
+	for (unsigned int i = 0; i < NUM_ITEMS; i++) {
+		zassert_equal(k_work_pool_submit(&pool, &items[i]), 1);
+	}
+
+	zassert_true(k_work_pool_drain(&pool, false) >= 0);
+
+	for (unsigned int i = 0; i < NUM_ITEMS; i++) {
+		zassert_equal(atomic_get(&runs[i]), 1, "item %u ran %d times",
+			      i, (int)atomic_get(&runs[i]));
+		zassert_false(k_work_is_pending(&items[i]));
+	}
+
+	if (arch_num_cpus() > 1) {
+		zassert_true(POPCOUNT(atomic_get(&cpus_used)) > 1,
+			     "burst was not spread across CPUs");
+	}
+}
+
+/* An item resubmitted by its own handler is never run concurrently. */
+ZTEST(work_pool, test_resubmit_running)
+{
+	k_work_init(&resubmit_work, resubmit_handler);
+	atomic_clear(&resubmit_runs);
+	resubmit_overlap = false;
+
+	/* Keep the other workers busy so they look for work to steal. */
+	for (unsigned int i = 0; i < NUM_ITEMS; i++) {
+		k_work_init(&items[i], item_handler);
+		(void)k_work_pool_submit(&pool, &items[i]);
+	}
+
+	zassert_equal(k_work_pool_submit(&pool, &resubmit_work), 1);
+	zassert_true(k_work_pool_drain(&pool, false) >= 0);
+
+	zassert_equal(atomic_get(&resubmit_runs), NUM_RESUBMITS);
+	zassert_false(resubmit_overlap, "handler re-entered");
+}
+
+/* Flushing an item queued on a pool waits for it to complete. */
+ZTEST(work_pool, test_flush)
+{
+	for (unsigned int i = 0; i < NUM_ITEMS; i++) {
+		k_work_init(&items[i], item_handler);
+		atomic_clear(&runs[i]);
+		zassert_equal(k_work_pool_submit(&pool, &items[i]), 1);
+	}
+
+	for (unsigned int i = 0; i < NUM_ITEMS; i++) {
+		(void)k_work_flush(&items[i], &work_sync);
+		zassert_equal(atomic_get(&runs[i]), 1);
+	}
+}
+
+/* A plugged pool rejects submissions until unplugged. */
+ZTEST(work_pool, test_plug)
+{
+	k_work_init(&items[0], item_handler);
+
+	zassert_equal(k_work_pool_drain(&pool, true), 1);
+	zassert_equal(k_work_pool_submit(&pool, &items[0]), -EBUSY);
+	zassert_equal(k_work_pool_unplug(&pool), 0);
+	zassert_equal(k_work_pool_unplug(&pool), -EALREADY);
+	zassert_equal(k_work_pool_submit(&pool, &items[0]), 1);
+	zassert_true(k_work_pool_drain(&pool, false) >= 0);
+}
+
+ZTEST(work_pool, test_unstarted)
+{
+	k_work_init(&items[0], item_handler);
+
+	zassert_equal(k_work_pool_submit(&unstarted_pool, &items[0]), -ENODEV);
+}
+
+static void *work_pool_setup(void)
+{
+	k_work_pool_start(&pool, pool_stacks[0], STACK_SIZE, POOL_PRIORITY,
+			  &(struct k_work_queue_config){ .name = "pool" });
+
+	return NULL;
+}
+
+ZTEST_SUITE(work_pool, NULL, work_pool_setup, NULL, NULL, NULL);
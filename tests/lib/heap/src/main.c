@@ -45,9 +45,9 @@
  * will increase 16 bytes on 64 bit CPU.
  */
 #ifdef CONFIG_SYS_HEAP_RUNTIME_STATS
-#define SOLO_FREE_HEADER_HEAP_SZ (80)
+#define SOLO_FREE_HEADER_HEAP_SZ (80 + Z_HEAP_SIZE_CLASS_BYTES)
 #else
-#define SOLO_FREE_HEADER_HEAP_SZ (64)
+#define SOLO_FREE_HEADER_HEAP_SZ (64 + Z_HEAP_SIZE_CLASS_BYTES)
 #endif
 
 #define SCRATCH_SZ (sizeof(heapmem) / 2)
@@ -158,6 +158,10 @@ static void log_result(size_t sz, struct z_heap_stress_result *r)
 		 "  avg usage: %d/%d (%d%%)\n",
 		 r->successful_allocs, r->total_allocs, succ_pct,
 		 r->total_frees, avg, (int) sz, avg_pct);
+	TC_PRINT("alloc cycles p50: %u, p99: %u,"
+		 "  largest free: %d (%u%% fragmented)\n",
+		 r->alloc_cycles_p50, r->alloc_cycles_p99,
+		 (int) r->largest_free_bytes, r->fragmentation_percent);
 }
 
 /* Do a heavy test over a small heap, with many iterations that need
@@ -238,6 +242,40 @@ ZTEST(lib_heap, test_big_heap)
 	log_result(BIG_HEAP_SZ, &result);
 }
 
+static void *rawalloc(void *arg, size_t bytes)
+{
+	return sys_heap_alloc(arg, bytes);
+}
+
+static void rawfree(void *arg, void *p)
+{
+	sys_heap_free(arg, p);
+}
+
+/* Same workload as test_small_heap, but without the validation and
+ * fill checks in the callbacks so that the reported alloc latency
+ * reflects the allocator alone.  Run with and without
+ * CONFIG_SYS_HEAP_SIZE_CLASSES to compare the two front ends.
+ */
+ZTEST(lib_heap, test_alloc_latency)
+{
+	struct sys_heap heap;
+	struct z_heap_stress_result result;
+
+	TC_PRINT("Measuring alloc latency on %s (%d byte) heap\n",
+		 IS_ENABLED(CONFIG_SYS_HEAP_SIZE_CLASSES) ?
+		 "size-class" : "bucket", (int) SMALL_HEAP_SZ);
+
+	sys_heap_init(&heap, heapmem, SMALL_HEAP_SZ);
+	sys_heap_stress(rawalloc, rawfree, &heap,
+			SMALL_HEAP_SZ, ITERATION_COUNT,
+			scratchmem, sizeof(scratchmem),
+			50, &result);
+
+	zassert_true(sys_heap_validate(&heap), "");
+	log_result(SMALL_HEAP_SZ, &result);
+}
+
 /* Test a heap with a solo free header.  A solo free header can exist
  * only on a heap with 64 bit CPU (or chunk_header_bytes() == 8).
  * With 64 bytes heap and 1 byte allocation on a big heap, we get:
@@ -485,4 +523,53 @@ ZTEST(lib_heap, test_heap_listeners)
 #endif /* CONFIG_SYS_HEAP_LISTENER */
 }
 
+#ifdef CONFIG_ASSERT
+static volatile bool expect_assert;
+
+#ifdef CONFIG_ASSERT_NO_FILE_INFO
+void assert_post_action(void)
+#else
+void assert_post_action(const char *file, unsigned int line)
+#endif
+{
+#ifndef CONFIG_ASSERT_NO_FILE_INFO
+	ARG_UNUSED(file);
+	ARG_UNUSED(line);
+#endif
+
+	if (expect_assert) {
+		expect_assert = false;
+		ztest_test_pass();
+	} else {
+		k_panic();
+	}
+}
+#endif /* CONFIG_ASSERT */
+
+/* Freeing a block twice must be caught, including when the first free
+ * parked its chunk in a size class instead of returning it to a bucket.
+ */
+ZTEST(lib_heap, test_double_free)
+{
+#ifdef CONFIG_ASSERT
+	struct sys_heap heap;
+	void *p;
+
+	sys_heap_init(&heap, heapmem, SMALL_HEAP_SZ);
+
+	p = sys_heap_alloc(&heap, 8);
+	zassert_not_null(p, "alloc failed");
+
+	sys_heap_free(&heap, p);
+	zassert_true(sys_heap_validate(&heap), "");
+
+	expect_assert = true;
+	sys_heap_free(&heap, p);
+
+	ztest_test_fail();
+#else /* CONFIG_ASSERT */
+	ztest_test_skip();
+#endif /* CONFIG_ASSERT */
+}
+
 ZTEST_SUITE(lib_heap, NULL, NULL, NULL, NULL, NULL);
@@ -14,6 +14,8 @@ LOG_MODULE_REGISTER(test);
 #define DEBUG 0
 #define DBG(...) COND_CODE_1(DEBUG, (printk(__VA_ARGS__)), ())
 
+#define LOCKLESS_FLAG (IS_ENABLED(CONFIG_MPSC_PBUF_LOCKLESS) ? MPSC_PBUF_MODE_LOCKLESS : 0)
+
 static uint32_t buf32[128];
 static struct mpsc_pbuf_buffer mpsc_buffer;
 volatile int test_microdelay_cnt;
@@ -237,7 +239,7 @@ static void stress_test(bool overwrite,
 		.size = ARRAY_SIZE(buf32),
 		.notify_drop = drop,
 		.get_wlen = get_wlen,
-		.flags = overwrite ? MPSC_PBUF_MODE_OVERWRITE : 0
+		.flags = (overwrite ? MPSC_PBUF_MODE_OVERWRITE : 0) | LOCKLESS_FLAG
 	};
 
 	if (CONFIG_SYS_CLOCK_TICKS_PER_SEC < 10000) {
@@ -307,4 +309,96 @@ ZTEST(mpsc_pbuf_concurrent, test_stress_preemptions_high_consumer)
 	stress_test(false, consume, produce, produce, produce);
 }
 
+#if defined(CONFIG_SMP) && (CONFIG_MP_MAX_NUM_CPUS > 1)
+#define CPU_PRODUCERS MIN(CONFIG_MP_MAX_NUM_CPUS, ARRAY_SIZE(data.idx))
+#define CPU_STRESS_MS 2000
+
+static K_THREAD_STACK_ARRAY_DEFINE(cpu_stacks, CPU_PRODUCERS, 1024);
+static struct k_thread cpu_threads[CPU_PRODUCERS];
+static atomic_t cpu_stop;
+
+static void cpu_producer(void *p1, void *p2, void *p3)
+{
+	uint32_t ctx = (uint32_t)(uintptr_t)p2;
+
+	while (!atomic_get(&cpu_stop) && !test_failed) {
+		(void)produce(p1, 0, false, ctx);
+	}
+}
+
+/* Producers spin on every CPU at once while the test thread consumes, so
+ * allocations and commits from different cores truly overlap instead of
+ * only preempting each other. Every produced packet must be consumed or
+ * dropped exactly once.
+ */
+static void cpu_stress_test(bool overwrite)
+{
+	struct mpsc_pbuf_buffer_config config = {
+		.buf = buf32,
+		.size = ARRAY_SIZE(buf32),
+		.notify_drop = drop,
+		.get_wlen = get_wlen,
+		.flags = (overwrite ? MPSC_PBUF_MODE_OVERWRITE : 0) | LOCKLESS_FLAG
+	};
+	int64_t end;
+
+	test_failed = 0;
+	atomic_set(&cpu_stop, 0);
+	memset(track_base_idx, 0, sizeof(track_base_idx));
+	memset(track_mask, 0, sizeof(track_mask));
+	memset(&data, 0, sizeof(data));
+	memset(&mpsc_buffer, 0, sizeof(mpsc_buffer));
+	mpsc_pbuf_init(&mpsc_buffer, &config);
+
+	for (int i = 0; i < CPU_PRODUCERS; i++) {
+		k_thread_create(&cpu_threads[i], cpu_stacks[i],
+				K_THREAD_STACK_SIZEOF(cpu_stacks[i]),
+				cpu_producer, &mpsc_buffer, (void *)(uintptr_t)i, NULL,
+				K_LOWEST_APPLICATION_THREAD_PRIO, 0, K_NO_WAIT);
+	}
+
+	end = k_uptime_get() + CPU_STRESS_MS;
+	while (k_uptime_get() < end && !test_failed) {
+		if (!mpsc_pbuf_is_pending(&mpsc_buffer)) {
+			/* Let producers have every CPU for a while. */
+			k_msleep(1);
+			continue;
+		}
+		(void)consume(&mpsc_buffer, 0, false, 0);
+	}
+
+	atomic_set(&cpu_stop, 1);
+	for (int i = 0; i < CPU_PRODUCERS; i++) {
+		k_thread_join(&cpu_threads[i], K_FOREVER);
+	}
+
+	/* Drain whatever is left, each claim consumes at least one word. */
+	for (int i = 0; i < ARRAY_SIZE(buf32) && mpsc_pbuf_is_pending(&mpsc_buffer); i++) {
+		(void)consume(&mpsc_buffer, 0, false, 0);
+	}
+
+	zassert_false(test_failed, "Test failed with data:%d (line: %d)",
+		      test_failed_cnt, test_failed_line);
+
+	for (int i = 0; i < CPU_PRODUCERS; i++) {
+		for (int j = 0; j < ARRAY_SIZE(track_mask[0]); j++) {
+			zassert_equal(track_mask[i][j], 0,
+				      "Packet from producer %d lost", i);
+		}
+	}
+
+	PRINT("Test report (%s, %d producers):\n",
+	      overwrite ? "overwrite" : "no overwrite", CPU_PRODUCERS);
+	PRINT("\tClaims:%ld, claim misses:%ld\n", data.claim_cnt, data.claim_miss_cnt);
+	PRINT("\tProduced:%ld, allocation failures:%ld\n", data.produce_cnt, data.alloc_fails);
+	PRINT("\tDropped: %ld\n", data.dropped);
+}
+
+ZTEST(mpsc_pbuf_concurrent, test_stress_all_cpus)
+{
+	cpu_stress_test(true);
+	cpu_stress_test(false);
+}
+#endif /* defined(CONFIG_SMP) && (CONFIG_MP_MAX_NUM_CPUS > 1) */
+
 ZTEST_SUITE(mpsc_pbuf_concurrent, NULL, NULL, NULL, NULL, NULL);
@@ -92,6 +92,7 @@ static void init(struct mpsc_pbuf_buffer *buffer, uint32_t wlen, bool overwrite)
 	drop_cnt = 0;
 	exp_drop_cnt = 0;
 	mpsc_buf_cfg.flags = overwrite ? MPSC_PBUF_MODE_OVERWRITE : 0;
+	mpsc_buf_cfg.flags |= IS_ENABLED(CONFIG_MPSC_PBUF_LOCKLESS) ? MPSC_PBUF_MODE_LOCKLESS : 0;
 	mpsc_buf_cfg.size = wlen;
 	mpsc_pbuf_init(buffer, &mpsc_buf_cfg);
 
@@ -1294,5 +1295,75 @@ ZTEST(log_buffer, test_utilization)
 	zassert_true(packet == NULL);
 }
 
+/* Space consumed as skip packets or as packets freed after being
+ * overwritten around must not read as a packet when it is allocated
+ * again. Repeat the preempted allocation check from
+ * test_item_alloc_preemption after the buffer wrapped over such space.
+ */
+ZTEST(log_buffer, test_alloc_preemption_after_skip)
+{
+	struct mpsc_pbuf_buffer buffer;
+	struct mpsc_pbuf_buffer_config config = {
+		.buf = buf32,
+		.size = 32,
+		.notify_drop = ignore_drop,
+		.get_wlen = get_wlen,
+		.flags = MPSC_PBUF_MODE_OVERWRITE |
+			 (IS_ENABLED(CONFIG_MPSC_PBUF_LOCKLESS) ? MPSC_PBUF_MODE_LOCKLESS : 0)
+	};
+	struct test_data_var *claimed;
+	struct test_data_var *p0;
+	struct test_data_var *p1;
+	struct test_data_var *p;
+
+	mpsc_pbuf_init(&buffer, &config);
+
+	for (int i = 0; i < 3 * config.size; i++) {
+		uint32_t len = 1 + (i % 5);
+
+		/* Overwrite around a claimed packet, then free it so that it
+		 * is left behind as a skip packet.
+		 */
+		(void)saturate_buffer_uneven(&buffer, len);
+		claimed = (struct test_data_var *)mpsc_pbuf_claim(&buffer);
+		zassert_true(claimed);
+
+		p = (struct test_data_var *)mpsc_pbuf_alloc(&buffer, len + 1, K_NO_WAIT);
+		zassert_true(p);
+		p->hdr.len = len + 1;
+		mpsc_pbuf_commit(&buffer, (union mpsc_pbuf_generic *)p);
+		mpsc_pbuf_free(&buffer, (union mpsc_pbuf_generic *)claimed);
+
+		while ((p = (struct test_data_var *)mpsc_pbuf_claim(&buffer)) != NULL) {
+			mpsc_pbuf_free(&buffer, (union mpsc_pbuf_generic *)p);
+		}
+
+		/* p1 is committed while p0 is not yet, nothing can be claimed. */
+		p0 = (struct test_data_var *)mpsc_pbuf_alloc(&buffer, len, K_NO_WAIT);
+		zassert_true(p0);
+		p0->hdr.len = len;
+
+		p1 = (struct test_data_var *)mpsc_pbuf_alloc(&buffer, 2, K_NO_WAIT);
+		zassert_true(p1);
+		p1->hdr.len = 2;
+		mpsc_pbuf_commit(&buffer, (union mpsc_pbuf_generic *)p1);
+
+		p = (struct test_data_var *)mpsc_pbuf_claim(&buffer);
+		zassert_is_null(p, "%d: stale packet claimed at %p", i, p);
+
+		mpsc_pbuf_commit(&buffer, (union mpsc_pbuf_generic *)p0);
+
+		p = (struct test_data_var *)mpsc_pbuf_claim(&buffer);
+		zassert_equal(p, p0, "%d: got %p, expected %p", i, p, p0);
+		mpsc_pbuf_free(&buffer, (union mpsc_pbuf_generic *)p);
+
+		p = (struct test_data_var *)mpsc_pbuf_claim(&buffer);
+		zassert_equal(p, p1, "%d: got %p, expected %p", i, p, p1);
+		mpsc_pbuf_free(&buffer, (union mpsc_pbuf_generic *)p);
+
+		zassert_is_null(mpsc_pbuf_claim(&buffer));
+	}
+}
+
 /*test case main entry*/
 ZTEST_SUITE(log_buffer, NULL, NULL, NULL, NULL, NULL);
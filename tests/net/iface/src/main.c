@@ -20,6 +20,7 @@ LOG_MODULE_REGISTER(net_test, NET_LOG_LEVEL);
 #include <zephyr/sys/printk.h>
 #include <zephyr/linker/sections.h>
 #include <zephyr/random/random.h>
+#include <zephyr/sys/hash_function.h>
 
 #include <zephyr/ztest.h>
 
@@ -1000,6 +1001,154 @@ ZTEST(net_iface, test_v6_addr_add_rm_solicited)
 	zassert_is_null(maddr, "Solicited-node multicast address was not removed");
 }
 
+ZTEST(net_iface, test_v6_addr_lookup_same_addr)
+{
+	struct in6_addr addr = { { { 0x20, 0x01, 0x0d, 0xb8, 0, 0, 0x42, 0x42,
+				     0, 0, 0, 0, 0, 0, 0, 0x01 } } };
+	struct net_if *first, *second, *iface;
+	struct net_if_addr *ifaddr;
+	bool ret;
+
+	if (net_if_get_by_iface(iface1) < net_if_get_by_iface(iface2)) {
+		first = iface1;
+		second = iface2;
+	} else {
+		first = iface2;
+		second = iface1;
+	}
+
+	/* Add the address to the interface with the higher index first, the
+	 * lookup must still return the one with the lowest index.
+	 */
+	ifaddr = net_if_ipv6_addr_add(second, &addr, NET_ADDR_MANUAL, 0);
+	zassert_not_null(ifaddr, "Cannot add IPv6 address");
+
+	ifaddr = net_if_ipv6_addr_add(first, &addr, NET_ADDR_MANUAL, 0);
+	zassert_not_null(ifaddr, "Cannot add IPv6 address");
+
+	ifaddr = net_if_ipv6_addr_lookup(&addr, &iface);
+	zassert_not_null(ifaddr, "IPv6 address not found");
+	zassert_equal_ptr(iface, first, "Wrong interface %d",
+			  net_if_get_by_iface(iface));
+
+	ret = net_if_ipv6_addr_rm(first, &addr);
+	zassert_true(ret, "Cannot remove IPv6 address");
+
+	ifaddr = net_if_ipv6_addr_lookup(&addr, &iface);
+	zassert_not_null(ifaddr, "IPv6 address not found");
+	zassert_equal_ptr(iface, second, "Wrong interface %d",
+			  net_if_get_by_iface(iface));
+
+	ret = net_if_ipv6_addr_rm(second, &addr);
+	zassert_true(ret, "Cannot remove IPv6 address");
+
+	ifaddr = net_if_ipv6_addr_lookup(&addr, NULL);
+	zassert_is_null(ifaddr, "IPv6 address found after removal");
+}
+
+#if defined(CONFIG_NET_IF_ADDR_HASH)
+/* Same size as the address table in net_if.c */
+#define ADDR_HASH_SIZE (2 * (CONFIG_NET_IF_MAX_IPV6_COUNT * NET_IF_MAX_IPV6_ADDR + \
+			     CONFIG_NET_IF_MAX_IPV4_COUNT * NET_IF_MAX_IPV4_ADDR) + 1)
+
+static size_t addr_hash_home(const struct in6_addr *addr)
+{
+	return sys_hash32_murmur3(addr, sizeof(*addr)) % ADDR_HASH_SIZE;
+}
+
+/* Return in addr the next address of 2001:db8:4343::/64, starting from
+ * the host part next, whose home slot in the table is home.
+ */
+static void addr_hash_find(struct in6_addr *addr, uint16_t *next, size_t home)
+{
+	static const struct in6_addr prefix = { { { 0x20, 0x01, 0x0d, 0xb8, 0, 0, 0x43, 0x43 } } };
+
+	do {
+		*addr = prefix;
+		addr->s6_addr[14] = *next >> 8;
+		addr->s6_addr[15] = *next & 0xff;
+		(*next)++;
+	} while (addr_hash_home(addr) != home);
+}
+
+static void addr_hash_check(const struct in6_addr *addr, bool found)
+{
+	struct net_if_addr *ifaddr;
+	struct net_if *iface = NULL;
+
+	ifaddr = net_if_ipv6_addr_lookup(addr, &iface);
+	if (!found) {
+		zassert_is_null(ifaddr, "Address %s found after removal",
+				net_sprint_ipv6_addr(addr));
+		return;
+	}
+
+	zassert_not_null(ifaddr, "Address %s not found", net_sprint_ipv6_addr(addr));
+	zassert_mem_equal(&ifaddr->address.in6_addr, addr, sizeof(*addr));
+	zassert_equal_ptr(iface, iface2, "Wrong interface %d", net_if_get_by_iface(iface));
+}
+#endif /* CONFIG_NET_IF_ADDR_HASH */
+
+ZTEST(net_iface, test_v6_addr_hash_collisions)
+{
+#if defined(CONFIG_NET_IF_ADDR_HASH)
+	struct in6_addr addr[4];
+	struct net_if_addr *ifaddr;
+	uint16_t next = 1;
+	size_t home;
+	bool ret;
+
+	/* addr[0], addr[1] and addr[2] have the same home slot. addr[3] has
+	 * the next one, so it is stored after them and has to be moved back
+	 * as they are removed.
+	 */
+	home = 0;
+	addr_hash_find(&addr[0], &next, home);
+	addr_hash_find(&addr[1], &next, home);
+	addr_hash_find(&addr[2], &next, home);
+	addr_hash_find(&addr[3], &next, (home + 1) % ADDR_HASH_SIZE);
+
+	ARRAY_FOR_EACH(addr, i) {
+		ifaddr = net_if_ipv6_addr_add(iface2, &addr[i], NET_ADDR_MANUAL, 0);
+		zassert_not_null(ifaddr, "Cannot add IPv6 address %zu", i);
+	}
+
+	ARRAY_FOR_EACH(addr, i) {
+		addr_hash_check(&addr[i], true);
+	}
+
+	/* Remove the head of the chain */
+	ret = net_if_ipv6_addr_rm(iface2, &addr[0]);
+	zassert_true(ret, "Cannot remove IPv6 address");
+
+	addr_hash_check(&addr[0], false);
+	addr_hash_check(&addr[1], true);
+	addr_hash_check(&addr[2], true);
+	addr_hash_check(&addr[3], true);
+
+	/* Remove an entry in the middle of the chain */
+	ret = net_if_ipv6_addr_rm(iface2, &addr[2]);
+	zassert_true(ret, "Cannot remove IPv6 address");
+
+	addr_hash_check(&addr[1], true);
+	addr_hash_check(&addr[2], false);
+	addr_hash_check(&addr[3], true);
+
+	ret = net_if_ipv6_addr_rm(iface2, &addr[1]);
+	zassert_true(ret, "Cannot remove IPv6 address");
+
+	addr_hash_check(&addr[1], false);
+	addr_hash_check(&addr[3], true);
+
+	ret = net_if_ipv6_addr_rm(iface2, &addr[3]);
+	zassert_true(ret, "Cannot remove IPv6 address");
+
+	addr_hash_check(&addr[3], false);
+#else
+	ztest_test_skip();
+#endif
+}
+
 #define MY_ADDR_V6_USER { { { 0x20, 0x01, 0x0d, 0xb8, 0, 0, 0, 0, \
 			      0, 0, 0, 0, 0, 0, 0, 0x65 } } }
 
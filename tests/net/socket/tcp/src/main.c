@@ -2487,6 +2487,64 @@ ZTEST(net_socket_tcp, test_keepalive_timeout)
 	test_context_cleanup();
 }
 
+ZTEST(net_socket_tcp, test_v4_recv_loan)
+{
+#if defined(CONFIG_NET_SOCKETS_RX_LOAN)
+	int c_sock;
+	int s_sock;
+	int new_sock;
+	struct sockaddr_in c_saddr;
+	struct sockaddr_in s_saddr;
+	struct sockaddr addr;
+	socklen_t addrlen = sizeof(addr);
+	struct zsock_rx_loan loan;
+	struct iovec iov[2];
+	struct msghdr msg;
+	size_t offset = 0;
+	ssize_t ret;
+
+	prepare_sock_tcp_v4(MY_IPV4_ADDR, ANY_PORT, &c_sock, &c_saddr);
+	prepare_sock_tcp_v4(MY_IPV4_ADDR, SERVER_PORT, &s_sock, &s_saddr);
+
+	test_bind(s_sock, (struct sockaddr *)&s_saddr, sizeof(s_saddr));
+	test_listen(s_sock);
+
+	test_connect(c_sock, (struct sockaddr *)&s_saddr, sizeof(s_saddr));
+	test_send(c_sock, TEST_STR_SMALL, strlen(TEST_STR_SMALL), 0);
+
+	test_accept(s_sock, &new_sock, &addr, &addrlen);
+
+	memset(&msg, 0, sizeof(msg));
+	msg.msg_iov = iov;
+	msg.msg_iovlen = ARRAY_SIZE(iov);
+
+	ret = zsock_recv_loan(new_sock, &msg, 0, &loan);
+	zassert_equal(ret, strlen(TEST_STR_SMALL), "recv_loan failed (%d)", -errno);
+
+	for (size_t i = 0; i < msg.msg_iovlen; i++) {
+		zassert_mem_equal(iov[i].iov_base, TEST_STR_SMALL + offset,
+				  iov[i].iov_len, "wrong data");
+		offset += iov[i].iov_len;
+	}
+
+	zassert_equal(offset, strlen(TEST_STR_SMALL), "wrong loaned length");
+	zassert_ok(zsock_recv_loan_release(new_sock, &loan), "release failed");
+
+	test_close(c_sock);
+
+	msg.msg_iovlen = ARRAY_SIZE(iov);
+	ret = zsock_recv_loan(new_sock, &msg, 0, &loan);
+	zassert_equal(ret, 0, "no EOF (%d)", ret);
+
+	test_close(new_sock);
+	test_close(s_sock);
+
+	k_sleep(TCP_TEARDOWN_TIMEOUT);
+#else
+	ztest_test_skip();
+#endif
+}
+
 static void after(void *arg)
 {
 	ARG_UNUSED(arg);
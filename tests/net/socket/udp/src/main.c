@@ -3092,6 +3092,138 @@ ZTEST(net_socket_udp, test_40_clamp_udp_tcp_port_range)
 #endif
 }
 
+ZTEST(net_socket_udp, test_41_v4_sendmmsg_recvmmsg)
+{
+	static const char * const test_msgs[] = { "first", "second", "third" };
+	char rx_bufs[ARRAY_SIZE(test_msgs)][16];
+	struct iovec tx_iov[ARRAY_SIZE(test_msgs)];
+	struct iovec rx_iov[ARRAY_SIZE(test_msgs)];
+	struct mmsghdr tx_msgs[ARRAY_SIZE(test_msgs)];
+	struct mmsghdr rx_msgs[ARRAY_SIZE(test_msgs)];
+	struct sockaddr_in client_addr;
+	struct sockaddr_in server_addr;
+	int client_sock;
+	int server_sock;
+	int rv;
+
+	prepare_sock_udp_v4(MY_IPV4_ADDR, ANY_PORT, &client_sock, &client_addr);
+	prepare_sock_udp_v4(MY_IPV4_ADDR, SERVER_PORT, &server_sock, &server_addr);
+
+	rv = zsock_bind(server_sock, (struct sockaddr *)&server_addr,
+			sizeof(server_addr));
+	zassert_equal(rv, 0, "server bind failed");
+
+	memset(tx_msgs, 0, sizeof(tx_msgs));
+	memset(rx_msgs, 0, sizeof(rx_msgs));
+
+	for (int i = 0; i < ARRAY_SIZE(test_msgs); i++) {
+		tx_iov[i].iov_base = (void *)test_msgs[i];
+		tx_iov[i].iov_len = strlen(test_msgs[i]);
+		tx_msgs[i].msg_hdr.msg_iov = &tx_iov[i];
+		tx_msgs[i].msg_hdr.msg_iovlen = 1;
+		tx_msgs[i].msg_hdr.msg_name = &server_addr;
+		tx_msgs[i].msg_hdr.msg_namelen = sizeof(server_addr);
+
+		rx_iov[i].iov_base = rx_bufs[i];
+		rx_iov[i].iov_len = sizeof(rx_bufs[i]);
+		rx_msgs[i].msg_hdr.msg_iov = &rx_iov[i];
+		rx_msgs[i].msg_hdr.msg_iovlen = 1;
+	}
+
+	rv = zsock_sendmmsg(client_sock, tx_msgs, ARRAY_SIZE(tx_msgs), 0);
+	zassert_equal(rv, ARRAY_SIZE(tx_msgs), "sendmmsg failed (%d)", -errno);
+
+	rv = zsock_recvmmsg(server_sock, rx_msgs, ARRAY_SIZE(rx_msgs), 0, NULL);
+	zassert_equal(rv, ARRAY_SIZE(rx_msgs), "recvmmsg failed (%d)", -errno);
+
+	for (int i = 0; i < ARRAY_SIZE(test_msgs); i++) {
+		zassert_equal(tx_msgs[i].msg_len, strlen(test_msgs[i]),
+			      "invalid sent length");
+		zassert_equal(rx_msgs[i].msg_len, strlen(test_msgs[i]),
+			      "invalid received length");
+		zassert_mem_equal(rx_bufs[i], test_msgs[i], strlen(test_msgs[i]),
+				  "wrong data");
+	}
+
+	/* With MSG_WAITFORONE only the first message is waited for */
+	rv = zsock_sendmmsg(client_sock, tx_msgs, 1, 0);
+	zassert_equal(rv, 1, "sendmmsg failed (%d)", -errno);
+
+	rv = zsock_recvmmsg(server_sock, rx_msgs, ARRAY_SIZE(rx_msgs),
+			    ZSOCK_MSG_WAITFORONE, NULL);
+	zassert_equal(rv, 1, "recvmmsg returned %d", rv);
+	zassert_equal(rx_msgs[0].msg_len, strlen(test_msgs[0]),
+		      "invalid received length");
+
+	/* Nothing left to receive */
+	rv = zsock_recvmmsg(server_sock, rx_msgs, ARRAY_SIZE(rx_msgs),
+			    ZSOCK_MSG_DONTWAIT, NULL);
+	zassert_equal(rv, -1, "recvmmsg succeeded");
+	zassert_equal(errno, EAGAIN, "unexpected errno %d", errno);
+
+	rv = zsock_close(client_sock);
+	zassert_equal(rv, 0, "close failed");
+	rv = zsock_close(server_sock);
+	zassert_equal(rv, 0, "close failed");
+}
+
+ZTEST(net_socket_udp, test_42_v4_recv_loan)
+{
+#if defined(CONFIG_NET_SOCKETS_RX_LOAN)
+	struct sockaddr_in client_addr;
+	struct sockaddr_in server_addr;
+	struct sockaddr_in src_addr;
+	struct zsock_rx_loan loan;
+	struct iovec iov[1];
+	struct msghdr msg;
+	int client_sock;
+	int server_sock;
+	ssize_t ret;
+
+	prepare_sock_udp_v4(MY_IPV4_ADDR, ANY_PORT, &client_sock, &client_addr);
+	prepare_sock_udp_v4(MY_IPV4_ADDR, SERVER_PORT, &server_sock, &server_addr);
+
+	ret = zsock_bind(server_sock, (struct sockaddr *)&server_addr,
+			 sizeof(server_addr));
+	zassert_equal(ret, 0, "server bind failed");
+
+	ret = zsock_sendto(client_sock, TEST_STR_SMALL, strlen(TEST_STR_SMALL), 0,
+			   (struct sockaddr *)&server_addr, sizeof(server_addr));
+	zassert_equal(ret, strlen(TEST_STR_SMALL), "sendto failed");
+
+	memset(&msg, 0, sizeof(msg));
+	msg.msg_iov = iov;
+	msg.msg_iovlen = ARRAY_SIZE(iov);
+	msg.msg_name = &src_addr;
+	msg.msg_namelen = sizeof(src_addr);
+
+	ret = zsock_recv_loan(server_sock, &msg, 0, &loan);
+	zassert_equal(ret, strlen(TEST_STR_SMALL), "recv_loan failed (%d)", -errno);
+	zassert_equal(msg.msg_iovlen, 1, "wrong number of buffers");
+	zassert_equal(iov[0].iov_len, strlen(TEST_STR_SMALL), "wrong length");
+	zassert_mem_equal(iov[0].iov_base, TEST_STR_SMALL, strlen(TEST_STR_SMALL),
+			  "wrong data");
+	zassert_equal(msg.msg_namelen, sizeof(struct sockaddr_in), "wrong addrlen");
+	zassert_equal(src_addr.sin_family, AF_INET, "wrong family");
+
+	ret = zsock_recv_loan_release(server_sock, &loan);
+	zassert_equal(ret, 0, "release failed");
+
+	/* Nothing left to loan */
+	msg.msg_iovlen = ARRAY_SIZE(iov);
+	ret = zsock_recv_loan(server_sock, &msg, ZSOCK_MSG_DONTWAIT, &loan);
+	zassert_equal(ret, -1, "recv_loan succeeded");
+	zassert_equal(errno, EAGAIN, "unexpected errno %d", errno);
+
+	ret = zsock_close(client_sock);
+	zassert_equal(ret, 0, "close failed");
+	ret = zsock_close(server_sock);
+	zassert_equal(ret, 0, "close failed");
+#else
+	ztest_test_skip();
+#endif
+}
+
 static void after(void *arg)
 {
 	ARG_UNUSED(arg);
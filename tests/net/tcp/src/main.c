@@ -114,6 +114,9 @@ static enum test_case_no {
 	TEST_CLIENT_CLOSING_FAILURE_IPV6 = 16,
 	TEST_CLIENT_FIN_WAIT_2_IPV4_FAILURE = 17,
 	TEST_CLIENT_FIN_ACK_WITH_DATA = 18,
+	TEST_CLIENT_SACK_LOSS = 19,
+	TEST_SERVER_GRO_IPV4 = 20,
+	TEST_CLIENT_GSO_IPV4 = 21,
 } test_case_no;
 
 static enum test_state t_state;
@@ -138,6 +141,9 @@ static void handle_server_rst_on_closed_port(sa_family_t af, struct tcphdr *th);
 static void handle_server_rst_on_listening_port(sa_family_t af, struct tcphdr *th);
 static void handle_syn_invalid_ack(sa_family_t af, struct tcphdr *th);
 static void handle_client_fin_ack_with_data_test(sa_family_t af, struct tcphdr *th);
+static void handle_client_sack_loss_test(struct net_pkt *pkt, struct tcphdr *th);
+static void handle_server_gro_test(sa_family_t af, struct tcphdr *th);
+static void handle_client_gso_test(struct net_pkt *pkt, struct tcphdr *th);
 
 static void verify_flags(struct tcphdr *th, uint8_t flags,
 			 const char *fun, int line)
@@ -490,6 +496,15 @@ static int tester_send(const struct device *dev, struct net_pkt *pkt)
 	case TEST_CLIENT_FIN_ACK_WITH_DATA:
 		handle_client_fin_ack_with_data_test(net_pkt_family(pkt), &th);
 		break;
+	case TEST_CLIENT_SACK_LOSS:
+		handle_client_sack_loss_test(pkt, &th);
+		break;
+	case TEST_SERVER_GRO_IPV4:
+		handle_server_gro_test(net_pkt_family(pkt), &th);
+		break;
+	case TEST_CLIENT_GSO_IPV4:
+		handle_client_gso_test(pkt, &th);
+		break;
 
 	default:
 		zassert_true(false, "Undefined test case");
@@ -706,6 +721,35 @@ ZTEST(net_tcp, test_client_ipv6)
 	k_sleep(K_MSEC(CONFIG_NET_TCP_TIME_WAIT_DELAY));
 }
 
+static struct net_context *accepted_ctx;
+
+/* The window of a segment sent after the handshake must be shifted by
+ * the count we announced, and that count is only non-zero when the
+ * peer offered window scaling too. Otherwise the window is clamped.
+ */
+static void test_verify_window(struct tcphdr *th)
+{
+	struct tcp *conn = accepted_ctx->tcp;
+	uint8_t shift = 0U;
+
+#ifdef CONFIG_NET_TCP_WINDOW_SCALE
+	shift = conn->recv_wscale;
+
+	if (test_case_no == TEST_SERVER_WITH_OPTIONS_IPV4) {
+		zassert_equal(shift > 0U, CONFIG_NET_TCP_MAX_RECV_WINDOW_SIZE > UINT16_MAX,
+			      "unexpected window scale %u", shift);
+	} else {
+		zassert_equal(shift, 0U, "window scaled without the peer's option");
+	}
+#endif /* CONFIG_NET_TCP_WINDOW_SCALE */
+
+	zassert_true(conn->recv_win_max <= ((uint32_t)UINT16_MAX << shift),
+		     "receive window %u not clamped", conn->recv_win_max);
+	zassert_equal(ntohs(th->th_win), MIN(conn->recv_win >> shift, UINT16_MAX),
+		      "advertised window %u does not match %u >> %u",
+		      ntohs(th->th_win), conn->recv_win, shift);
+}
+
 static void handle_server_test(sa_family_t af, struct tcphdr *th)
 {
 	struct net_pkt *reply;
@@ -719,6 +763,15 @@ static void handle_server_test(sa_family_t af, struct tcphdr *th)
 		break;
 	case T_SYN_ACK:
 		test_verify_flags(th, SYN | ACK);
+		if (test_case_no == TEST_SERVER_WITH_OPTIONS_IPV4) {
+			/* MSS, plus window scale and SACK-permitted as the
+			 * peer offered both
+			 */
+			zassert_equal(th->th_off,
+				      6U + IS_ENABLED(CONFIG_NET_TCP_WINDOW_SCALE) +
+				      IS_ENABLED(CONFIG_NET_TCP_SACK),
+				      "unexpected SYN-ACK options");
+		}
 		seq++;
 		ack = ntohl(th->th_seq) + 1U;
 		reply = prepare_ack_packet(af, htons(MY_PORT),
@@ -732,6 +785,7 @@ static void handle_server_test(sa_family_t af, struct tcphdr *th)
 		break;
 	case T_DATA_ACK:
 		test_verify_flags(th, ACK);
+		test_verify_window(th);
 		seq++;
 		reply = prepare_fin_ack_packet(af, htons(MY_PORT),
 					       htons(PEER_PORT));
@@ -792,8 +846,6 @@ static void test_tcp_recv_cb(struct net_context *context,
 	}
 }
 
-static struct net_context *accepted_ctx;
-
 static void test_tcp_accept_cb(struct net_context *ctx,
 			       struct sockaddr *addr,
 			       socklen_t addrlen,
@@ -2602,4 +2654,638 @@ ZTEST(net_tcp, test_client_fin_ack_with_data)
 	}
 }
 
+#define GRO_SEG_LEN 100
+#define GRO_SEGS 4
+
+static uint8_t gro_data[GRO_SEG_LEN * GRO_SEGS];
+static size_t gro_data_len;
+static int gro_data_pkts;
+
+static void handle_server_gro_test(sa_family_t af, struct tcphdr *th)
+{
+	struct net_pkt *reply;
+
+	switch (t_state) {
+	case T_SYN_ACK:
+		test_verify_flags(th, SYN | ACK);
+		seq++;
+		ack = ntohl(th->th_seq) + 1U;
+		reply = prepare_ack_packet(af, htons(MY_PORT), htons(PEER_PORT));
+		t_state = T_DATA;
+		break;
+	case T_DATA:
+		/* ACKs of the data */
+		return;
+	case T_FIN:
+		if (!(th->th_flags & FIN)) {
+			return;
+		}
+
+		test_verify_flags(th, FIN | ACK);
+		ack++;
+		reply = prepare_ack_packet(af, htons(MY_PORT), htons(PEER_PORT));
+		t_state = T_FIN_ACK;
+		break;
+	case T_FIN_ACK:
+		return;
+	default:
+		zassert_true(false, "%s: unexpected state", __func__);
+		return;
+	}
+
+	zassert_not_null(reply, "Failed to prepare reply");
+	zassert_ok(net_recv_data(net_iface, reply), "%s failed", __func__);
+}
+
+static void test_gro_recv_cb(struct net_context *context,
+			     struct net_pkt *pkt,
+			     union net_ip_header *ip_hdr,
+			     union net_proto_header *proto_hdr,
+			     int status,
+			     void *user_data)
+{
+	size_t len;
+
+	if (pkt == NULL) {
+		return;
+	}
+
+	len = net_pkt_remaining_data(pkt);
+	zassert_true(gro_data_len + len <= sizeof(gro_data), "too much data");
+	zassert_ok(net_pkt_read(pkt, gro_data + gro_data_len, len), "read failed");
+
+	gro_data_len += len;
+	gro_data_pkts++;
+
+	net_pkt_unref(pkt);
+
+	if (gro_data_len == sizeof(gro_data)) {
+		test_sem_give();
+	}
+}
+
+/* Test case scenario IPv4
+ *   send SYN, expect SYN ACK, send ACK,
+ *   send GRO_SEGS in-order data segments back to back, PSH on the last,
+ *   expect fewer packets than segments at the application with the
+ *   payload intact,
+ *   send FIN ACK, expect FIN ACK, send ACK.
+ */
+ZTEST(net_tcp, test_server_gro_ipv4)
+{
+	struct net_context *ctx;
+	struct net_pkt *pkt;
+
+	if (!IS_ENABLED(CONFIG_NET_TCP_GRO)) {
+		ztest_test_skip();
+	}
+
+	t_state = T_SYN_ACK;
+	test_case_no = TEST_SERVER_GRO_IPV4;
+	seq = ack = 0;
+	gro_data_len = 0;
+	gro_data_pkts = 0;
+
+	zassert_ok(net_context_get(AF_INET, SOCK_STREAM, IPPROTO_TCP, &ctx),
+		   "Failed to get net_context");
+
+	net_context_ref(ctx);
+
+	zassert_ok(net_context_bind(ctx, (struct sockaddr *)&my_addr_s,
+				    sizeof(struct sockaddr_in)),
+		   "Failed to bind net_context");
+	zassert_ok(net_context_listen(ctx, 1), "Failed to listen on net_context");
+	zassert_ok(net_context_accept(ctx, test_tcp_accept_cb, K_FOREVER, NULL),
+		   "Failed to set accept on net_context");
+
+	pkt = prepare_syn_packet(AF_INET, htons(MY_PORT), htons(PEER_PORT));
+	zassert_not_null(pkt, "Failed to prepare SYN");
+	zassert_ok(net_recv_data(net_iface, pkt), "Failed to send SYN");
+
+	test_sem_take(K_MSEC(100), __LINE__);
+
+	zassert_ok(net_context_recv(accepted_ctx, test_gro_recv_cb, K_NO_WAIT, NULL),
+		   "Failed to recv data from peer");
+
+	/* This thread is cooperative, so all the segments are queued before
+	 * the RX thread gets to look at the first one.
+	 */
+	for (int i = 0; i < GRO_SEGS; i++) {
+		pkt = tester_prepare_tcp_pkt(AF_INET, htons(MY_PORT), htons(PEER_PORT),
+					     i == GRO_SEGS - 1 ? PSH | ACK : ACK,
+					     (const uint8_t *)lorem_ipsum + i * GRO_SEG_LEN,
+					     GRO_SEG_LEN);
+		zassert_not_null(pkt, "Failed to prepare data");
+		zassert_ok(net_recv_data(net_iface, pkt), "Failed to send data");
+		seq += GRO_SEG_LEN;
+	}
+
+	test_sem_take(K_MSEC(100), __LINE__);
+
+	zassert_true(gro_data_pkts < GRO_SEGS, "%d segments were not merged",
+		     gro_data_pkts);
+	zassert_mem_equal(gro_data, lorem_ipsum, sizeof(gro_data), "payload corrupted");
+
+	t_state = T_FIN;
+	pkt = prepare_fin_ack_packet(AF_INET, htons(MY_PORT), htons(PEER_PORT));
+	zassert_not_null(pkt, "Failed to prepare FIN");
+	zassert_ok(net_recv_data(net_iface, pkt), "Failed to send FIN");
+	seq++;
+
+	/* Let the receiving thread run */
+	k_msleep(50);
+
+	zassert_equal(t_state, T_FIN_ACK, "connection not closed");
+
+	net_context_put(ctx);
+	net_context_put(accepted_ctx);
+}
+
+/* Packet loss harness. The device sends SACK_LOSS_DATA_LEN bytes to a peer
+ * that drops the first transmission of two segments in every eight, and
+ * acknowledges everything else like a receiver that keeps out-of-order
+ * data. When SACK was negotiated, its ACKs carry SACK blocks.
+ */
+#define SACK_LOSS_MSS 64
+#define SACK_LOSS_SEGS 32
+#define SACK_LOSS_DATA_LEN (SACK_LOSS_MSS * SACK_LOSS_SEGS)
+#define SACK_LOSS_WINDOW (8 * SACK_LOSS_MSS)
+#define SACK_LOSS_DROP(_slot) ((((_slot) % 8) == 1) || (((_slot) % 8) == 4))
+
+struct sack_loss_result {
+	uint32_t sent;      /* Data bytes sent by the device */
+	uint32_t dropped;   /* Data bytes dropped by the peer */
+	uint32_t duplicate; /* Data bytes the peer already had */
+	uint32_t recovered; /* Dropped bytes resent during SACK recovery */
+	int64_t elapsed_ms;
+};
+
+static bool sack_loss_peer_sack;
+static struct tcp *sack_loss_conn;
+static uint32_t sack_loss_isn;
+static uint32_t sack_loss_cum;
+static uint32_t sack_loss_dropped_slots;
+static int64_t sack_loss_start;
+static struct sack_loss_result sack_loss_res;
+static ATOMIC_DEFINE(sack_loss_rcvd, SACK_LOSS_DATA_LEN);
+
+static struct net_pkt *prepare_sack_loss_pkt(uint16_t dst_port, uint8_t flags,
+					     const uint8_t *opts, size_t opts_len)
+{
+	NET_PKT_DATA_ACCESS_DEFINE(tcp_access, struct tcphdr);
+	struct net_pkt *pkt;
+	struct tcphdr *th;
+
+	pkt = net_pkt_alloc_with_buffer(net_iface, sizeof(struct tcphdr) + opts_len,
+					AF_INET, IPPROTO_TCP, K_NO_WAIT);
+	if (!pkt) {
+		return NULL;
+	}
+
+	if (net_ipv4_create(pkt, &peer_addr, &my_addr) < 0) {
+		goto fail;
+	}
+
+	th = (struct tcphdr *)net_pkt_get_data(pkt, &tcp_access);
+	if (!th) {
+		goto fail;
+	}
+
+	memset(th, 0U, sizeof(struct tcphdr));
+
+	th->th_sport = htons(MY_PORT);
+	th->th_dport = dst_port;
+	th->th_off = 5U + opts_len / 4U;
+	th->th_flags = flags;
+	th->th_win = htons(SACK_LOSS_WINDOW);
+	th->th_seq = htonl(seq);
+
+	if (ACK & flags) {
+		th->th_ack = htonl(ack);
+	}
+
+	if (net_pkt_set_data(pkt, &tcp_access) < 0 ||
+	    (opts_len && net_pkt_write(pkt, opts, opts_len) < 0)) {
+		goto fail;
+	}
+
+	net_pkt_cursor_init(pkt);
+
+	if (net_ipv4_finalize(pkt, IPPROTO_TCP) < 0) {
+		goto fail;
+	}
+
+	return pkt;
+fail:
+	net_pkt_unref(pkt);
+	return NULL;
+}
+
+/* SACK blocks for everything received above the cumulative ACK. As
+ * RFC 2018 asks, the first block holds the most recent segment.
+ */
+static size_t sack_loss_blocks(uint8_t *opts, uint32_t recent)
+{
+	struct tcp_sack_block blocks[NET_TCP_SACK_MAX_BLOCKS];
+	struct tcp_sack_block tmp;
+	uint32_t i = sack_loss_cum;
+	int cnt = 0;
+
+	while (cnt < NET_TCP_SACK_MAX_BLOCKS) {
+		while (i < SACK_LOSS_DATA_LEN && !atomic_test_bit(sack_loss_rcvd, i)) {
+			i++;
+		}
+
+		if (i == SACK_LOSS_DATA_LEN) {
+			break;
+		}
+
+		blocks[cnt].start = i;
+
+		while (i < SACK_LOSS_DATA_LEN && atomic_test_bit(sack_loss_rcvd, i)) {
+			i++;
+		}
+
+		blocks[cnt].end = i;
+
+		if (cnt > 0 && recent >= blocks[cnt].start && recent < blocks[cnt].end) {
+			tmp = blocks[0];
+			blocks[0] = blocks[cnt];
+			blocks[cnt] = tmp;
+		}
+
+		cnt++;
+	}
+
+	if (cnt == 0) {
+		return 0;
+	}
+
+	opts[0] = NET_TCP_NOP_OPT;
+	opts[1] = NET_TCP_NOP_OPT;
+	opts[2] = NET_TCP_SACK_OPT;
+	opts[3] = 2 + cnt * NET_TCP_SACK_BLOCK_SIZE;
+
+	for (int j = 0; j < cnt; j++) {
+		uint8_t *blk = &opts[4 + j * NET_TCP_SACK_BLOCK_SIZE];
+
+		UNALIGNED_PUT(htonl(sack_loss_isn + blocks[j].start), (uint32_t *)blk);
+		UNALIGNED_PUT(htonl(sack_loss_isn + blocks[j].end), (uint32_t *)(blk + 4));
+	}
+
+	return 4 + cnt * NET_TCP_SACK_BLOCK_SIZE;
+}
+
+static void handle_client_sack_loss_test(struct net_pkt *pkt, struct tcphdr *th)
+{
+	uint8_t opts[4 + NET_TCP_SACK_MAX_BLOCKS * NET_TCP_SACK_BLOCK_SIZE];
+	size_t opts_len = 0;
+	struct net_pkt *reply;
+	bool done = false;
+	uint32_t slot;
+	uint32_t rel;
+	uint32_t len;
+
+	if (th->th_flags & SYN) {
+		/* MSS, window scale and SACK-permitted as configured */
+		zassert_equal(th->th_off,
+			      6U + IS_ENABLED(CONFIG_NET_TCP_WINDOW_SCALE) +
+			      IS_ENABLED(CONFIG_NET_TCP_SACK),
+			      "unexpected SYN options");
+
+		sack_loss_isn = ntohl(th->th_seq) + 1U;
+		seq = 0U;
+		ack = sack_loss_isn;
+
+		opts[opts_len++] = NET_TCP_MSS_OPT;
+		opts[opts_len++] = NET_TCP_MSS_SIZE;
+		opts[opts_len++] = SACK_LOSS_MSS >> 8;
+		opts[opts_len++] = SACK_LOSS_MSS & 0xff;
+
+		if (sack_loss_peer_sack) {
+			opts[opts_len++] = NET_TCP_NOP_OPT;
+			opts[opts_len++] = NET_TCP_NOP_OPT;
+			opts[opts_len++] = NET_TCP_SACK_PERM_OPT;
+			opts[opts_len++] = NET_TCP_SACK_PERM_SIZE;
+		}
+
+		reply = prepare_sack_loss_pkt(th->th_sport, SYN | ACK, opts, opts_len);
+		seq++;
+		goto send;
+	}
+
+	if (th->th_flags & FIN) {
+		ack = ntohl(th->th_seq) + 1U;
+		reply = prepare_sack_loss_pkt(th->th_sport, FIN | ACK, NULL, 0);
+		seq++;
+		goto send;
+	}
+
+	len = net_pkt_get_len(pkt) - net_pkt_ip_hdr_len(pkt) -
+	      net_pkt_ip_opts_len(pkt) - th->th_off * 4U;
+	if (len == 0U) {
+		return;
+	}
+
+	/* The options count in the MSS, and the peer MSS must hold for the
+	 * whole connection, whatever the options of its ACKs.
+	 */
+	zassert_true(len + th->th_off * 4U - sizeof(struct tcphdr) <= SACK_LOSS_MSS,
+		     "segment of %u bytes above the MSS", len);
+
+	rel = ntohl(th->th_seq) - sack_loss_isn;
+	zassert_true(rel + len <= SACK_LOSS_DATA_LEN, "data beyond the transfer");
+
+	sack_loss_res.sent += len;
+
+	slot = rel / SACK_LOSS_MSS;
+	if (SACK_LOSS_DROP(slot) && !(sack_loss_dropped_slots & BIT(slot))) {
+		sack_loss_dropped_slots |= BIT(slot);
+		sack_loss_res.dropped += len;
+		return;
+	}
+
+#ifdef CONFIG_NET_TCP_SACK
+	if ((sack_loss_dropped_slots & BIT(slot)) && sack_loss_conn != NULL &&
+	    sack_loss_conn->sack_recovery) {
+		sack_loss_res.recovered += len;
+	}
+#endif
+
+	for (uint32_t i = rel; i < rel + len; i++) {
+		if (atomic_test_and_set_bit(sack_loss_rcvd, i)) {
+			sack_loss_res.duplicate++;
+		}
+	}
+
+	while (sack_loss_cum < SACK_LOSS_DATA_LEN &&
+	       atomic_test_bit(sack_loss_rcvd, sack_loss_cum)) {
+		sack_loss_cum++;
+	}
+
+	ack = sack_loss_isn + sack_loss_cum;
+
+	if (sack_loss_peer_sack) {
+		opts_len = sack_loss_blocks(opts, rel);
+	}
+
+	reply = prepare_sack_loss_pkt(th->th_sport, ACK, opts, opts_len);
+
+	if (sack_loss_cum == SACK_LOSS_DATA_LEN && sack_loss_res.elapsed_ms == 0) {
+		sack_loss_res.elapsed_ms = MAX(k_uptime_get() - sack_loss_start, 1);
+		done = true;
+	}
+send:
+	zassert_not_null(reply, "Failed to prepare reply");
+	zassert_ok(net_recv_data(net_iface, reply), "%s failed", __func__);
+
+	if (done) {
+		test_sem_give();
+	}
+}
+
+static void sack_loss_run(bool peer_sack, struct sack_loss_result *res)
+{
+	struct net_context *ctx;
+	uint32_t queued = 0U;
+	int ret;
+
+	test_case_no = TEST_CLIENT_SACK_LOSS;
+	/* The peer only answers a SACK-permitted option */
+	sack_loss_peer_sack = peer_sack && IS_ENABLED(CONFIG_NET_TCP_SACK);
+	sack_loss_cum = 0U;
+	sack_loss_dropped_slots = 0U;
+	memset(&sack_loss_res, 0, sizeof(sack_loss_res));
+	memset(sack_loss_rcvd, 0, sizeof(sack_loss_rcvd));
+	sack_loss_conn = NULL;
+	seq = ack = 0;
+
+	zassert_ok(net_context_get(AF_INET, SOCK_STREAM, IPPROTO_TCP, &ctx),
+		   "Failed to get net_context");
+
+	net_context_ref(ctx);
+
+	zassert_ok(net_context_connect(ctx, (struct sockaddr *)&peer_addr_s,
+				       sizeof(struct sockaddr_in), NULL,
+				       K_MSEC(1000), NULL),
+		   "Failed to connect to peer");
+
+#ifdef CONFIG_NET_TCP_SACK
+	zassert_equal(((struct tcp *)ctx->tcp)->sack_permitted, sack_loss_peer_sack,
+		      "SACK negotiation failed");
+#endif
+
+	sack_loss_conn = ctx->tcp;
+	sack_loss_start = k_uptime_get();
+
+	while (queued < SACK_LOSS_DATA_LEN) {
+		ret = net_context_send(ctx, lorem_ipsum + (queued % 1024U),
+				       MIN(SACK_LOSS_MSS, SACK_LOSS_DATA_LEN - queued),
+				       NULL, K_NO_WAIT, NULL);
+		if (ret == -EAGAIN) {
+			k_msleep(1);
+			continue;
+		}
+
+		zassert_true(ret > 0, "Failed to send data (%d)", ret);
+		queued += ret;
+	}
+
+	test_sem_take(K_SECONDS(5), __LINE__);
+
+	*res = sack_loss_res;
+
+	sack_loss_conn = NULL;
+	net_context_put(ctx);
+
+	/* Connection is in TIME_WAIT state, context will be released
+	 * after K_MSEC(CONFIG_NET_TCP_TIME_WAIT_DELAY), so wait for it.
+	 */
+	k_sleep(K_MSEC(CONFIG_NET_TCP_TIME_WAIT_DELAY));
+}
+
+static void sack_loss_report(const char *name, const struct sack_loss_result *res)
+{
+	TC_PRINT("%s: sent %u dropped %u duplicate %u bytes in %u ms, "
+		 "goodput %u B/s\n", name, res->sent, res->dropped,
+		 res->duplicate, (uint32_t)res->elapsed_ms,
+		 (uint32_t)(SACK_LOSS_DATA_LEN * MSEC_PER_SEC / res->elapsed_ms));
+}
+
+/* Test case scenario IPv4
+ *   connect, send SACK_LOSS_DATA_LEN bytes to a peer dropping two
+ *   segments in every eight and close, first with a peer that does not
+ *   offer SACK, then with one that does.
+ *   With SACK the device must resend the lost segments from SACK recovery,
+ *   and must not send more data again, nor repeat more data the peer
+ *   already holds.
+ *   Goodput of both runs is printed for comparison.
+ */
+ZTEST(net_tcp, test_client_sack_loss)
+{
+	struct sack_loss_result plain;
+	struct sack_loss_result sack;
+
+	sack_loss_run(false, &plain);
+	sack_loss_report("without SACK", &plain);
+
+	sack_loss_run(true, &sack);
+	sack_loss_report("with SACK", &sack);
+
+	zassert_true(plain.dropped > 0U && sack.dropped > 0U, "no segment was dropped");
+
+	if (!IS_ENABLED(CONFIG_NET_TCP_SACK)) {
+		return;
+	}
+
+	zassert_equal(plain.recovered, 0U, "SACK recovery without SACK");
+	zassert_true(sack.recovered > 0U, "SACK recovery was not entered");
+	zassert_true(sack.sent <= plain.sent,
+		     "more data sent with SACK (%u vs %u)", sack.sent, plain.sent);
+	zassert_true(sack.duplicate <= plain.duplicate,
+		     "more duplicate data with SACK (%u vs %u)",
+		     sack.duplicate, plain.duplicate);
+}
+
+/* The device sends GSO_DATA_LEN bytes to a peer with an MSS of
+ * SACK_LOSS_MSS. Every segment reaching the peer must be a proper segment:
+ * in sequence, a full MSS long, with its own checksum and with FIN only
+ * where the data ends. TCP sets PSH on every packet it sends, so a segment
+ * without PSH was cut from a GSO packet and was not its last segment.
+ */
+#define GSO_DATA_LEN (16 * SACK_LOSS_MSS)
+
+static uint32_t gso_isn;
+static uint32_t gso_next;
+static int gso_segs;
+static int gso_unpushed;
+static bool gso_last_pushed;
+
+static void handle_client_gso_test(struct net_pkt *pkt, struct tcphdr *th)
+{
+	uint8_t opts[] = { NET_TCP_MSS_OPT, NET_TCP_MSS_SIZE,
+			   SACK_LOSS_MSS >> 8, SACK_LOSS_MSS & 0xff };
+	uint8_t data[SACK_LOSS_MSS];
+	struct net_pkt *reply;
+	size_t hdr_len;
+	uint32_t rel;
+	uint32_t len;
+
+	if (th->th_flags & SYN) {
+		gso_isn = ntohl(th->th_seq) + 1U;
+		gso_next = 0U;
+		seq = 0U;
+		ack = gso_isn;
+
+		reply = prepare_sack_loss_pkt(th->th_sport, SYN | ACK, opts, sizeof(opts));
+		seq++;
+		goto send;
+	}
+
+	hdr_len = net_pkt_ip_hdr_len(pkt) + net_pkt_ip_opts_len(pkt) + th->th_off * 4U;
+	len = net_pkt_get_len(pkt) - hdr_len;
+	rel = ntohl(th->th_seq) - gso_isn;
+
+	zassert_equal(net_calc_chksum_tcp(pkt), 0U, "bad checksum at %u", rel);
+
+	if (len > 0U) {
+		zassert_equal(rel, gso_next, "segment at %u, expected %u", rel, gso_next);
+		zassert_equal(len, SACK_LOSS_MSS, "segment of %u bytes at %u", len, rel);
+
+		net_pkt_cursor_init(pkt);
+		zassert_ok(net_pkt_skip(pkt, hdr_len), "cannot skip headers");
+		zassert_ok(net_pkt_read(pkt, data, len), "cannot read data");
+		zassert_mem_equal(data, lorem_ipsum + rel, len, "data corrupted at %u", rel);
+
+		gso_segs++;
+		gso_next += len;
+		gso_unpushed += (th->th_flags & PSH) ? 0 : 1;
+		gso_last_pushed = (th->th_flags & PSH) != 0;
+	}
+
+	if (th->th_flags & FIN) {
+		zassert_equal(rel + len, GSO_DATA_LEN, "FIN in a segment ending at %u",
+			      rel + len);
+		ack = ntohl(th->th_seq) + len + 1U;
+		reply = prepare_sack_loss_pkt(th->th_sport, FIN | ACK, NULL, 0);
+		seq++;
+		goto send;
+	}
+
+	if (len == 0U) {
+		return;
+	}
+
+	ack = gso_isn + gso_next;
+	reply = prepare_sack_loss_pkt(th->th_sport, ACK, NULL, 0);
+
+	if (gso_next == GSO_DATA_LEN) {
+		test_sem_give();
+	}
+send:
+	zassert_not_null(reply, "Failed to prepare reply");
+	zassert_ok(net_recv_data(net_iface, reply), "%s failed", __func__);
+}
+
+/* Test case scenario IPv4
+ *   connect, send GSO_DATA_LEN bytes in chunks of several segments and
+ *   close.
+ *   Expect the data cut into in-sequence segments of the peer's MSS with
+ *   valid checksums, some of them from GSO packets, and PSH on the last
+ *   one.
+ */
+ZTEST(net_tcp, test_client_gso_ipv4)
+{
+	struct net_context *ctx;
+	uint32_t queued = 0U;
+	int ret;
+
+	if (!IS_ENABLED(CONFIG_NET_TCP_GSO)) {
+		ztest_test_skip();
+	}
+
+	test_case_no = TEST_CLIENT_GSO_IPV4;
+	gso_segs = 0;
+	gso_unpushed = 0;
+	gso_last_pushed = false;
+	seq = ack = 0;
+
+	zassert_ok(net_context_get(AF_INET, SOCK_STREAM, IPPROTO_TCP, &ctx),
+		   "Failed to get net_context");
+
+	net_context_ref(ctx);
+
+	zassert_ok(net_context_connect(ctx, (struct sockaddr *)&peer_addr_s,
+				       sizeof(struct sockaddr_in), NULL,
+				       K_MSEC(1000), NULL),
+		   "Failed to connect to peer");
+
+	while (queued < GSO_DATA_LEN) {
+		ret = net_context_send(ctx, lorem_ipsum + queued,
+				       MIN(4 * SACK_LOSS_MSS, GSO_DATA_LEN - queued),
+				       NULL, K_NO_WAIT, NULL);
+		if (ret == -EAGAIN) {
+			k_msleep(1);
+			continue;
+		}
+
+		zassert_true(ret > 0, "Failed to send data (%d)", ret);
+		queued += ret;
+	}
+
+	test_sem_take(K_SECONDS(1), __LINE__);
+
+	zassert_equal(gso_segs, GSO_DATA_LEN / SACK_LOSS_MSS,
+		      "unexpected number of segments");
+	zassert_true(gso_unpushed > 0, "no segment was cut from a GSO packet");
+	zassert_true(gso_last_pushed, "no PSH on the last segment");
+
+	net_context_put(ctx);
+
+	/* Connection is in TIME_WAIT state, context will be released
+	 * after K_MSEC(CONFIG_NET_TCP_TIME_WAIT_DELAY), so wait for it.
+	 */
+	k_sleep(K_MSEC(CONFIG_NET_TCP_TIME_WAIT_DELAY));
+}
+
 ZTEST_SUITE(net_tcp, NULL, presetup, NULL, NULL, NULL);
@@ -30,9 +30,11 @@ LOG_MODULE_REGISTER(net_test, NET_LOG_LEVEL);
 #include <zephyr/net/udp.h>
 
 #include "ipv6.h"
+#include "udp_internal.h"
 
 #define NET_LOG_ENABLED 1
 #include "net_private.h"
+#include "net_stats.h"
 
 #if NET_LOG_LEVEL >= LOG_LEVEL_DBG
 #define DBG(fmt, ...) printk(fmt, ##__VA_ARGS__)
@@ -1053,6 +1055,200 @@ ZTEST(net_traffic_class, test_mix_all_2)
 	test_traffic_class_recv_data_mix_all_2();
 }
 
+#if defined(CONFIG_NET_TC_RX_STEERING)
+#define STEER_PORT 4242
+#define STEER_FLOWS 16
+#define STEER_PKTS 3
+#define STEER_ROUNDS 2
+
+/* Queue and next expected sequence number of each flow */
+static struct {
+	int queue;
+	uint8_t next_seq;
+} steer_flows[STEER_FLOWS];
+
+static int steer_queue_pkts[CONFIG_NET_TC_RX_STEERING_QUEUES];
+static atomic_t steer_errors;
+static struct k_sem steer_sem;
+
+static void steer_recv_cb(struct net_context *context,
+			  struct net_pkt *pkt,
+			  union net_ip_header *ip_hdr,
+			  union net_proto_header *proto_hdr,
+			  int status,
+			  void *user_data)
+{
+	int queue = net_tc_rx_current();
+	uint8_t data[2];
+
+	net_pkt_cursor_init(pkt);
+
+	if (queue < 0 ||
+	    net_pkt_skip(pkt, net_pkt_ip_hdr_len(pkt) + net_pkt_ip_opts_len(pkt) +
+			 sizeof(struct net_udp_hdr)) ||
+	    net_pkt_read(pkt, data, sizeof(data)) || data[0] >= STEER_FLOWS) {
+		atomic_inc(&steer_errors);
+		goto out;
+	}
+
+	queue %= CONFIG_NET_TC_RX_STEERING_QUEUES;
+
+	/* All the packets of a flow are expected on one queue, in order */
+	if (steer_flows[data[0]].queue < 0) {
+		steer_flows[data[0]].queue = queue;
+	} else if (steer_flows[data[0]].queue != queue) {
+		atomic_inc(&steer_errors);
+	}
+
+	if (data[1] != steer_flows[data[0]].next_seq) {
+		atomic_inc(&steer_errors);
+	}
+
+	steer_flows[data[0]].next_seq = data[1] + 1;
+	steer_queue_pkts[queue]++;
+
+out:
+	net_pkt_unref(pkt);
+	k_sem_give(&steer_sem);
+}
+
+/* Receive a UDP packet of a flow, each flow has its own source port */
+static void steer_recv(struct net_if *iface, uint8_t flow, uint8_t seq)
+{
+	uint8_t data[2] = { flow, seq };
+	struct net_pkt *pkt;
+	int ret;
+
+	pkt = net_pkt_alloc_with_buffer(iface, sizeof(data), AF_INET6,
+					IPPROTO_UDP, K_SECONDS(1));
+	zassert_not_null(pkt, "Out of mem");
+
+	if (net_ipv6_create(pkt, &dst_addr, &my_addr1) ||
+	    net_udp_create(pkt, htons(STEER_PORT + 1 + flow), htons(STEER_PORT)) ||
+	    net_pkt_write(pkt, data, sizeof(data))) {
+		zassert_true(false, "Cannot create IPv6 UDP pkt %p", pkt);
+	}
+
+	net_pkt_cursor_init(pkt);
+	net_ipv6_finalize(pkt, IPPROTO_UDP);
+
+	ret = net_recv_data(iface, pkt);
+	zassert_equal(ret, 0, "Recv data failed (%d)", ret);
+}
+#endif /* CONFIG_NET_TC_RX_STEERING */
+
+ZTEST(net_traffic_class, test_rx_steering)
+{
+#if defined(CONFIG_NET_TC_RX_STEERING)
+	struct sockaddr_in6 addr6 = {
+		.sin6_family = AF_INET6,
+		.sin6_port = htons(STEER_PORT),
+	};
+#if defined(CONFIG_NET_STATISTICS_RX_STEERING)
+	static const uint8_t ipv4_hdr[NET_IPV4H_LEN] = { 0x45 };
+	net_stats_t queued[CONFIG_NET_TC_RX_STEERING_QUEUES];
+	net_stats_t unhashed;
+	struct net_pkt *pkt;
+#endif
+	struct net_context *ctx;
+	struct net_if *iface;
+	int queues_used = 0;
+	int ret;
+
+	iface = net_if_get_first_by_type(&NET_L2_GET_NAME(DUMMY));
+
+	ARRAY_FOR_EACH(steer_flows, i) {
+		steer_flows[i].queue = -1;
+		steer_flows[i].next_seq = 0;
+	}
+
+	memset(steer_queue_pkts, 0, sizeof(steer_queue_pkts));
+	atomic_set(&steer_errors, 0);
+	k_sem_init(&steer_sem, 0, UINT_MAX);
+
+	ret = net_context_get(AF_INET6, SOCK_DGRAM, IPPROTO_UDP, &ctx);
+	zassert_equal(ret, 0, "Create IPv6 UDP context failed (%d)", ret);
+
+	memcpy(&addr6.sin6_addr, &my_addr1, sizeof(struct in6_addr));
+
+	ret = net_context_bind(ctx, (struct sockaddr *)&addr6, sizeof(addr6));
+	zassert_equal(ret, 0, "Context bind failed (%d)", ret);
+
+	ret = net_context_recv(ctx, steer_recv_cb, K_NO_WAIT, NULL);
+	zassert_equal(ret, 0, "Context recv failed (%d)", ret);
+
+#if defined(CONFIG_NET_STATISTICS_RX_STEERING)
+	unhashed = net_stats.rx_steering.unhashed;
+	memcpy(queued, net_stats.rx_steering.queued, sizeof(queued));
+#endif
+
+	/* Interleave the flows, and queue several packets of each before
+	 * letting them be processed.
+	 */
+	for (int round = 0; round < STEER_ROUNDS; round++) {
+		for (int seq = 0; seq < STEER_PKTS; seq++) {
+			for (int flow = 0; flow < STEER_FLOWS; flow++) {
+				steer_recv(iface, flow, round * STEER_PKTS + seq);
+			}
+		}
+
+		for (int i = 0; i < STEER_FLOWS * STEER_PKTS; i++) {
+			zassert_equal(k_sem_take(&steer_sem, WAIT_TIME), 0, "Timeout");
+		}
+	}
+
+	zassert_equal(atomic_get(&steer_errors), 0,
+		      "Flow packets on several queues or out of order");
+
+	ARRAY_FOR_EACH(steer_flows, i) {
+		zassert_equal(steer_flows[i].next_seq, STEER_ROUNDS * STEER_PKTS,
+			      "Flow %zu lost packets", i);
+	}
+
+	ARRAY_FOR_EACH(steer_queue_pkts, i) {
+		if (steer_queue_pkts[i] > 0) {
+			queues_used++;
+		}
+	}
+
+	zassert_true(queues_used > 1, "All the flows are on one queue");
+
+#if defined(CONFIG_NET_STATISTICS_RX_STEERING)
+	ARRAY_FOR_EACH(queued, i) {
+		zassert_equal(net_stats.rx_steering.queued[i] - queued[i],
+			      steer_queue_pkts[i], "Wrong queued count for queue %zu", i);
+	}
+
+	zassert_equal(net_stats.rx_steering.unhashed, unhashed,
+		      "UDP packets were not hashed");
+
+	/* IPv4 is disabled, so an IPv4 packet cannot be hashed. It is counted
+	 * and put in the first queue when it is received.
+	 */
+	memcpy(queued, net_stats.rx_steering.queued, sizeof(queued));
+
+	pkt = net_pkt_rx_alloc_with_buffer(iface, sizeof(ipv4_hdr), AF_UNSPEC, 0,
+					   K_SECONDS(1));
+	zassert_not_null(pkt, "Out of mem");
+
+	ret = net_pkt_write(pkt, ipv4_hdr, sizeof(ipv4_hdr));
+	zassert_equal(ret, 0, "Cannot write the packet (%d)", ret);
+
+	ret = net_recv_data(iface, pkt);
+	zassert_equal(ret, 0, "Recv data failed (%d)", ret);
+
+	zassert_equal(net_stats.rx_steering.unhashed, unhashed + 1,
+		      "IPv4 packet was hashed");
+	zassert_equal(net_stats.rx_steering.queued[0], queued[0] + 1,
+		      "IPv4 packet not in the first queue");
+#endif /* CONFIG_NET_STATISTICS_RX_STEERING */
+
+	net_context_unref(ctx);
+#else
+	ztest_test_skip();
+#endif /* CONFIG_NET_TC_RX_STEERING */
+}
+
 static void run_before(void *dummy)
 {
 	ARG_UNUSED(dummy);
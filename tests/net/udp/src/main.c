@@ -434,6 +434,7 @@ ZTEST(udp_fn_tests, test_udp)
 	struct net_if *iface;
 	struct net_if_addr *ifaddr;
 	struct ud *ud;
+	struct ud *ud_any;
 	int ret, i = 0;
 	bool st;
 
@@ -628,6 +629,27 @@ ZTEST(udp_fn_tests, test_udp)
 	TEST_IPV4_OK(ud, &in4addr_peer, &in4addr_my, 1234, 4242);
 	TEST_IPV4_FAIL(ud, &in4addr_peer, &in4addr_my, 1234, 4243);
 
+	/* A fully specified handler wins over a wildcard one on the same
+	 * local port, whichever was registered first, but only for its
+	 * own peer. The wildcard handler gets the packets again once the
+	 * specific one is gone.
+	 */
+	ud_any = REGISTER(AF_INET6, NULL, &my_addr6, 0, 4244);
+	ud = REGISTER(AF_INET6, &peer_addr6, &my_addr6, 1234, 4244);
+	TEST_IPV6_OK(ud, &in6addr_peer, &in6addr_my, 1234, 4244);
+	TEST_IPV6_OK(ud_any, &in6addr_peer, &in6addr_my, 1235, 4244);
+	UNREGISTER(ud);
+	TEST_IPV6_OK(ud_any, &in6addr_peer, &in6addr_my, 1234, 4244);
+	UNREGISTER(ud_any);
+
+	ud = REGISTER(AF_INET, &peer_addr4, &my_addr4, 1234, 4244);
+	ud_any = REGISTER(AF_INET, NULL, &my_addr4, 0, 4244);
+	TEST_IPV4_OK(ud, &in4addr_peer, &in4addr_my, 1234, 4244);
+	TEST_IPV4_OK(ud_any, &in4addr_peer, &in4addr_my, 1235, 4244);
+	UNREGISTER(ud);
+	TEST_IPV4_OK(ud_any, &in4addr_peer, &in4addr_my, 1234, 4244);
+	UNREGISTER(ud_any);
+
 	ud = REGISTER(AF_UNSPEC, NULL, NULL, 1234, 42423);
 	TEST_IPV4_OK(ud, &in4addr_peer, &in4addr_my, 1234, 42423);
 	TEST_IPV6_OK(ud, &in6addr_peer, &in6addr_my, 1234, 42423);
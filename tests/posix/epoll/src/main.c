@@ -0,0 +1,178 @@
+/*
+ * Copyright (c) 2026 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <errno.h>
+
+#include <zephyr/kernel.h>
+#include <zephyr/posix/sys/epoll.h>
+#include <zephyr/posix/sys/eventfd.h>
+#include <zephyr/posix/unistd.h>
+#include <zephyr/ztest.h>
+
+#define NUM_EFDS 2
+#define TESTVAL  10
+
+struct epoll_fixture {
+	int epfd;
+	int efd[NUM_EFDS];
+};
+
+static struct epoll_fixture test_fixture;
+
+static void epoll_before(void *arg)
+{
+	struct epoll_fixture *fx = arg;
+
+	fx->epfd = epoll_create1(0);
+	zassert_true(fx->epfd >= 0, "epoll_create1 failed: %d", errno);
+
+	for (int i = 0; i < NUM_EFDS; i++) {
+		fx->efd[i] = eventfd(0, EFD_NONBLOCK);
+		zassert_true(fx->efd[i] >= 0, "eventfd failed: %d", errno);
+	}
+}
+
+static void epoll_after(void *arg)
+{
+	struct epoll_fixture *fx = arg;
+
+	zassert_ok(close(fx->epfd));
+
+	for (int i = 0; i < NUM_EFDS; i++) {
+		zassert_ok(close(fx->efd[i]));
+	}
+}
+
+static void *epoll_setup(void)
+{
+	return &test_fixture;
+}
+
+static void add_all(struct epoll_fixture *fx, uint32_t events)
+{
+	struct epoll_event ev;
+
+	for (int i = 0; i < NUM_EFDS; i++) {
+		ev.events = events;
+		ev.data.u32 = i;
+		zassert_ok(epoll_ctl(fx->epfd, EPOLL_CTL_ADD, fx->efd[i], &ev));
+	}
+}
+
+ZTEST_F(epoll, test_ctl)
+{
+	struct epoll_event ev = {
+		.events = EPOLLIN,
+	};
+
+	add_all(fixture, EPOLLIN);
+
+	zassert_equal(epoll_ctl(fixture->epfd, EPOLL_CTL_ADD, fixture->efd[0], &ev), -1);
+	zassert_equal(errno, EEXIST);
+
+	zassert_equal(epoll_ctl(fixture->epfd, EPOLL_CTL_ADD, fixture->epfd, &ev), -1);
+	zassert_equal(errno, EINVAL);
+
+	zassert_ok(epoll_ctl(fixture->epfd, EPOLL_CTL_MOD, fixture->efd[0], &ev));
+	zassert_ok(epoll_ctl(fixture->epfd, EPOLL_CTL_DEL, fixture->efd[0], NULL));
+
+	zassert_equal(epoll_ctl(fixture->epfd, EPOLL_CTL_DEL, fixture->efd[0], NULL), -1);
+	zassert_equal(errno, ENOENT);
+
+	zassert_equal(epoll_ctl(fixture->epfd, EPOLL_CTL_MOD, fixture->efd[0], &ev), -1);
+	zassert_equal(errno, ENOENT);
+}
+
+ZTEST_F(epoll, test_wait_ready_only)
+{
+	struct epoll_event events[NUM_EFDS];
+	int ret;
+
+	add_all(fixture, EPOLLIN);
+
+	ret = epoll_wait(fixture->epfd, events, ARRAY_SIZE(events), 0);
+	zassert_equal(ret, 0, "idle fds reported: %d", ret);
+
+	zassert_ok(eventfd_write(fixture->efd[1], TESTVAL));
+
+	ret = epoll_wait(fixture->epfd, events, ARRAY_SIZE(events), 100);
+	zassert_equal(ret, 1, "wrong number of ready fds: %d", ret);
+	zassert_equal(events[0].events, EPOLLIN);
+	zassert_equal(events[0].data.u32, 1);
+
+	/* Level-triggered, reported until it is read */
+	ret = epoll_wait(fixture->epfd, events, ARRAY_SIZE(events), 0);
+	zassert_equal(ret, 1, "wrong number of ready fds: %d", ret);
+}
+
+ZTEST_F(epoll, test_wait_oneshot)
+{
+	struct epoll_event events[NUM_EFDS];
+	struct epoll_event ev = {
+		.events = EPOLLIN | EPOLLONESHOT,
+	};
+	int ret;
+
+	zassert_ok(epoll_ctl(fixture->epfd, EPOLL_CTL_ADD, fixture->efd[0], &ev));
+	zassert_ok(eventfd_write(fixture->efd[0], TESTVAL));
+
+	ret = epoll_wait(fixture->epfd, events, ARRAY_SIZE(events), 0);
+	zassert_equal(ret, 1, "wrong number of ready fds: %d", ret);
+
+	ret = epoll_wait(fixture->epfd, events, ARRAY_SIZE(events), 0);
+	zassert_equal(ret, 0, "one-shot fd reported twice");
+
+	/* Re-armed with EPOLL_CTL_MOD */
+	zassert_ok(epoll_ctl(fixture->epfd, EPOLL_CTL_MOD, fixture->efd[0], &ev));
+
+	ret = epoll_wait(fixture->epfd, events, ARRAY_SIZE(events), 0);
+	zassert_equal(ret, 1, "wrong number of ready fds: %d", ret);
+}
+
+/* Assertions cannot fail outside of the test thread, the results are
+ * checked once the wait returned.
+ */
+static int add_late_write_ret;
+static int add_late_ctl_ret;
+
+static void add_late(struct k_work *work)
+{
+	struct epoll_event ev = {
+		.events = EPOLLIN,
+		.data.u32 = 1,
+	};
+
+	ARG_UNUSED(work);
+
+	add_late_write_ret = eventfd_write(test_fixture.efd[1], TESTVAL);
+	add_late_ctl_ret = epoll_ctl(test_fixture.epfd, EPOLL_CTL_ADD, test_fixture.efd[1], &ev);
+}
+
+static K_WORK_DELAYABLE_DEFINE(add_late_work, add_late);
+
+ZTEST_F(epoll, test_wait_ctl_wakeup)
+{
+	struct epoll_event events[NUM_EFDS];
+	struct epoll_event ev = {
+		.events = EPOLLIN,
+	};
+	int ret;
+
+	zassert_ok(epoll_ctl(fixture->epfd, EPOLL_CTL_ADD, fixture->efd[0], &ev));
+
+	/* A file descriptor added while waiting is picked up */
+	add_late_write_ret = -1;
+	add_late_ctl_ret = -1;
+	k_work_schedule(&add_late_work, K_MSEC(10));
+
+	ret = epoll_wait(fixture->epfd, events, ARRAY_SIZE(events), 1000);
+	zassert_ok(add_late_write_ret, "eventfd_write failed");
+	zassert_ok(add_late_ctl_ret, "epoll_ctl failed");
+	zassert_equal(ret, 1, "wrong number of ready fds: %d", ret);
+	zassert_equal(events[0].data.u32, 1);
+}
+
+ZTEST_SUITE(epoll, NULL, epoll_setup, epoll_before, epoll_after, NULL);
@@ -95,6 +95,9 @@ static void after(void *data)
 	}
 
 	fixture->fs.sector_count = TEST_SECTOR_COUNT;
+#ifdef CONFIG_NVS_BACKGROUND_GC
+	fixture->fs.background_gc = false;
+#endif
 }
 
 ZTEST_SUITE(nvs, NULL, setup, before, after, NULL);
@@ -639,6 +642,104 @@ ZTEST_F(nvs, test_delete)
 		     " any footprint in the storage");
 }
 
+struct foreach_result {
+	uint16_t found[10];
+	uint16_t len[10];
+	struct nvs_entry latest[10];
+	int visits;
+};
+
+static int foreach_cb(struct nvs_fs *fs, const struct nvs_entry *entry, void *arg)
+{
+	struct foreach_result *res = arg;
+
+	zassert_true(entry->id < ARRAY_SIZE(res->found), "unexpected id %u", entry->id);
+
+	if (res->found[entry->id]++ == 0) {
+		res->len[entry->id] = entry->len;
+		res->latest[entry->id] = *entry;
+	}
+
+	res->visits++;
+
+	return 0;
+}
+
+static int foreach_stop_cb(struct nvs_fs *fs, const struct nvs_entry *entry, void *arg)
+{
+	return 1;
+}
+
+/*
+ * Test that nvs_foreach() reports the latest entry of each id first, and
+ * that nvs_entry_read() reads the data of the reported entries.
+ */
+ZTEST_F(nvs, test_nvs_foreach)
+{
+	int err;
+	ssize_t len;
+	uint16_t id, data_read;
+	uint32_t data;
+	static struct foreach_result res;
+
+	fixture->fs.sector_count = 3;
+
+	err = nvs_mount(&fixture->fs);
+	zassert_true(err == 0,  "nvs_mount call failure: %d", err);
+
+	for (id = 0; id < 10; id++) {
+		len = nvs_write(&fixture->fs, id, &id, sizeof(id));
+		zassert_true(len == sizeof(id), "nvs_write failed: %d", len);
+	}
+
+	/* Rewrite id 2 with larger data and delete id 3 */
+	data = 0xdeadbeef;
+	len = nvs_write(&fixture->fs, 2, &data, sizeof(data));
+	zassert_true(len == sizeof(data), "nvs_write failed: %d", len);
+
+	err = nvs_delete(&fixture->fs, 3);
+	zassert_true(err == 0,  "nvs_delete call failure: %d", err);
+
+	memset(&res, 0, sizeof(res));
+	err = nvs_foreach(&fixture->fs, foreach_cb, &res);
+	zassert_true(err == 0,  "nvs_foreach call failure: %d", err);
+	zassert_equal(res.visits, 12, "unexpected number of entries: %d", res.visits);
+
+	for (id = 0; id < 10; id++) {
+		zassert_equal(res.found[id], (id == 2 || id == 3) ? 2 : 1,
+			      "id %u reported %u times", id, res.found[id]);
+	}
+
+	zassert_equal(res.len[2], sizeof(data), "not the latest entry of id 2");
+	zassert_equal(res.len[3], 0, "id 3 should be reported as deleted");
+
+	len = nvs_entry_read(&fixture->fs, &res.latest[2], &data, sizeof(data));
+	zassert_true(len == sizeof(data), "nvs_entry_read failed: %d", len);
+	zassert_equal(data, 0xdeadbeef, "unexpected data for id 2");
+
+	len = nvs_entry_read(&fixture->fs, &res.latest[7], &data_read, sizeof(data_read));
+	zassert_true(len == sizeof(data_read), "nvs_entry_read failed: %d", len);
+	zassert_equal(data_read, 7, "unexpected data for id 7");
+
+	len = nvs_entry_read(&fixture->fs, &res.latest[3], &data_read, sizeof(data_read));
+	zassert_true(len == -ENOENT, "deleted entry shouldn't be read: %d", len);
+
+	err = nvs_foreach(&fixture->fs, foreach_stop_cb, NULL);
+	zassert_equal(err, 1, "nvs_foreach not stopped by the callback: %d", err);
+
+	/* The reported entries are gone once their sector is garbage collected */
+	for (int i = 0; i < fixture->fs.sector_count - 1; i++) {
+		err = nvs_sector_use_next(&fixture->fs);
+		zassert_true(err == 0,  "nvs_sector_use_next call failure: %d", err);
+	}
+
+	len = nvs_entry_read(&fixture->fs, &res.latest[7], &data_read, sizeof(data_read));
+	zassert_true(len == -ENOENT, "moved entry shouldn't be read: %d", len);
+
+	len = nvs_read(&fixture->fs, 7, &data_read, sizeof(data_read));
+	zassert_true(len == sizeof(data_read), "nvs_read failed: %d", len);
+}
+
 /*
  * Test that garbage-collection can recover all ate's even when the last ate,
  * ie close_ate, is corrupt. In this test the close_ate is set to point to the
@@ -959,3 +1060,325 @@ ZTEST_F(nvs, test_nvs_cache_hash_quality)
 
 #endif
 }
+
+#ifdef CONFIG_NVS_LOOKUP_INDEX
+static int flash_sim_read_calls_find(struct stats_hdr *hdr, void *arg,
+				     const char *name, uint16_t off)
+{
+	if (!strcmp(name, "flash_read_calls")) {
+		uint32_t **flash_read_stat = (uint32_t **) arg;
+		*flash_read_stat = (uint32_t *)((uint8_t *)hdr + off);
+	}
+
+	return 0;
+}
+#endif
+
+/*
+ * Test that NVS lookup index reads the ate and the data of an indexed id only,
+ * and that the ids that do not fit in it are still found.
+ */
+ZTEST_F(nvs, test_nvs_lookup_index)
+{
+#ifdef CONFIG_NVS_LOOKUP_INDEX
+	const uint32_t expected_reads = IS_ENABLED(CONFIG_NVS_DATA_CRC) ? 3 : 2;
+	uint32_t *flash_read_stat;
+	uint32_t reads;
+	int err;
+	uint16_t id;
+	uint16_t data;
+
+	stats_walk(fixture->sim_stats, flash_sim_read_calls_find, &flash_read_stat);
+
+	fixture->fs.sector_count = 3;
+	err = nvs_mount(&fixture->fs);
+	zassert_true(err == 0, "nvs_mount call failure: %d", err);
+
+	for (id = 0; id < CONFIG_NVS_LOOKUP_CACHE_SIZE; id++) {
+		data = id;
+		err = nvs_write(&fixture->fs, id, &data, sizeof(data));
+		zassert_equal(err, sizeof(data), "nvs_write call failure: %d", err);
+	}
+
+	zassert_false(fixture->fs.lookup_index_overflow, "unexpected index overflow");
+
+	for (id = 0; id < CONFIG_NVS_LOOKUP_CACHE_SIZE; id++) {
+		reads = *flash_read_stat;
+		err = nvs_read(&fixture->fs, id, &data, sizeof(data));
+		zassert_equal(err, sizeof(data), "nvs_read call failure: %d", err);
+		zassert_equal(data, id, "incorrect data read");
+		zassert_equal(*flash_read_stat - reads, expected_reads,
+			      "unexpected flash reads for id %u", id);
+	}
+
+	/* A deleted id is no longer found, and frees its entry */
+	err = nvs_delete(&fixture->fs, 0);
+	zassert_true(err == 0, "nvs_delete call failure: %d", err);
+	reads = *flash_read_stat;
+	err = nvs_read(&fixture->fs, 0, &data, sizeof(data));
+	zassert_equal(err, -ENOENT, "deleted id found: %d", err);
+	zassert_equal(*flash_read_stat, reads, "deleted id still indexed");
+
+	err = nvs_mount(&fixture->fs);
+	zassert_true(err == 0, "nvs_mount call failure: %d", err);
+	zassert_false(fixture->fs.lookup_index_overflow, "deleted id indexed at restart");
+
+	id = CONFIG_NVS_LOOKUP_CACHE_SIZE;
+	data = id;
+	err = nvs_write(&fixture->fs, id, &data, sizeof(data));
+	zassert_equal(err, sizeof(data), "nvs_write call failure: %d", err);
+	zassert_false(fixture->fs.lookup_index_overflow, "unexpected index overflow");
+
+	/* One more id does not fit in the index */
+	id = CONFIG_NVS_LOOKUP_CACHE_SIZE + 1;
+	data = id;
+	err = nvs_write(&fixture->fs, id, &data, sizeof(data));
+	zassert_equal(err, sizeof(data), "nvs_write call failure: %d", err);
+	zassert_true(fixture->fs.lookup_index_overflow, "no index overflow");
+
+	err = nvs_mount(&fixture->fs);
+	zassert_true(err == 0, "nvs_mount call failure: %d", err);
+	zassert_true(fixture->fs.lookup_index_overflow, "no index overflow");
+
+	for (id = 1; id <= CONFIG_NVS_LOOKUP_CACHE_SIZE + 1; id++) {
+		err = nvs_read(&fixture->fs, id, &data, sizeof(data));
+		zassert_equal(err, sizeof(data), "nvs_read call failure: %d", err);
+		zassert_equal(data, id, "incorrect data read");
+	}
+
+	err = nvs_read(&fixture->fs, 0, &data, sizeof(data));
+	zassert_equal(err, -ENOENT, "deleted id found after restart: %d", err);
+#endif
+}
+
+#ifdef CONFIG_NVS_LOOKUP_INDEX
+/* check that each id is found through its own index entry only */
+static void nvs_lookup_index_check(struct nvs_fs *fs, const uint16_t *expected,
+				   uint16_t count, uint32_t *flash_read_stat)
+{
+	const uint32_t expected_reads = IS_ENABLED(CONFIG_NVS_DATA_CRC) ? 3 : 2;
+	uint32_t reads;
+	uint16_t data;
+	int err;
+
+	zassert_false(fs->lookup_index_overflow, "unexpected index overflow");
+
+	for (uint16_t id = 0; id < count; id++) {
+		reads = *flash_read_stat;
+		err = nvs_read(fs, id, &data, sizeof(data));
+		if (expected[id] == 0xFFFF) {
+			zassert_equal(err, -ENOENT, "deleted id %u found: %d", id, err);
+			zassert_equal(*flash_read_stat, reads, "deleted id %u indexed", id);
+			continue;
+		}
+
+		zassert_equal(err, sizeof(data), "nvs_read call failure: %d", err);
+		zassert_equal(data, expected[id], "incorrect data read for id %u", id);
+		zassert_equal(*flash_read_stat - reads, expected_reads,
+			      "unexpected flash reads for id %u", id);
+	}
+}
+#endif
+
+/*
+ * Test that NVS lookup index stays exact while the gc moves the ids, and
+ * erases the sectors holding their deletes.
+ */
+ZTEST_F(nvs, test_nvs_lookup_index_gc)
+{
+#ifdef CONFIG_NVS_LOOKUP_INDEX
+	const uint16_t count = CONFIG_NVS_LOOKUP_CACHE_SIZE / 2;
+	uint16_t expected[CONFIG_NVS_LOOKUP_CACHE_SIZE / 2];
+	uint32_t *flash_read_stat;
+	uint32_t sector;
+	uint32_t gc_count = 0;
+	uint16_t round, id;
+	int err;
+
+	stats_walk(fixture->sim_stats, flash_sim_read_calls_find, &flash_read_stat);
+
+	fixture->fs.sector_count = 3;
+	err = nvs_mount(&fixture->fs);
+	zassert_true(err == 0, "nvs_mount call failure: %d", err);
+
+	sector = fixture->fs.ate_wra >> ADDR_SECT_SHIFT;
+
+	/* Rewrite every id in each round, and delete a different set of ids */
+	for (round = 0; gc_count < 2 * fixture->fs.sector_count; round++) {
+		zassert_true(round < 1000, "gc never run");
+
+		for (id = 0; id < count; id++) {
+			if (((id + round) % 5) == 0) {
+				err = nvs_delete(&fixture->fs, id);
+				zassert_true(err == 0, "nvs_delete call failure: %d", err);
+				expected[id] = 0xFFFF;
+			} else {
+				expected[id] = round * count + id;
+				err = nvs_write(&fixture->fs, id, &expected[id],
+						sizeof(expected[id]));
+				zassert_equal(err, sizeof(expected[id]),
+					      "nvs_write call failure: %d", err);
+			}
+
+			/* a new write sector means that a sector was gc'ed */
+			if ((fixture->fs.ate_wra >> ADDR_SECT_SHIFT) != sector) {
+				sector = fixture->fs.ate_wra >> ADDR_SECT_SHIFT;
+				gc_count++;
+			}
+		}
+
+		nvs_lookup_index_check(&fixture->fs, expected, count, flash_read_stat);
+	}
+
+	err = nvs_mount(&fixture->fs);
+	zassert_true(err == 0, "nvs_mount call failure: %d", err);
+
+	nvs_lookup_index_check(&fixture->fs, expected, count, flash_read_stat);
+#endif
+}
+
+#ifdef CONFIG_NVS_BACKGROUND_GC
+/* Wait until the background gc has nothing left to do */
+static void nvs_gc_idle(struct nvs_fs *fs)
+{
+	struct k_work_sync sync;
+
+	while (k_work_flush(&fs->gc_work, &sync)) {
+	}
+}
+
+/* Fill the write sector without letting the background gc run */
+static uint32_t nvs_fill_sector(struct nvs_fs *fs, uint32_t data)
+{
+	uint32_t sector = fs->ate_wra >> ADDR_SECT_SHIFT;
+	int err;
+
+	for (; (fs->ate_wra >> ADDR_SECT_SHIFT) == sector; data++) {
+		err = nvs_write(fs, TEST_DATA_ID, &data, sizeof(data));
+		zassert_equal(err, sizeof(data), "nvs_write call failure: %d", err);
+	}
+
+	return data - 1;
+}
+#endif
+
+/*
+ * Test that the background gc closes the write sector ahead of time and erases
+ * the garbage collected sector, that a foreground gc cancels a background gc
+ * request, and that an erase left to the background gc is finished by
+ * nvs_mount() after a restart, even after a torn data write.
+ */
+ZTEST_F(nvs, test_nvs_background_gc)
+{
+#ifdef CONFIG_NVS_BACKGROUND_GC
+	int err;
+	uint32_t data, rd_data, sector;
+	uint8_t torn[16], rd_torn[16];
+	uint32_t *flash_write_stat;
+	uint32_t *flash_max_write_calls;
+
+	fixture->fs.background_gc = true;
+	err = nvs_mount(&fixture->fs);
+	zassert_true(err == 0, "nvs_mount call failure: %d", err);
+
+	data = 0xDEADBEEF;
+	err = nvs_write(&fixture->fs, TEST_DATA_ID + 1, &data, sizeof(data));
+	zassert_equal(err, sizeof(data), "nvs_write call failure: %d", err);
+
+	/* Let the background gc run after each write */
+	sector = fixture->fs.ate_wra >> ADDR_SECT_SHIFT;
+	for (data = 0; (fixture->fs.ate_wra >> ADDR_SECT_SHIFT) == sector; data++) {
+		zassert_true(data < fixture->fs.sector_size, "sector never closed");
+
+		err = nvs_write(&fixture->fs, TEST_DATA_ID, &data, sizeof(data));
+		zassert_equal(err, sizeof(data), "nvs_write call failure: %d", err);
+
+		nvs_gc_idle(&fixture->fs);
+	}
+
+	zassert_false(fixture->fs.gc_erase_pending, "gc'ed sector not erased");
+#ifdef CONFIG_NVS_GC_STATS
+	zassert_equal(fixture->fs.gc_stats.foreground, 0, "unexpected foreground gc");
+	zassert_equal(fixture->fs.gc_stats.background, 1, "no background gc");
+	zassert_equal(fixture->fs.gc_stats.background_erases, 1, "no background erase");
+#endif
+
+	/* The background gc requested when the threshold is crossed is done
+	 * by the write that fills the sector. The background gc must then
+	 * only erase the sector, and not gc the new write sector as well.
+	 */
+	data = nvs_fill_sector(&fixture->fs, data);
+
+	zassert_true(fixture->fs.gc_erase_pending, "gc'ed sector erase not deferred");
+	zassert_false(fixture->fs.gc_requested, "background gc still requested");
+
+	nvs_gc_idle(&fixture->fs);
+
+	zassert_false(fixture->fs.gc_erase_pending, "gc'ed sector not erased");
+#ifdef CONFIG_NVS_GC_STATS
+	zassert_equal(fixture->fs.gc_stats.foreground, 1, "no foreground gc");
+	zassert_equal(fixture->fs.gc_stats.background, 1, "unexpected background gc");
+	zassert_equal(fixture->fs.gc_stats.background_erases, 2, "no background erase");
+#endif
+
+	/* Fill the write sector again, and leave the erase pending */
+	data = nvs_fill_sector(&fixture->fs, data + 1);
+
+	zassert_true(fixture->fs.gc_erase_pending, "gc'ed sector erase not deferred");
+#ifdef CONFIG_NVS_GC_STATS
+	zassert_equal(fixture->fs.gc_stats.foreground, 2, "no foreground gc");
+#endif
+
+	err = nvs_read(&fixture->fs, TEST_DATA_ID, &rd_data, sizeof(rd_data));
+	zassert_equal(err, sizeof(rd_data), "nvs_read call failure: %d", err);
+	zassert_equal(rd_data, data, "incorrect data read");
+
+	err = nvs_read(&fixture->fs, TEST_DATA_ID + 1, &rd_data, sizeof(rd_data));
+	zassert_equal(err, sizeof(rd_data), "nvs_read call failure: %d", err);
+	zassert_equal(rd_data, 0xDEADBEEF, "incorrect data read");
+
+	/* Lose power after the data of the next write, before its ate. The
+	 * data is written in one flash write, the ate in the next one.
+	 */
+	stats_walk(fixture->sim_thresholds, flash_sim_max_write_calls_find,
+		   &flash_max_write_calls);
+	stats_walk(fixture->sim_stats, flash_sim_write_calls_find, &flash_write_stat);
+
+	memset(torn, 0x5a, sizeof(torn));
+	*flash_max_write_calls = 2;
+	*flash_write_stat = 0;
+
+	err = nvs_write(&fixture->fs, TEST_DATA_ID + 2, torn, sizeof(torn));
+	zassert_equal(err, sizeof(torn), "nvs_write call failure: %d", err);
+
+	*flash_max_write_calls = 0;
+
+	/* Restart before the background erase */
+	err = nvs_mount(&fixture->fs);
+	zassert_true(err == 0, "nvs_mount call failure: %d", err);
+	zassert_false(fixture->fs.gc_erase_pending, "gc'ed sector erase pending");
+
+	err = nvs_read(&fixture->fs, TEST_DATA_ID + 2, rd_torn, sizeof(rd_torn));
+	zassert_equal(err, -ENOENT, "torn write was not discarded: %d", err);
+
+	err = nvs_read(&fixture->fs, TEST_DATA_ID, &rd_data, sizeof(rd_data));
+	zassert_equal(err, sizeof(rd_data), "nvs_read call failure: %d", err);
+	zassert_equal(rd_data, data, "incorrect data read after restart");
+
+	err = nvs_read(&fixture->fs, TEST_DATA_ID + 1, &rd_data, sizeof(rd_data));
+	zassert_equal(err, sizeof(rd_data), "nvs_read call failure: %d", err);
+	zassert_equal(rd_data, 0xDEADBEEF, "incorrect data read after restart");
+
+	/* The next write must not land on the torn data */
+	memset(torn, 0xa5, sizeof(torn));
+	err = nvs_write(&fixture->fs, TEST_DATA_ID + 2, torn, sizeof(torn));
+	zassert_equal(err, sizeof(torn), "nvs_write call failure: %d", err);
+
+	err = nvs_mount(&fixture->fs);
+	zassert_true(err == 0, "nvs_mount call failure: %d", err);
+
+	err = nvs_read(&fixture->fs, TEST_DATA_ID + 2, rd_torn, sizeof(rd_torn));
+	zassert_equal(err, sizeof(rd_torn), "nvs_read call failure: %d", err);
+	zassert_mem_equal(rd_torn, torn, sizeof(torn), "incorrect data read after restart");
+#endif
+}
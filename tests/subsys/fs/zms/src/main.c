@@ -92,6 +92,9 @@ static void after(void *data)
 	}
 
 	fixture->fs.sector_count = TEST_SECTOR_COUNT;
+#ifdef CONFIG_ZMS_BACKGROUND_GC
+	fixture->fs.background_gc = false;
+#endif
 }
 
 ZTEST_SUITE(zms, NULL, setup, before, after, NULL);
@@ -887,3 +890,117 @@ ZTEST_F(zms, test_zms_cache_hash_quality)
 
 #endif
 }
+
+#ifdef CONFIG_ZMS_BACKGROUND_GC
+/* Wait until the background GC has nothing left to do */
+static void zms_gc_idle(struct zms_fs *fs)
+{
+	struct k_work_sync sync;
+
+	while (k_work_flush(&fs->gc_work, &sync)) {
+	}
+}
+
+/* Fill the write sector without letting the background GC run */
+static uint32_t zms_fill_sector(struct zms_fs *fs, uint32_t data)
+{
+	uint64_t sector = SECTOR_NUM(fs->ate_wra);
+	int err;
+
+	for (; SECTOR_NUM(fs->ate_wra) == sector; data++) {
+		err = zms_write(fs, TEST_DATA_ID, &data, sizeof(data));
+		zassert_equal(err, sizeof(data), "zms_write call failure: %d", err);
+	}
+
+	return data - 1;
+}
+#endif
+
+/*
+ * Test that the background GC closes the write sector ahead of time and erases
+ * the garbage collected sector, that a foreground GC cancels a background GC
+ * request, and that an erase left to the background GC is finished by
+ * zms_mount() after a restart.
+ */
+ZTEST_F(zms, test_zms_background_gc)
+{
+#ifdef CONFIG_ZMS_BACKGROUND_GC
+	int err;
+	uint32_t data;
+	uint32_t rd_data;
+	uint64_t sector;
+
+	fixture->fs.background_gc = true;
+	err = zms_mount(&fixture->fs);
+	zassert_true(err == 0, "zms_mount call failure: %d", err);
+
+	data = 0xDEADBEEF;
+	err = zms_write(&fixture->fs, TEST_DATA_ID + 1, &data, sizeof(data));
+	zassert_equal(err, sizeof(data), "zms_write call failure: %d", err);
+
+	/* Let the background GC run after each write */
+	sector = SECTOR_NUM(fixture->fs.ate_wra);
+	for (data = 0; SECTOR_NUM(fixture->fs.ate_wra) == sector; data++) {
+		zassert_true(data < fixture->fs.sector_size, "sector never closed");
+
+		err = zms_write(&fixture->fs, TEST_DATA_ID, &data, sizeof(data));
+		zassert_equal(err, sizeof(data), "zms_write call failure: %d", err);
+
+		zms_gc_idle(&fixture->fs);
+	}
+
+	zassert_false(fixture->fs.gc_erase_pending, "GC'ed sector not erased");
+#ifdef CONFIG_ZMS_GC_STATS
+	zassert_equal(fixture->fs.gc_stats.foreground, 0, "unexpected foreground GC");
+	zassert_equal(fixture->fs.gc_stats.background, 1, "no background GC");
+	zassert_equal(fixture->fs.gc_stats.background_erases, 1, "no background erase");
+#endif
+
+	/* The background GC requested when the threshold is crossed is done
+	 * by the write that fills the sector. The background GC must then
+	 * only erase the sector, and not GC the new write sector as well.
+	 */
+	data = zms_fill_sector(&fixture->fs, data);
+
+	zassert_true(fixture->fs.gc_erase_pending, "GC'ed sector erase not deferred");
+	zassert_false(fixture->fs.gc_requested, "background GC still requested");
+
+	zms_gc_idle(&fixture->fs);
+
+	zassert_false(fixture->fs.gc_erase_pending, "GC'ed sector not erased");
+#ifdef CONFIG_ZMS_GC_STATS
+	zassert_equal(fixture->fs.gc_stats.foreground, 1, "no foreground GC");
+	zassert_equal(fixture->fs.gc_stats.background, 1, "unexpected background GC");
+	zassert_equal(fixture->fs.gc_stats.background_erases, 2, "no background erase");
+#endif
+
+	/* Fill the write sector again, and leave the erase pending */
+	data = zms_fill_sector(&fixture->fs, data + 1);
+
+	zassert_true(fixture->fs.gc_erase_pending, "GC'ed sector erase not deferred");
+#ifdef CONFIG_ZMS_GC_STATS
+	zassert_equal(fixture->fs.gc_stats.foreground, 2, "no foreground GC");
+#endif
+
+	err = zms_read(&fixture->fs, TEST_DATA_ID, &rd_data, sizeof(rd_data));
+	zassert_equal(err, sizeof(rd_data), "zms_read call failure: %d", err);
+	zassert_equal(rd_data, data, "incorrect data read");
+
+	err = zms_read(&fixture->fs, TEST_DATA_ID + 1, &rd_data, sizeof(rd_data));
+	zassert_equal(err, sizeof(rd_data), "zms_read call failure: %d", err);
+	zassert_equal(rd_data, 0xDEADBEEF, "incorrect data read");
+
+	/* Restart before the background erase */
+	err = zms_mount(&fixture->fs);
+	zassert_true(err == 0, "zms_mount call failure: %d", err);
+	zassert_false(fixture->fs.gc_erase_pending, "GC'ed sector erase pending");
+
+	err = zms_read(&fixture->fs, TEST_DATA_ID, &rd_data, sizeof(rd_data));
+	zassert_equal(err, sizeof(rd_data), "zms_read call failure: %d", err);
+	zassert_equal(rd_data, data, "incorrect data read after restart");
+
+	err = zms_read(&fixture->fs, TEST_DATA_ID + 1, &rd_data, sizeof(rd_data));
+	zassert_equal(err, sizeof(rd_data), "zms_read call failure: %d", err);
+	zassert_equal(rd_data, 0xDEADBEEF, "incorrect data read after restart");
+#endif
+}
@@ -677,6 +677,204 @@ ZTEST(lib_stream_flash, test_stream_flash_progress_clear)
 #endif
 }
 
+#ifdef CONFIG_STREAM_FLASH_ERASE_ASYNC
+/* Device whose erases wait for erase_release, to hold background erases */
+static struct device gated_dev;
+static struct flash_driver_api gated_api;
+static off_t gated_erase_offset;
+static atomic_t gated_erases;
+static K_SEM_DEFINE(erase_started, 0, 1);
+static K_SEM_DEFINE(erase_release, 0, 1);
+static K_SEM_DEFINE(erase_done, 0, 1);
+
+static int gated_erase(const struct device *dev, off_t offset, size_t size)
+{
+	int rc;
+
+	gated_erase_offset = offset;
+	atomic_inc(&gated_erases);
+	k_sem_give(&erase_started);
+
+	rc = k_sem_take(&erase_release, K_SECONDS(1));
+	if (rc == 0) {
+		rc = api->erase(fdev, offset, size);
+	}
+
+	k_sem_give(&erase_done);
+
+	return rc;
+}
+
+static void erase_release_expiry(struct k_timer *timer)
+{
+	k_sem_give(&erase_release);
+}
+
+static K_TIMER_DEFINE(erase_release_timer, erase_release_expiry, NULL);
+
+static void gated_init(struct stream_flash_ctx *sf_ctx)
+{
+	gated_dev = *fdev;
+	gated_api = *api;
+	gated_api.erase = gated_erase;
+	gated_dev.api = &gated_api;
+	sf_ctx->fdev = &gated_dev;
+
+	atomic_clear(&gated_erases);
+	k_sem_reset(&erase_started);
+	k_sem_reset(&erase_release);
+	k_sem_reset(&erase_done);
+}
+
+/* Buffer data up to 16 bytes into a page, whose erase must then start in
+ * the background and be held there, with the data still in the buffer.
+ */
+static void buffer_into_page(struct stream_flash_ctx *sf_ctx, int page)
+{
+	off_t page_offset = sf_ctx->offset + page * page_size;
+	size_t len = page_offset + 16 - (sf_ctx->offset + sf_ctx->bytes_written +
+					 sf_ctx->buf_bytes);
+	int rc;
+
+	k_sem_reset(&erase_started);
+	k_sem_reset(&erase_done);
+
+	rc = stream_flash_buffered_write(sf_ctx, write_buf, len, false);
+	zassert_equal(rc, 0, "expected success");
+
+	rc = k_sem_take(&erase_started, K_SECONDS(1));
+	zassert_equal(rc, 0, "erase of page %d not started", page);
+	zassert_equal(gated_erase_offset, page_offset, "wrong page erased");
+	zassert_equal(sf_ctx->bytes_written, page * page_size, "buffer was written");
+	zassert_equal(sf_ctx->buf_bytes, 16, "data not in the buffer");
+	zassert_equal(k_sem_count_get(&erase_done), 0, "erase was not held");
+}
+
+ZTEST(lib_stream_flash, test_stream_flash_erase_async_next_page)
+{
+	int rc;
+
+	zassume_true(page_size % BUF_LEN == 0, "page size is not a buffer multiple");
+
+	init_target();
+
+	/* Fill the first page, the next write is for the second one */
+	rc = stream_flash_buffered_write(&ctx, write_buf, page_size, false);
+	zassert_equal(rc, 0, "expected success");
+	zassert_equal(ctx.buf_bytes, 0, "expected an empty buffer");
+
+	gated_init(&ctx);
+	buffer_into_page(&ctx, 1);
+
+	/* The flush has to wait for the erase, and not erase again */
+	k_timer_start(&erase_release_timer, K_MSEC(50), K_NO_WAIT);
+
+	rc = stream_flash_buffered_write(&ctx, NULL, 0, true);
+	zassert_equal(rc, 0, "expected success");
+	zassert_equal(k_sem_count_get(&erase_done), 1, "written before the erase ended");
+	zassert_equal(atomic_get(&gated_erases), 1, "page erased twice");
+
+	VERIFY_WRITTEN(0, page_size + 16);
+}
+
+ZTEST(lib_stream_flash, test_stream_flash_erase_async_wait)
+{
+	int rc;
+
+	zassume_true(page_size % BUF_LEN == 0, "page size is not a buffer multiple");
+
+	clear_all_progress();
+	init_target();
+	gated_init(&ctx);
+
+	buffer_into_page(&ctx, 0);
+
+	/* An explicit erase of the page waits for the one in the background */
+	k_timer_start(&erase_release_timer, K_MSEC(50), K_NO_WAIT);
+
+	rc = stream_flash_erase_page(&ctx, FLASH_BASE);
+	zassert_equal(rc, 0, "expected success");
+	zassert_equal(k_sem_count_get(&erase_done), 1, "returned before the erase ended");
+	zassert_equal(atomic_get(&gated_erases), 1, "page erased twice");
+	zassert_equal(ctx.last_erased_page_start_offset, FLASH_BASE,
+		      "expected the erased page to be recorded");
+
+	buffer_into_page(&ctx, 1);
+
+	/* So does loading the progress, which sets the last erased page */
+	k_timer_start(&erase_release_timer, K_MSEC(50), K_NO_WAIT);
+
+	rc = stream_flash_progress_load(&ctx, progress_key);
+	zassert_equal(rc, 0, "expected success");
+	zassert_equal(k_sem_count_get(&erase_done), 1, "returned before the erase ended");
+	zassert_equal(ctx.last_erased_page_start_offset, FLASH_BASE + page_size,
+		      "expected the erased page to be recorded");
+
+	rc = stream_flash_buffered_write(&ctx, NULL, 0, true);
+	zassert_equal(rc, 0, "expected success");
+	zassert_equal(atomic_get(&gated_erases), 2, "page erased twice");
+
+	VERIFY_WRITTEN(0, page_size + 16);
+}
+
+ZTEST(lib_stream_flash, test_stream_flash_erase_async_abandoned)
+{
+	static uint8_t other_buf[BUF_LEN];
+	struct stream_flash_ctx other_ctx;
+	int rc;
+
+	init_target();
+	gated_init(&ctx);
+
+	/* Let the erase of a context end, and never write that context again */
+	buffer_into_page(&ctx, 0);
+	k_sem_give(&erase_release);
+
+	rc = k_sem_take(&erase_done, K_SECONDS(1));
+	zassert_equal(rc, 0, "erase did not end");
+
+	/* Another context still gets its page erased in the background */
+	rc = stream_flash_init(&other_ctx, fdev, other_buf, BUF_LEN,
+			       FLASH_BASE + 2 * page_size, 0, NULL);
+	zassert_equal(rc, 0, "expected success");
+
+	gated_init(&other_ctx);
+	buffer_into_page(&other_ctx, 0);
+
+	k_sem_give(&erase_release);
+
+	rc = stream_flash_buffered_write(&other_ctx, NULL, 0, true);
+	zassert_equal(rc, 0, "expected success");
+	zassert_equal(atomic_get(&gated_erases), 1, "page erased twice");
+
+	VERIFY_WRITTEN(2 * page_size, 16);
+
+	/* The first context lost its erase, and erases its page when writing */
+	k_sem_give(&erase_release);
+
+	rc = stream_flash_buffered_write(&ctx, NULL, 0, true);
+	zassert_equal(rc, 0, "expected success");
+	zassert_equal(atomic_get(&gated_erases), 2, "page not erased again");
+
+	VERIFY_WRITTEN(0, 16);
+}
+#else
+ZTEST(lib_stream_flash, test_stream_flash_erase_async_next_page)
+{
+	ztest_test_skip();
+}
+
+ZTEST(lib_stream_flash, test_stream_flash_erase_async_wait)
+{
+	ztest_test_skip();
+}
+
+ZTEST(lib_stream_flash, test_stream_flash_erase_async_abandoned)
+{
+	ztest_test_skip();
+}
+#endif /* CONFIG_STREAM_FLASH_ERASE_ASYNC */
+
 void lib_stream_flash_before(void *data)
 {
 	zassume_true(device_is_ready(fdev), "Device is not ready");
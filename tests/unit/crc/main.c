@@ -292,4 +292,52 @@ ZTEST(crc, test_crc8)
 	zassert_equal(fcs, expected, "0x%02x vs 0x%02x", fcs, expected);
 }
 
+/* Bit at a time reference for the reflected CRC-32 variants */
+static uint32_t crc32_bitwise(uint32_t poly, uint32_t crc, const uint8_t *data, size_t len)
+{
+	for (size_t i = 0; i < len; i++) {
+		crc ^= data[i];
+
+		for (int j = 0; j < 8; j++) {
+			crc = (crc >> 1) ^ ((crc & 1U) ? poly : 0U);
+		}
+	}
+
+	return crc;
+}
+
+/* The table driven implementations process eight bytes at a time when
+ * CONFIG_CRC_SLICE_BY_8 is enabled: check them against bitwise references
+ * for every length and alignment around that block size.
+ */
+ZTEST(crc, test_crc_lengths_alignments)
+{
+	static uint8_t buf[96];
+	uint32_t seed = 0x12345678U;
+
+	for (size_t i = 0; i < sizeof(buf); i++) {
+		seed = seed * 1103515245U + 12345U;
+		buf[i] = (uint8_t)(seed >> 16);
+	}
+
+	for (size_t off = 0; off < 8; off++) {
+		for (size_t len = 0; len <= (sizeof(buf) - off); len++) {
+			const uint8_t *data = &buf[off];
+
+			zassert_equal(crc32_ieee_update(seed, data, len),
+				      ~crc32_bitwise(0xedb88320U, ~seed, data, len),
+				      "crc32_ieee off %zu len %zu", off, len);
+			zassert_equal(crc32_c(seed, data, len, false, false),
+				      crc32_bitwise(0x82f63b78U, seed, data, len),
+				      "crc32_c off %zu len %zu", off, len);
+			zassert_equal(crc16_ccitt((uint16_t)seed, data, len),
+				      crc16_reflect(0x8408, (uint16_t)seed, data, len),
+				      "crc16_ccitt off %zu len %zu", off, len);
+			zassert_equal(crc16_itu_t((uint16_t)seed, data, len),
+				      crc16(0x1021, (uint16_t)seed, data, len),
+				      "crc16_itu_t off %zu len %zu", off, len);
+		}
+	}
+}
+
 ZTEST_SUITE(crc, NULL, NULL, NULL, NULL, NULL);